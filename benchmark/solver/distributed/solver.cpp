@@ -95,8 +95,9 @@ int main(int argc, char* argv[])
         print_general_information(extra_information);
     }
 
-    std::set<std::string> supported_solvers = {"cg", "fcg", "cgs", "bicgstab",
-                                               "gmres"};
+    std::set<std::string> supported_solvers = {
+        "cg",      "fcg",      "cgs",            "bicgstab",
+        "pipe_cg", "sstep_cg", "sstep_bicgstab", "gmres"};
     auto solvers = split(FLAGS_solvers, ',');
     for (const auto& solver : solvers) {
         if (supported_solvers.find(solver) == supported_solvers.end()) {
@@ -39,8 +39,8 @@ DEFINE_string(solvers, "cg",
               "Supported values are: bicgstab, bicg, cb_gmres_keep, "
               "cb_gmres_reduce1, cb_gmres_reduce2, cb_gmres_integer, "
               "cb_gmres_ireduce1, cb_gmres_ireduce2, cg, cgs, fcg, gmres, idr, "
-              "lower_trs, upper_trs, spd_direct, symm_direct, "
-              "near_symm_direct, direct, overhead");
+              "pipe_cg, sstep_bicgstab, sstep_cg, lower_trs, upper_trs, "
+              "spd_direct, symm_direct, near_symm_direct, direct, overhead");
 
 DEFINE_uint32(
     nrhs, 1,
@@ -52,6 +52,14 @@ DEFINE_uint32(gcr_restart, 100,
 DEFINE_uint32(gmres_restart, 100,
               "Maximum dimension of the Krylov space to use in GMRES");
 
+DEFINE_string(gmres_ortho, "mgs",
+              "Orthogonalization method to use in GMRES. Supported values "
+              "are: mgs, cgs, cgs2");
+
+DEFINE_uint32(sstep_steps, 4,
+              "Number of iterations per global reduction in the s-step "
+              "solvers");
+
 DEFINE_uint32(idr_subspace_dim, 2,
               "What dimension of the subspace to use in IDR");
 
@@ -142,6 +150,21 @@ std::unique_ptr<gko::LinOpFactory> add_criteria_precond_finalize(
 }
 
 
+gko::solver::gmres::ortho_method get_gmres_ortho_method()
+{
+    if (FLAGS_gmres_ortho == "mgs") {
+        return gko::solver::gmres::ortho_method::mgs;
+    } else if (FLAGS_gmres_ortho == "cgs") {
+        return gko::solver::gmres::ortho_method::cgs;
+    } else if (FLAGS_gmres_ortho == "cgs2") {
+        return gko::solver::gmres::ortho_method::cgs2;
+    }
+    throw std::range_error(
+        "The requested GMRES orthogonalization method <" + FLAGS_gmres_ortho +
+        "> is not supported!");
+}
+
+
 std::unique_ptr<gko::LinOpFactory> generate_solver(
     const std::shared_ptr<const gko::Executor>& exec,
     std::shared_ptr<const gko::LinOpFactory> precond,
@@ -189,6 +212,18 @@ std::unique_ptr<gko::LinOpFactory> generate_solver(
     } else if (description == "fcg") {
         return add_criteria_precond_finalize<gko::solver::Fcg<etype>>(
             exec, precond, max_iters);
+    } else if (description == "pipe_cg") {
+        return add_criteria_precond_finalize<gko::solver::PipeCg<etype>>(
+            exec, precond, max_iters);
+    } else if (description == "sstep_bicgstab") {
+        return add_criteria_precond_finalize(
+            gko::solver::SstepBicgstab<etype>::build().with_steps(
+                FLAGS_sstep_steps),
+            exec, precond, max_iters);
+    } else if (description == "sstep_cg") {
+        return add_criteria_precond_finalize(
+            gko::solver::SstepCg<etype>::build().with_steps(FLAGS_sstep_steps),
+            exec, precond, max_iters);
     } else if (description == "idr") {
         return add_criteria_precond_finalize(
             gko::solver::Idr<etype>::build()
@@ -197,8 +232,9 @@ std::unique_ptr<gko::LinOpFactory> generate_solver(
             exec, precond, max_iters);
     } else if (description == "gmres") {
         return add_criteria_precond_finalize(
-            gko::solver::Gmres<etype>::build().with_krylov_dim(
-                FLAGS_gmres_restart),
+            gko::solver::Gmres<etype>::build()
+                .with_krylov_dim(FLAGS_gmres_restart)
+                .with_ortho_method(get_gmres_ortho_method()),
             exec, precond, max_iters);
     } else if (description == "lower_trs") {
         return gko::solver::LowerTrs<etype>::build()
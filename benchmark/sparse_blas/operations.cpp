@@ -723,9 +723,6 @@ private:
 };
 
 
-#if GKO_HAVE_METIS
-
-
 class ReorderNestedDissectionOperation : public BenchmarkOperation {
     using factory_type =
         gko::experimental::reorder::NestedDissection<etype, itype>;
@@ -758,9 +755,6 @@ private:
 };
 
 
-#endif
-
-
 class ReorderApproxMinDegOperation : public BenchmarkOperation {
     using factory_type = gko::experimental::reorder::Amd<itype>;
     using reorder_type = gko::matrix::Permutation<itype>;
@@ -840,12 +834,8 @@ const std::map<std::string,
              return std::make_unique<ReorderApproxMinDegOperation>(mtx);
          }},
         {"reorder_nd",
-         [](const Mtx* mtx) -> std::unique_ptr<BenchmarkOperation> {
-#if GKO_HAVE_METIS
+         [](const Mtx* mtx) {
              return std::make_unique<ReorderNestedDissectionOperation>(mtx);
-#else
-             GKO_NOT_COMPILED(METIS);
-#endif
          }}};
 
 
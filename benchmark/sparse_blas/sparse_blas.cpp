@@ -34,11 +34,7 @@ const char* operations_string =
     "Comma-separated list of operations to be benchmarked. Can be "
     "spgemm, spgeam, transpose, sort, is_sorted, generate_lookup, "
     "lookup, symbolic_lu, symbolic_lu_near_symm, symbolic_cholesky, "
-    "symbolic_cholesky_symmetric, reorder_rcm, "
-#if GKO_HAVE_METIS
-    "reorder_nd, "
-#endif
-    "reorder_amd";
+    "symbolic_cholesky_symmetric, reorder_rcm, reorder_nd, reorder_amd";
 
 DEFINE_string(operations, "spgemm,spgeam,transpose", operations_string);
 
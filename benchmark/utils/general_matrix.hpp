@@ -20,9 +20,7 @@ std::string reordering_algorithm_desc =
     "Reordering algorithm to apply to the input matrices:\n"
     "    none - no reordering\n"
     "    amd - Approximate Minimum Degree reordering algorithm\n"
-#if GKO_HAVE_METIS
     "    nd - Nested Dissection reordering algorithm\n"
-#endif
     "    rcm - Reverse Cuthill-McKee reordering algorithm\n"
     "This is a preprocessing step whose runtime will not be included\n"
     "in the measurements.";
@@ -55,13 +53,11 @@ std::unique_ptr<gko::matrix::Permutation<IndexType>> reorder(
         perm = gko::experimental::reorder::Amd<IndexType>::build()
                    .on(ref)
                    ->generate(mtx);
-#if GKO_HAVE_METIS
     } else if (FLAGS_reorder == "nd") {
         perm = gko::experimental::reorder::NestedDissection<ValueType,
                                                             IndexType>::build()
                    .on(ref)
                    ->generate(mtx);
-#endif
     } else if (FLAGS_reorder == "rcm") {
         perm = gko::experimental::reorder::Rcm<IndexType>::build()
                    .on(ref)
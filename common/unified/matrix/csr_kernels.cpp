@@ -12,6 +12,8 @@
 
 
 #include "common/unified/base/kernel_launch.hpp"
+#include "common/unified/base/kernel_launch_reduction.hpp"
+#include "core/base/array_access.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
 
 
@@ -123,6 +125,61 @@ void inv_scale(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_INV_SCALE_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_numeric(std::shared_ptr<const DefaultExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* a,
+                    const matrix::Csr<ValueType, IndexType>* b,
+                    const IndexType* storage_offsets, const int64* row_desc,
+                    const int32* storage, matrix::Csr<ValueType, IndexType>* c,
+                    size_type& num_missing)
+{
+    array<int64> result{exec, 1};
+    // each row returns the number of its products that have no entry in c
+    run_kernel_reduction(
+        exec,
+        [] GKO_KERNEL(auto row, auto a_row_ptrs, auto a_col_idxs, auto a_vals,
+                      auto b_row_ptrs, auto b_col_idxs, auto b_vals,
+                      auto c_row_ptrs, auto c_col_idxs, auto c_vals,
+                      auto storage_offsets, auto storage, auto row_descs) {
+            gko::matrix::csr::device_sparsity_lookup<IndexType> lookup{
+                c_row_ptrs, c_col_idxs, storage_offsets,
+                storage,    row_descs,  static_cast<size_type>(row)};
+            const auto c_begin = c_row_ptrs[row];
+            const auto c_end = c_row_ptrs[row + 1];
+            for (auto c_nz = c_begin; c_nz < c_end; c_nz++) {
+                c_vals[c_nz] = zero(c_vals[c_nz]);
+            }
+            int64 missing{};
+            for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1];
+                 a_nz++) {
+                const auto a_val = a_vals[a_nz];
+                const auto b_row = a_col_idxs[a_nz];
+                for (auto b_nz = b_row_ptrs[b_row];
+                     b_nz < b_row_ptrs[b_row + 1]; b_nz++) {
+                    const auto c_nz = c_begin == c_end
+                                          ? invalid_index<IndexType>()
+                                          : lookup[b_col_idxs[b_nz]];
+                    if (c_nz == invalid_index<IndexType>()) {
+                        missing++;
+                    } else {
+                        c_vals[c_begin + c_nz] += a_val * b_vals[b_nz];
+                    }
+                }
+            }
+            return missing;
+        },
+        GKO_KERNEL_REDUCE_SUM(int64), result.get_data(), a->get_size()[0],
+        a->get_const_row_ptrs(), a->get_const_col_idxs(),
+        a->get_const_values(), b->get_const_row_ptrs(), b->get_const_col_idxs(),
+        b->get_const_values(), c->get_const_row_ptrs(), c->get_const_col_idxs(),
+        c->get_values(), storage_offsets, storage, row_desc);
+    num_missing = static_cast<size_type>(get_element(result, 0));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void convert_to_sellp(std::shared_ptr<const DefaultExecutor> exec,
                       const matrix::Csr<ValueType, IndexType>* matrix,
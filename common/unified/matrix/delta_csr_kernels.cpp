@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch.hpp"
+#include "core/base/mixed_precision_types.hpp"
+#include "core/matrix/delta_csr_codec.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The delta-compressed sparse row matrix format namespace.
+ * @ref DeltaCsr
+ * @ingroup delta_csr
+ */
+namespace delta_csr {
+
+
+// The OpenMP executor uses a SpMV that decodes every row only once for all
+// right-hand sides, see omp/matrix/delta_csr_kernels.cpp
+#ifndef GKO_COMPILING_OMP
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType>
+void spmv(std::shared_ptr<const DefaultExecutor> exec,
+          const matrix::DeltaCsr<MatrixValueType, IndexType>* a,
+          const matrix::Dense<InputValueType>* b,
+          matrix::Dense<OutputValueType>* c)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto row_ptrs, auto row_bases,
+                      auto idx_ptrs, auto idxs, auto vals, auto b, auto c) {
+            using arithmetic_type = device_type<highest_precision<
+                InputValueType, OutputValueType, MatrixValueType>>;
+            auto sum = zero<arithmetic_type>();
+            matrix::delta_csr::for_each_entry(
+                row_ptrs, row_bases, idx_ptrs, idxs, row,
+                [&](IndexType nz, IndexType b_row) {
+                    sum += static_cast<arithmetic_type>(vals[nz]) *
+                           static_cast<arithmetic_type>(b(b_row, col));
+                });
+            c(row, col) = static_cast<device_type<OutputValueType>>(sum);
+        },
+        c->get_size(), a->get_const_row_ptrs(), a->get_const_row_bases(),
+        a->get_const_compressed_idx_ptrs(), a->get_const_compressed_idxs(),
+        a->get_const_values(), b, c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,
+                   const matrix::Dense<MatrixValueType>* alpha,
+                   const matrix::DeltaCsr<MatrixValueType, IndexType>* a,
+                   const matrix::Dense<InputValueType>* b,
+                   const matrix::Dense<OutputValueType>* beta,
+                   matrix::Dense<OutputValueType>* c)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto alpha, auto row_ptrs,
+                      auto row_bases, auto idx_ptrs, auto idxs, auto vals,
+                      auto b, auto beta, auto c) {
+            using arithmetic_type = device_type<highest_precision<
+                InputValueType, OutputValueType, MatrixValueType>>;
+            auto sum = zero<arithmetic_type>();
+            matrix::delta_csr::for_each_entry(
+                row_ptrs, row_bases, idx_ptrs, idxs, row,
+                [&](IndexType nz, IndexType b_row) {
+                    sum += static_cast<arithmetic_type>(vals[nz]) *
+                           static_cast<arithmetic_type>(b(b_row, col));
+                });
+            c(row, col) = static_cast<device_type<OutputValueType>>(
+                static_cast<arithmetic_type>(beta[0]) *
+                    static_cast<arithmetic_type>(c(row, col)) +
+                static_cast<arithmetic_type>(alpha[0]) * sum);
+        },
+        c->get_size(), alpha->get_const_values(), a->get_const_row_ptrs(),
+        a->get_const_row_bases(), a->get_const_compressed_idx_ptrs(),
+        a->get_const_compressed_idxs(), a->get_const_values(), b,
+        beta->get_const_values(), c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+
+
+#endif  // GKO_COMPILING_OMP
+
+
+template <typename IndexType>
+void compute_compressed_sizes(std::shared_ptr<const DefaultExecutor> exec,
+                              size_type num_rows, const IndexType* row_ptrs,
+                              const IndexType* col_idxs, IndexType* row_bases,
+                              int64* compressed_sizes)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto row_bases,
+                      auto compressed_sizes) {
+            compressed_sizes[row] = matrix::delta_csr::compute_row_size(
+                col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1],
+                row_bases[row]);
+        },
+        num_rows, row_ptrs, col_idxs, row_bases, compressed_sizes);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_COMPUTE_COMPRESSED_SIZES_KERNEL);
+
+
+template <typename IndexType>
+void compress_idxs(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_rows, const IndexType* row_ptrs,
+                   const IndexType* col_idxs, const IndexType* row_bases,
+                   const int64* compressed_idx_ptrs, uint8* compressed_idxs)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto row_bases,
+                      auto compressed_idx_ptrs, auto compressed_idxs) {
+            const auto begin = row_ptrs[row];
+            const auto end = row_ptrs[row + 1];
+            if (begin == end) {
+                return;
+            }
+            const auto width =
+                (compressed_idx_ptrs[row + 1] - compressed_idx_ptrs[row]) /
+                (end - begin);
+            matrix::delta_csr::encode_row(
+                col_idxs + begin, col_idxs + end, row_bases[row], width,
+                compressed_idxs + compressed_idx_ptrs[row]);
+        },
+        num_rows, row_ptrs, col_idxs, row_bases, compressed_idx_ptrs,
+        compressed_idxs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_COMPRESS_IDXS_KERNEL);
+
+
+template <typename IndexType>
+void decompress_idxs(std::shared_ptr<const DefaultExecutor> exec,
+                     size_type num_rows, const IndexType* row_ptrs,
+                     const IndexType* row_bases,
+                     const int64* compressed_idx_ptrs,
+                     const uint8* compressed_idxs, IndexType* col_idxs)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto row_bases,
+                      auto compressed_idx_ptrs, auto compressed_idxs,
+                      auto col_idxs) {
+            matrix::delta_csr::for_each_entry(
+                row_ptrs, row_bases, compressed_idx_ptrs, compressed_idxs, row,
+                [&](IndexType nz, IndexType col) { col_idxs[nz] = col; });
+        },
+        num_rows, row_ptrs, row_bases, compressed_idx_ptrs, compressed_idxs,
+        col_idxs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_DECOMPRESS_IDXS_KERNEL);
+
+
+}  // namespace delta_csr
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
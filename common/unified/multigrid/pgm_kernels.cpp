@@ -311,6 +311,40 @@ GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG);
 
 
+template <typename LocalIndexType, typename GlobalIndexType>
+void map_to_global(std::shared_ptr<const DefaultExecutor> exec, size_type num,
+                   GlobalIndexType offset, const LocalIndexType* local_idxs,
+                   GlobalIndexType* global_idxs)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto tidx, auto offset, auto local_idxs,
+                      auto global_idxs) {
+            global_idxs[tidx] =
+                offset + static_cast<GlobalIndexType>(local_idxs[tidx]);
+        },
+        num, offset, local_idxs, global_idxs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(GKO_DECLARE_PGM_MAP_TO_GLOBAL);
+
+
+template <typename LocalIndexType, typename GlobalIndexType>
+void gather_index(std::shared_ptr<const DefaultExecutor> exec, size_type num,
+                  const GlobalIndexType* orig, const LocalIndexType* gather_map,
+                  GlobalIndexType* result)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto tidx, auto orig, auto gather_map, auto result) {
+            result[tidx] = orig[gather_map[tidx]];
+        },
+        num, orig, gather_map, result);
+}
+
+GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(GKO_DECLARE_PGM_GATHER_INDEX);
+
+
 }  // namespace pgm
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
@@ -8,6 +8,7 @@
 #include <ginkgo/core/base/math.hpp>
 
 
+#include "common/unified/base/kernel_launch_reduction.hpp"
 #include "common/unified/base/kernel_launch_solver.hpp"
 
 
@@ -111,6 +112,64 @@ void step_2(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void gather_columns(std::shared_ptr<const DefaultExecutor> exec,
+                    const array<size_type>& columns,
+                    const matrix::Dense<ValueType>* orig,
+                    matrix::Dense<ValueType>* gathered)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto columns, auto orig,
+                      auto gathered) {
+            gathered(row, col) = orig(row, columns[col]);
+        },
+        gathered->get_size(), columns, orig, gathered);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_GATHER_COLUMNS_KERNEL);
+
+
+template <typename ValueType>
+void scatter_columns(std::shared_ptr<const DefaultExecutor> exec,
+                     const array<size_type>& columns,
+                     const matrix::Dense<ValueType>* gathered,
+                     matrix::Dense<ValueType>* orig)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto columns, auto gathered,
+                      auto orig) {
+            orig(row, columns[col]) = gathered(row, col);
+        },
+        gathered->get_size(), columns, gathered, orig);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_SCATTER_COLUMNS_KERNEL);
+
+
+template <typename ValueType>
+void block_conj_dot(std::shared_ptr<const DefaultExecutor> exec,
+                    const matrix::Dense<ValueType>* x,
+                    const matrix::Dense<ValueType>* y,
+                    matrix::Dense<ValueType>* result, array<char>& tmp)
+{
+    const auto num_cols = static_cast<int64>(y->get_size()[1]);
+    // column i * num_cols + j of the reduction computes result(i, j), so all
+    // inner products need only a single reduction over the contiguous result
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto y, auto num_cols) {
+            return conj(x(row, col / num_cols)) * y(row, col % num_cols);
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), result->get_values(),
+        dim<2>{x->get_size()[0], x->get_size()[1] * y->get_size()[1]}, tmp, x,
+        y, num_cols);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_BLOCK_CONJ_DOT_KERNEL);
+
+
 }  // namespace cg
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
@@ -10,6 +10,7 @@
 
 
 #include "common/unified/base/kernel_launch.hpp"
+#include "common/unified/base/kernel_launch_reduction.hpp"
 
 
 namespace gko {
@@ -96,6 +97,60 @@ void multi_axpy(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL);
 
 
+template <typename ValueType>
+void multi_dot(std::shared_ptr<const DefaultExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               const matrix::Dense<ValueType>* next_krylov,
+               matrix::Dense<ValueType>* hessenberg_col, array<char>& tmp)
+{
+    const auto num_rows = static_cast<int64>(next_krylov->get_size()[0]);
+    const auto num_rhs = static_cast<int64>(next_krylov->get_size()[1]);
+    // reduction column i * num_rhs + j computes the inner product of the
+    // j-th right-hand side with the i-th Krylov basis vector, so the result
+    // matches the layout of the contiguous hessenberg_col
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto bases, auto next_krylov,
+                      auto num_rows, auto num_rhs) {
+            const auto basis = col / num_rhs;
+            const auto rhs = col % num_rhs;
+            return conj(bases(row + basis * num_rows, rhs)) *
+                   next_krylov(row, rhs);
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), hessenberg_col->get_values(),
+        dim<2>{next_krylov->get_size()[0],
+               hessenberg_col->get_size()[0] * next_krylov->get_size()[1]},
+        tmp, krylov_bases, next_krylov, num_rows, num_rhs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
+
+
+template <typename ValueType>
+void multi_sub(std::shared_ptr<const DefaultExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               const matrix::Dense<ValueType>* hessenberg_col,
+               matrix::Dense<ValueType>* next_krylov)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto bases, auto hessenberg_col,
+                      auto next_krylov, auto num_bases, auto num_rows) {
+            auto value = next_krylov(row, col);
+            for (int64 i = 0; i < num_bases; i++) {
+                value -=
+                    hessenberg_col(i, col) * bases(row + i * num_rows, col);
+            }
+            next_krylov(row, col) = value;
+        },
+        next_krylov->get_size(), krylov_bases, hessenberg_col, next_krylov,
+        static_cast<int64>(hessenberg_col->get_size()[0]),
+        static_cast<int64>(next_krylov->get_size()[0]));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_SUB_KERNEL);
+
+
 }  // namespace gmres
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
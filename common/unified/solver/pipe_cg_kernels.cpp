@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch_reduction.hpp"
+#include "common/unified/base/kernel_launch_solver.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The pipelined CG solver namespace.
+ *
+ * @ingroup pipe_cg
+ */
+namespace pipe_cg {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const DefaultExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* z, matrix::Dense<ValueType>* w,
+                matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* s,
+                matrix::Dense<ValueType>* prev_rho_delta,
+                matrix::Dense<ValueType>* prev_alpha,
+                array<stopping_status>* stop_status)
+{
+    if (b->get_size()) {
+        run_kernel_solver(
+            exec,
+            [] GKO_KERNEL(auto row, auto col, auto b, auto r, auto z, auto w,
+                          auto p, auto s, auto prev_rho, auto prev_alpha,
+                          auto stop) {
+                if (row == 0) {
+                    prev_rho[col] = one(prev_rho[col]);
+                    prev_alpha[col] = zero(prev_alpha[col]);
+                    stop[col].reset();
+                }
+                r(row, col) = b(row, col);
+                z(row, col) = w(row, col) = p(row, col) = s(row, col) =
+                    zero(z(row, col));
+            },
+            b->get_size(), b->get_stride(), b, default_stride(r),
+            default_stride(z), default_stride(w), default_stride(p),
+            default_stride(s), row_vector(prev_rho_delta),
+            row_vector(prev_alpha), *stop_status);
+    } else {
+        run_kernel(
+            exec,
+            [] GKO_KERNEL(auto col, auto prev_rho, auto prev_alpha, auto stop) {
+                prev_rho[col] = one(prev_rho[col]);
+                prev_alpha[col] = zero(prev_alpha[col]);
+                stop[col].reset();
+            },
+            b->get_size()[1], row_vector(prev_rho_delta),
+            row_vector(prev_alpha), *stop_status);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void compute_dots(std::shared_ptr<const DefaultExecutor> exec,
+                  const matrix::Dense<ValueType>* r,
+                  const matrix::Dense<ValueType>* z,
+                  const matrix::Dense<ValueType>* w,
+                  matrix::Dense<ValueType>* rho_delta, array<char>& tmp)
+{
+    const auto num_rhs = static_cast<int64>(r->get_size()[1]);
+    // the first num_rhs columns of the reduction compute rho, the remaining
+    // ones delta, so both inner products need only a single reduction
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto i, auto j, auto r, auto z, auto w, auto num_rhs) {
+            return j < num_rhs ? conj(r(i, j)) * z(i, j)
+                               : conj(z(i, j - num_rhs)) * w(i, j - num_rhs);
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), rho_delta->get_values(),
+        dim<2>{r->get_size()[0], 2 * r->get_size()[1]}, tmp, r, z, w,
+        num_rhs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_COMPUTE_DOTS_KERNEL);
+
+
+template <typename ValueType>
+void step(std::shared_ptr<const DefaultExecutor> exec,
+          matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+          matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* s,
+          const matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* w,
+          const matrix::Dense<ValueType>* rho_delta,
+          const matrix::Dense<ValueType>* prev_rho_delta,
+          const matrix::Dense<ValueType>* prev_alpha,
+          matrix::Dense<ValueType>* alpha,
+          const array<stopping_status>* stop_status)
+{
+    const auto num_rhs = static_cast<int64>(x->get_size()[1]);
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto p, auto s,
+                      auto z, auto w, auto rho_delta, auto prev_rho_delta,
+                      auto prev_alpha, auto alpha, auto stop, auto num_rhs) {
+            const auto rho = rho_delta[col];
+            const auto delta = rho_delta[col + num_rhs];
+            const auto beta = safe_divide(rho, prev_rho_delta[col]);
+            const auto new_alpha = safe_divide(
+                rho, delta - beta * safe_divide(rho, prev_alpha[col]));
+            if (row == 0) {
+                alpha[col] = new_alpha;
+            }
+            if (!stop[col].has_stopped()) {
+                const auto new_p = z(row, col) + beta * p(row, col);
+                const auto new_s = w(row, col) + beta * s(row, col);
+                p(row, col) = new_p;
+                s(row, col) = new_s;
+                x(row, col) += new_alpha * new_p;
+                r(row, col) -= new_alpha * new_s;
+            }
+        },
+        x->get_size(), r->get_stride(), x, default_stride(r), default_stride(p),
+        default_stride(s), default_stride(z), default_stride(w),
+        row_vector(rho_delta), row_vector(prev_rho_delta),
+        row_vector(prev_alpha), row_vector(alpha), *stop_status, num_rhs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_KERNEL);
+
+
+}  // namespace pipe_cg
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,346 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/sstep_kernels.hpp"
+
+
+#include <limits>
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "common/unified/base/kernel_launch.hpp"
+#include "common/unified/base/kernel_launch_reduction.hpp"
+#include "common/unified/base/kernel_launch_solver.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The s-step Krylov solver namespace.
+ *
+ * @ingroup sstep
+ */
+namespace sstep {
+namespace {
+
+
+/**
+ * Computes u^H G v for the coefficient vectors stored in the rows
+ * [u, u + m) and [v, v + m) of the given column of coeffs, where
+ * G(i, j) = gram(i * m + j, col).
+ */
+template <typename GramAccessor, typename CoeffAccessor>
+GKO_INLINE GKO_ATTRIBUTES auto quadratic_form(GramAccessor gram,
+                                              CoeffAccessor coeffs, int64 col,
+                                              int64 m, int64 u, int64 v)
+{
+    using value_type = std::decay_t<decltype(coeffs(0, 0))>;
+    auto result = zero<value_type>();
+    for (int64 i = 0; i < m; i++) {
+        auto row_result = zero<value_type>();
+        for (int64 j = 0; j < m; j++) {
+            row_result += gram(i * m + j, col) * coeffs(v + j, col);
+        }
+        result += conj(coeffs(u + i, col)) * row_result;
+    }
+    return result;
+}
+
+
+/**
+ * Checks whether the value of u^H G u computed by quadratic_form is dominated
+ * by rounding errors, i.e. whether it is below the rounding error bound of
+ * the sum. tol is the machine epsilon of the value type.
+ */
+template <typename GramAccessor, typename CoeffAccessor, typename ValueType,
+          typename RealType>
+GKO_INLINE GKO_ATTRIBUTES bool is_rounding_error(GramAccessor gram,
+                                                 CoeffAccessor coeffs,
+                                                 int64 col, int64 m, int64 u,
+                                                 ValueType value, RealType tol)
+{
+    auto bound = zero<RealType>();
+    for (int64 i = 0; i < m; i++) {
+        for (int64 j = 0; j < m; j++) {
+            bound += abs(coeffs(u + i, col)) * abs(gram(i * m + j, col)) *
+                     abs(coeffs(u + j, col));
+        }
+    }
+    return abs(value) <= m * tol * bound;
+}
+
+
+/**
+ * Computes g^T v for the coefficient vector stored in the rows [v, v + m) of
+ * the given column of coeffs, where g(j) = gram(m * m + j, col) contains the
+ * inner products of the shadow residual with the basis vectors.
+ */
+template <typename GramAccessor, typename CoeffAccessor>
+GKO_INLINE GKO_ATTRIBUTES auto shadow_dot(GramAccessor gram,
+                                          CoeffAccessor coeffs, int64 col,
+                                          int64 m, int64 v)
+{
+    using value_type = std::decay_t<decltype(coeffs(0, 0))>;
+    auto result = zero<value_type>();
+    for (int64 j = 0; j < m; j++) {
+        result += gram(m * m + j, col) * coeffs(v + j, col);
+    }
+    return result;
+}
+
+
+/**
+ * Stores the coordinates of the (preconditioned) system matrix applied to the
+ * coefficient vector in the rows [in, in + m) in the rows [out, out + m).
+ * The basis consists of two parts starting at 0 and split, in which every
+ * vector is the system matrix applied to its predecessor, so this only shifts
+ * the coefficients within both parts. The coefficients of the last vector of
+ * each part need to be zero.
+ */
+template <typename CoeffAccessor>
+GKO_INLINE GKO_ATTRIBUTES void shift(CoeffAccessor coeffs, int64 col, int64 m,
+                                     int64 split, int64 in, int64 out)
+{
+    using value_type = std::decay_t<decltype(coeffs(0, 0))>;
+    for (int64 i = 0; i < m; i++) {
+        coeffs(out + i, col) = i == 0 || i == split ? zero<value_type>()
+                                                    : coeffs(in + i - 1, col);
+    }
+}
+
+
+}  // anonymous namespace
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const DefaultExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                array<stopping_status>* stop_status)
+{
+    if (b->get_size()) {
+        run_kernel(
+            exec,
+            [] GKO_KERNEL(auto row, auto col, auto b, auto r, auto stop) {
+                if (row == 0) {
+                    stop[col].reset();
+                }
+                r(row, col) = b(row, col);
+            },
+            b->get_size(), b, r, *stop_status);
+    } else {
+        run_kernel(
+            exec, [] GKO_KERNEL(auto col, auto stop) { stop[col].reset(); },
+            b->get_size()[1], *stop_status);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void compute_gram(std::shared_ptr<const DefaultExecutor> exec,
+                  size_type num_rows, const matrix::Dense<ValueType>* left,
+                  const matrix::Dense<ValueType>* right,
+                  matrix::Dense<ValueType>* gram, array<char>& tmp)
+{
+    const auto num_rhs = static_cast<int64>(gram->get_size()[1]);
+    const auto num_right =
+        num_rows == 0 ? int64{}
+                      : static_cast<int64>(right->get_size()[0] / num_rows);
+    // every column of the reduction computes the inner product of one pair of
+    // left and right blocks for one right-hand side
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto entry, auto left, auto right,
+                      auto num_rows, auto num_right, auto num_rhs) {
+            const auto col = entry % num_rhs;
+            const auto block = entry / num_rhs;
+            const auto left_row = block / num_right * num_rows + row;
+            const auto right_row = block % num_right * num_rows + row;
+            return conj(left(left_row, col)) * right(right_row, col);
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), gram->get_values(),
+        dim<2>{num_rows, gram->get_size()[0] * gram->get_size()[1]}, tmp,
+        left, right, static_cast<int64>(num_rows), num_right, num_rhs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_COMPUTE_GRAM_KERNEL);
+
+
+template <typename ValueType>
+void cg_coefficients(std::shared_ptr<const DefaultExecutor> exec,
+                     size_type steps, const matrix::Dense<ValueType>* gram,
+                     matrix::Dense<ValueType>* coeffs,
+                     matrix::Dense<ValueType>* rho)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto col, auto gram, auto coeffs, auto rho, auto steps,
+                      auto tol) {
+            using value_type = std::decay_t<decltype(coeffs(0, 0))>;
+            const auto m = 2 * steps + 1;
+            // coordinates of x, p, r and A p
+            const auto cx = int64{};
+            const auto cp = m;
+            const auto cr = 2 * m;
+            const auto cw = 3 * m;
+            for (int64 i = 0; i < 4 * m; i++) {
+                coeffs(i, col) = zero<value_type>();
+            }
+            coeffs(cp, col) = one<value_type>();
+            coeffs(cr + steps + 1, col) = one<value_type>();
+            auto cur_rho = quadratic_form(gram, coeffs, col, m, cr, cr);
+            rho[col] = cur_rho;
+            for (int64 step = 0; step < steps; step++) {
+                shift(coeffs, col, m, steps + 1, cp, cw);
+                const auto alpha = safe_divide(
+                    cur_rho, quadratic_form(gram, coeffs, col, m, cp, cw));
+                for (int64 i = 0; i < m; i++) {
+                    coeffs(cx + i, col) += alpha * coeffs(cp + i, col);
+                    coeffs(cr + i, col) -= alpha * coeffs(cw + i, col);
+                }
+                const auto new_rho =
+                    quadratic_form(gram, coeffs, col, m, cr, cr);
+                if (is_rounding_error(gram, coeffs, col, m, cr, new_rho,
+                                      tol)) {
+                    // the remaining inner products are dominated by rounding
+                    // errors, so restart from the residual in the next basis
+                    for (int64 i = 0; i < m; i++) {
+                        coeffs(cp + i, col) = coeffs(cr + i, col);
+                    }
+                    break;
+                }
+                const auto beta = safe_divide(new_rho, cur_rho);
+                for (int64 i = 0; i < m; i++) {
+                    coeffs(cp + i, col) =
+                        coeffs(cr + i, col) + beta * coeffs(cp + i, col);
+                }
+                cur_rho = new_rho;
+            }
+        },
+        gram->get_size()[1], gram, coeffs, row_vector(rho),
+        static_cast<int64>(steps),
+        std::numeric_limits<remove_complex<ValueType>>::epsilon());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_CG_COEFFICIENTS_KERNEL);
+
+
+template <typename ValueType>
+void bicgstab_coefficients(std::shared_ptr<const DefaultExecutor> exec,
+                           size_type steps,
+                           const matrix::Dense<ValueType>* gram,
+                           matrix::Dense<ValueType>* coeffs)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto col, auto gram, auto coeffs, auto steps,
+                      auto tol) {
+            using value_type = std::decay_t<decltype(coeffs(0, 0))>;
+            const auto m = 4 * steps + 1;
+            const auto split = 2 * steps + 1;
+            // coordinates of x, p, r (and s), A p and A s
+            const auto cx = int64{};
+            const auto cp = m;
+            const auto cr = 2 * m;
+            const auto cv = 3 * m;
+            const auto ct = 4 * m;
+            for (int64 i = 0; i < 5 * m; i++) {
+                coeffs(i, col) = zero<value_type>();
+            }
+            coeffs(cp, col) = one<value_type>();
+            coeffs(cr + split, col) = one<value_type>();
+            auto rho = shadow_dot(gram, coeffs, col, m, cr);
+            for (int64 step = 0; step < steps; step++) {
+                shift(coeffs, col, m, split, cp, cv);
+                const auto alpha =
+                    safe_divide(rho, shadow_dot(gram, coeffs, col, m, cv));
+                // s = r - alpha * A p
+                for (int64 i = 0; i < m; i++) {
+                    coeffs(cr + i, col) -= alpha * coeffs(cv + i, col);
+                }
+                if (is_rounding_error(
+                        gram, coeffs, col, m, cr,
+                        quadratic_form(gram, coeffs, col, m, cr, cr), tol)) {
+                    // the remaining inner products are dominated by rounding
+                    // errors, so restart from the residual in the next basis
+                    for (int64 i = 0; i < m; i++) {
+                        coeffs(cx + i, col) += alpha * coeffs(cp + i, col);
+                        coeffs(cp + i, col) = coeffs(cr + i, col);
+                    }
+                    break;
+                }
+                shift(coeffs, col, m, split, cr, ct);
+                const auto omega =
+                    safe_divide(quadratic_form(gram, coeffs, col, m, ct, cr),
+                                quadratic_form(gram, coeffs, col, m, ct, ct));
+                for (int64 i = 0; i < m; i++) {
+                    coeffs(cx + i, col) += alpha * coeffs(cp + i, col) +
+                                           omega * coeffs(cr + i, col);
+                    coeffs(cr + i, col) -= omega * coeffs(ct + i, col);
+                }
+                if (is_rounding_error(
+                        gram, coeffs, col, m, cr,
+                        quadratic_form(gram, coeffs, col, m, cr, cr), tol)) {
+                    for (int64 i = 0; i < m; i++) {
+                        coeffs(cp + i, col) = coeffs(cr + i, col);
+                    }
+                    break;
+                }
+                const auto new_rho = shadow_dot(gram, coeffs, col, m, cr);
+                const auto beta = safe_divide(new_rho, rho) *
+                                  safe_divide(alpha, omega);
+                for (int64 i = 0; i < m; i++) {
+                    coeffs(cp + i, col) =
+                        coeffs(cr + i, col) +
+                        beta * (coeffs(cp + i, col) -
+                                omega * coeffs(cv + i, col));
+                }
+                rho = new_rho;
+            }
+        },
+        gram->get_size()[1], gram, coeffs, static_cast<int64>(steps),
+        std::numeric_limits<remove_complex<ValueType>>::epsilon());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_SSTEP_BICGSTAB_COEFFICIENTS_KERNEL);
+
+
+template <typename ValueType>
+void combine_basis(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_rows, const matrix::Dense<ValueType>* basis,
+                   const matrix::Dense<ValueType>* coeffs,
+                   matrix::Dense<ValueType>* result, bool accumulate,
+                   const array<stopping_status>* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto basis, auto coeffs, auto result,
+                      auto num_rows, auto num_vectors, auto accumulate,
+                      auto stop) {
+            if (stop[col].has_stopped()) {
+                return;
+            }
+            auto value = accumulate ? result(row, col) : zero(result(row, col));
+            for (int64 i = 0; i < num_vectors; i++) {
+                value += basis(i * num_rows + row, col) * coeffs(i, col);
+            }
+            result(row, col) = value;
+        },
+        result->get_size(), basis, coeffs, result,
+        static_cast<int64>(num_rows), static_cast<int64>(coeffs->get_size()[0]),
+        accumulate, *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_COMBINE_BASIS_KERNEL);
+
+
+}  // namespace sstep
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
@@ -46,6 +46,13 @@ namespace kernels {
                         array<IndexType>& row_idxs,                     \
                         array<IndexType>& col_idxs)
 
+#define GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_AND_SUM_DUPLICATES_KERNEL( \
+    ValueType, IndexType)                                              \
+    void sort_and_sum_duplicates(                                      \
+        std::shared_ptr<const DefaultExecutor> exec, size_type num_rows, \
+        array<ValueType>& values, array<IndexType>& row_idxs,          \
+        array<IndexType>& col_idxs)
+
 #define GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL(ValueType, \
                                                              IndexType) \
     void sort_row_major(std::shared_ptr<const DefaultExecutor> exec,    \
@@ -63,6 +70,9 @@ namespace kernels {
     GKO_DECLARE_DEVICE_MATRIX_DATA_SUM_DUPLICATES_KERNEL(ValueType,           \
                                                          IndexType);          \
     template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_AND_SUM_DUPLICATES_KERNEL(ValueType,  \
+                                                                  IndexType); \
+    template <typename ValueType, typename IndexType>                         \
     GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL(ValueType, IndexType)
 
 
@@ -6,8 +6,10 @@
 
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <cstring>
+#include <fstream>
 #include <limits>
 #include <map>
 #include <regex>
@@ -15,9 +17,19 @@
 #include <type_traits>
 
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 
 
 namespace gko {
@@ -932,6 +944,268 @@ void write_binary_raw(std::ostream& os,
 }
 
 
+/**
+ * Returns the magic number at the beginning of the binary CSR format header for
+ * the given type parameters.
+ *
+ * @tparam ValueType  the value type to be used for the binary storage
+ * @tparam IndexType  the index type to be used for the binary storage
+ */
+template <typename ValueType, typename IndexType>
+static constexpr uint64 binary_csr_format_magic()
+{
+    // keep the type bytes of the matrix_data format, but replace GINKGO
+    constexpr uint64 type_mask = uint64{0xFFFF} << 48;
+    constexpr uint64 shift = 256;
+    return (binary_format_magic<ValueType, IndexType>() & type_mask) +
+           ('G' +
+            shift *
+                ('K' +
+                 shift * ('O' + shift * ('C' + shift * ('S' + shift * 'R')))));
+}
+
+
+namespace {
+
+
+constexpr size_type binary_csr_alignment = 16;
+
+
+/**
+ * Returns the byte offsets of the row pointer, column index and value arrays
+ * inside the binary CSR format, followed by the total size of the data.
+ *
+ * @throw StreamError  if the sizes overflow the addressable range
+ */
+template <typename ValueType, typename IndexType>
+std::array<size_type, 4> binary_csr_layout(uint64 num_rows,
+                                           uint64 num_entries)
+{
+    constexpr auto max_size = std::numeric_limits<size_type>::max();
+    // returns offset + count * element_size, rounded up to the alignment
+    const auto append = [](size_type offset, uint64 count,
+                           size_type element_size, bool align) {
+        const auto padding = align ? binary_csr_alignment - 1 : 0;
+        if (count > (max_size - offset - padding) / element_size) {
+            throw GKO_STREAM_ERROR(
+                "the matrix sizes overflow the binary CSR layout");
+        }
+        const auto end = offset + count * element_size;
+        return align ? (end + padding) / binary_csr_alignment *
+                           binary_csr_alignment
+                     : end;
+    };
+    std::array<size_type, 4> offsets{};
+    offsets[0] = 32;
+    // num_rows is at most the largest IndexType, so num_rows + 1 can't wrap
+    offsets[1] = append(offsets[0], num_rows + 1, sizeof(IndexType), true);
+    offsets[2] = append(offsets[1], num_entries, sizeof(IndexType), true);
+    offsets[3] = append(offsets[2], num_entries, sizeof(ValueType), false);
+    return offsets;
+}
+
+
+/**
+ * Parses the 32 byte header of the binary CSR format and returns the number
+ * of rows, columns and stored entries.
+ */
+template <typename ValueType, typename IndexType>
+std::array<uint64, 3> read_binary_csr_header(const char* header)
+{
+    static_assert(sizeof(uint64) == 8, "c++ is broken");  // just to be sure
+    uint64 magic{};
+    std::array<uint64, 3> sizes{};
+    std::memcpy(&magic, header, 8);
+    std::memcpy(sizes.data(), header + 8, 24);
+    if (magic != binary_csr_format_magic<ValueType, IndexType>()) {
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(header, 8) +
+                               "' for this value and index type");
+    }
+    for (auto size : sizes) {
+        if (size > static_cast<uint64>(std::numeric_limits<IndexType>::max())) {
+            throw GKO_STREAM_ERROR(
+                "cannot read into this format, its index type would overflow");
+        }
+    }
+    return sizes;
+}
+
+
+/**
+ * Checks that the row pointers of the binary CSR format are sorted and
+ * consistent with the number of stored entries, and that all column indices
+ * are inside the matrix, so the resulting Csr matrix can be used safely.
+ */
+template <typename IndexType>
+void check_binary_csr_data(const IndexType* row_ptrs,
+                           const IndexType* col_idxs, uint64 num_rows,
+                           uint64 num_cols, uint64 num_entries)
+{
+    if (row_ptrs[0] != 0 ||
+        static_cast<uint64>(row_ptrs[num_rows]) != num_entries) {
+        throw GKO_STREAM_ERROR("inconsistent row pointers");
+    }
+    for (uint64 row = 0; row < num_rows; row++) {
+        if (row_ptrs[row] > row_ptrs[row + 1]) {
+            throw GKO_STREAM_ERROR("decreasing row pointers in row " +
+                                   std::to_string(row));
+        }
+    }
+    for (uint64 nz = 0; nz < num_entries; nz++) {
+        if (col_idxs[nz] < 0 ||
+            static_cast<uint64>(col_idxs[nz]) >= num_cols) {
+            throw GKO_STREAM_ERROR("column index out of bounds in entry " +
+                                   std::to_string(nz));
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* mtx)
+{
+    auto host_mtx =
+        make_temporary_clone(mtx->get_executor()->get_master(), mtx);
+    uint64 magic = binary_csr_format_magic<ValueType, IndexType>();
+    uint64 num_rows = host_mtx->get_size()[0];
+    uint64 num_cols = host_mtx->get_size()[1];
+    uint64 num_entries = host_mtx->get_num_stored_elements();
+    std::array<char, 32> header{};
+    std::memcpy(&header[0], &magic, 8);
+    std::memcpy(&header[8], &num_rows, 8);
+    std::memcpy(&header[16], &num_cols, 8);
+    std::memcpy(&header[24], &num_entries, 8);
+    GKO_CHECK_STREAM(os.write(header.data(), 32), "failed writing header");
+    const auto offsets =
+        binary_csr_layout<ValueType, IndexType>(num_rows, num_entries);
+    const std::array<const char*, 3> arrays{
+        reinterpret_cast<const char*>(host_mtx->get_const_row_ptrs()),
+        reinterpret_cast<const char*>(host_mtx->get_const_col_idxs()),
+        reinterpret_cast<const char*>(host_mtx->get_const_values())};
+    const std::array<size_type, 3> array_sizes{
+        (num_rows + 1) * sizeof(IndexType), num_entries * sizeof(IndexType),
+        num_entries * sizeof(ValueType)};
+    const std::array<char, binary_csr_alignment> padding{};
+    for (int i = 0; i < 3; i++) {
+        GKO_CHECK_STREAM(os.write(arrays[i], array_sizes[i]),
+                         "failed writing array " + std::to_string(i));
+        if (i < 2) {
+            GKO_CHECK_STREAM(
+                os.write(padding.data(),
+                         offsets[i + 1] - offsets[i] - array_sizes[i]),
+                "failed writing padding");
+        }
+    }
+    os.flush();
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, std::istream& is)
+{
+    std::array<char, 32> header{};
+    GKO_CHECK_STREAM(is.read(header.data(), 32), "failed reading header");
+    const auto sizes =
+        read_binary_csr_header<ValueType, IndexType>(header.data());
+    const auto num_rows = sizes[0];
+    const auto num_entries = sizes[2];
+    const auto offsets =
+        binary_csr_layout<ValueType, IndexType>(num_rows, num_entries);
+    auto host_exec = exec->get_master();
+    array<IndexType> row_ptrs{host_exec, num_rows + 1};
+    array<IndexType> col_idxs{host_exec, num_entries};
+    array<ValueType> values{host_exec, num_entries};
+    const std::array<char*, 3> arrays{
+        reinterpret_cast<char*>(row_ptrs.get_data()),
+        reinterpret_cast<char*>(col_idxs.get_data()),
+        reinterpret_cast<char*>(values.get_data())};
+    const std::array<size_type, 3> array_sizes{
+        (num_rows + 1) * sizeof(IndexType), num_entries * sizeof(IndexType),
+        num_entries * sizeof(ValueType)};
+    for (int i = 0; i < 3; i++) {
+        GKO_CHECK_STREAM(is.read(arrays[i], array_sizes[i]),
+                         "failed reading array " + std::to_string(i));
+        if (i < 2) {
+            GKO_CHECK_STREAM(
+                is.ignore(offsets[i + 1] - offsets[i] - array_sizes[i]),
+                "failed reading padding");
+        }
+    }
+    check_binary_csr_data(row_ptrs.get_const_data(), col_idxs.get_const_data(),
+                          num_rows, sizes[1], num_entries);
+    return matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{num_rows, sizes[1]}, std::move(values),
+        std::move(col_idxs), std::move(row_ptrs));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, const std::string& filename)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const auto fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw GKO_STREAM_ERROR("failed opening file '" + filename + "'");
+    }
+    struct stat file_stat {};
+    if (::fstat(fd, &file_stat) != 0 || file_stat.st_size < 32) {
+        ::close(fd);
+        throw GKO_STREAM_ERROR("failed reading header");
+    }
+    const auto file_size = static_cast<size_type>(file_stat.st_size);
+    // a private mapping allows modifying the matrix without touching the file
+    auto mapped = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after closing the file descriptor
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        throw GKO_STREAM_ERROR("failed mapping file '" + filename + "'");
+    }
+    std::shared_ptr<char> mapping{
+        static_cast<char*>(mapped),
+        [file_size](char* ptr) { ::munmap(ptr, file_size); }};
+    const auto sizes =
+        read_binary_csr_header<ValueType, IndexType>(mapping.get());
+    const auto num_rows = sizes[0];
+    const auto num_entries = sizes[2];
+    const auto offsets =
+        binary_csr_layout<ValueType, IndexType>(num_rows, num_entries);
+    if (file_size < offsets[3]) {
+        throw GKO_STREAM_ERROR("file '" + filename + "' is truncated");
+    }
+    const auto data = mapping.get();
+    auto row_ptrs_data = reinterpret_cast<IndexType*>(data + offsets[0]);
+    auto col_idxs_data = reinterpret_cast<IndexType*>(data + offsets[1]);
+    auto values_data = reinterpret_cast<ValueType*>(data + offsets[2]);
+    check_binary_csr_data(row_ptrs_data, col_idxs_data, num_rows, sizes[1],
+                          num_entries);
+    // the arrays keep the mapping alive for as long as they use it. On host
+    // executors, they are moved into the matrix, otherwise they are copied.
+    const auto keep_mapping = [mapping](auto) {};
+    auto host_exec = exec->get_master();
+    array<IndexType> row_ptrs{host_exec, num_rows + 1, row_ptrs_data,
+                              keep_mapping};
+    array<IndexType> col_idxs{host_exec, num_entries, col_idxs_data,
+                              keep_mapping};
+    array<ValueType> values{host_exec, num_entries, values_data, keep_mapping};
+    return matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{num_rows, sizes[1]}, std::move(values),
+        std::move(col_idxs), std::move(row_ptrs));
+#else
+    std::ifstream is{filename, std::ios::binary};
+    GKO_CHECK_STREAM(is, "failed opening file '" + filename + "'");
+    return read_binary_csr<ValueType, IndexType>(std::move(exec), is);
+#endif
+}
+
+
 /**
  * Writes raw data to the stream.
  *
@@ -965,11 +1239,24 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
                           const matrix_data<ValueType, IndexType>& data)
 #define GKO_DECLARE_READ_GENERIC_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
+#define GKO_DECLARE_WRITE_BINARY_CSR(ValueType, IndexType) \
+    void write_binary_csr(std::ostream& os,                \
+                          const matrix::Csr<ValueType, IndexType>* mtx)
+#define GKO_DECLARE_READ_BINARY_CSR_STREAM(ValueType, IndexType)        \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr( \
+        std::shared_ptr<const Executor> exec, std::istream& is)
+#define GKO_DECLARE_READ_BINARY_CSR_FILE(ValueType, IndexType)          \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr( \
+        std::shared_ptr<const Executor> exec, const std::string& filename)
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_GENERIC_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_CSR);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_READ_BINARY_CSR_STREAM);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_CSR_FILE);
 
 
 }  // namespace gko
@@ -34,6 +34,7 @@
 #include "core/matrix/batch_ell_kernels.hpp"
 #include "core/matrix/coo_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/delta_csr_kernels.hpp"
 #include "core/matrix/dense_kernels.hpp"
 #include "core/matrix/diagonal_kernels.hpp"
 #include "core/matrix/ell_kernels.hpp"
@@ -47,6 +48,8 @@
 #include "core/multigrid/pgm_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
+#include "core/reorder/amd_kernels.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
 #include "core/reorder/rcm_kernels.hpp"
 #include "core/solver/batch_bicgstab_kernels.hpp"
 #include "core/solver/bicg_kernels.hpp"
@@ -62,6 +65,8 @@
 #include "core/solver/ir_kernels.hpp"
 #include "core/solver/lower_trs_kernels.hpp"
 #include "core/solver/multigrid_kernels.hpp"
+#include "core/solver/pipe_cg_kernels.hpp"
+#include "core/solver/sstep_kernels.hpp"
 #include "core/solver/upper_trs_kernels.hpp"
 #include "core/stop/criterion_kernels.hpp"
 #include "core/stop/residual_norm_kernels.hpp"
@@ -188,6 +193,8 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_REMOVE_ZEROS_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SUM_DUPLICATES_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_AND_SUM_DUPLICATES_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DEVICE_MATRIX_DATA_AOS_TO_SOA_KERNEL);
@@ -420,11 +427,38 @@ namespace cg {
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_INITIALIZE_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_1_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_GATHER_COLUMNS_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_SCATTER_COLUMNS_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_BLOCK_CONJ_DOT_KERNEL);
 
 
 }  // namespace cg
 
 
+namespace pipe_cg {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_COMPUTE_DOTS_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_KERNEL);
+
+
+}  // namespace pipe_cg
+
+
+namespace sstep {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_SSTEP_INITIALIZE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_SSTEP_COMPUTE_GRAM_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_SSTEP_CG_COEFFICIENTS_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_SSTEP_BICGSTAB_COEFFICIENTS_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_SSTEP_COMBINE_BASIS_KERNEL);
+
+
+}  // namespace sstep
+
+
 namespace bicg {
 
 
@@ -532,6 +566,8 @@ namespace gmres {
 
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_RESTART_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_SUB_KERNEL);
 
 
 }  // namespace gmres
@@ -569,6 +605,19 @@ GKO_STUB_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_MULTIGRID_KCYCLE_CHECK_STOP_KERNEL);
 }  // namespace multigrid
 
 
+namespace delta_csr {
+
+
+GKO_STUB_MIXED_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+GKO_STUB_MIXED_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_COMPUTE_COMPRESSED_SIZES_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_COMPRESS_IDXS_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_DECOMPRESS_IDXS_KERNEL);
+
+
+}  // namespace delta_csr
+
+
 namespace sparsity_csr {
 
 
@@ -596,6 +645,7 @@ GKO_STUB_MIXED_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPMV_KERNEL);
 GKO_STUB_MIXED_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ADVANCED_SPMV_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_SPGEAM_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_FILL_IN_DENSE_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_CONVERT_TO_ELL_KERNEL);
@@ -898,6 +948,24 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
 }  // namespace par_ilut_factorization
 
 
+namespace amd {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_AMD_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+
+
+namespace nested_dissection {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_NESTED_DISSECTION_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+
+
 namespace rcm {
 
 
@@ -922,6 +990,8 @@ GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
 GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
+GKO_STUB_LOCAL_GLOBAL_TYPE(GKO_DECLARE_PGM_MAP_TO_GLOBAL);
+GKO_STUB_LOCAL_GLOBAL_TYPE(GKO_DECLARE_PGM_GATHER_INDEX);
 
 
 }  // namespace pgm
@@ -140,6 +140,45 @@ void vector_dispatch(T* linop, F&& f, Args&&... args)
 }
 
 
+/**
+ * Sums up the rank-local partial results of a reduction over all ranks that
+ * share the given vector. For non-distributed vectors, this is a no-op.
+ *
+ * @param vec  the (possibly distributed) vector the reduction was computed on
+ * @param result  the contiguous local partial results, which get overwritten
+ *                by the global results
+ */
+template <typename ValueType>
+void all_reduce_sum(const matrix::Dense<ValueType>* vec,
+                    matrix::Dense<ValueType>* result)
+{}
+
+
+#if GINKGO_BUILD_MPI
+
+
+template <typename ValueType>
+void all_reduce_sum(const experimental::distributed::Vector<ValueType>* vec,
+                    matrix::Dense<ValueType>* result)
+{
+    auto exec = result->get_executor();
+    const auto comm = vec->get_communicator();
+    const auto size = static_cast<int>(result->get_num_stored_elements());
+    exec->synchronize();
+    if (experimental::mpi::requires_host_buffer(exec, comm)) {
+        auto host_result = clone(exec->get_master(), result);
+        comm.all_reduce(exec->get_master(), host_result->get_values(), size,
+                        MPI_SUM);
+        result->copy_from(host_result);
+    } else {
+        comm.all_reduce(exec, result->get_values(), size, MPI_SUM);
+    }
+}
+
+
+#endif
+
+
 /**
  * Helper to extract a submatrix.
  *
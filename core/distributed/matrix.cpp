@@ -5,6 +5,9 @@
 #include <ginkgo/core/distributed/matrix.hpp>
 
 
+#include <algorithm>
+
+
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
@@ -51,6 +54,7 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::Matrix(
       recv_sizes_(comm.size()),
       gather_idxs_{exec},
       non_local_to_global_{exec},
+      comm_mode_{communication_mode::all_to_all},
       one_scalar_{},
       local_mtx_{local_matrix_template->clone(exec)},
       non_local_mtx_{non_local_matrix_template->clone(exec)}
@@ -111,7 +115,17 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::convert_to(
     result->recv_offsets_ = this->recv_offsets_;
     result->recv_sizes_ = this->recv_sizes_;
     result->send_sizes_ = this->send_sizes_;
+    result->neighbor_sources_ = this->neighbor_sources_;
+    result->neighbor_destinations_ = this->neighbor_destinations_;
+    result->neighbor_send_offsets_ = this->neighbor_send_offsets_;
+    result->neighbor_send_sizes_ = this->neighbor_send_sizes_;
+    result->neighbor_recv_offsets_ = this->neighbor_recv_offsets_;
+    result->neighbor_recv_sizes_ = this->neighbor_recv_sizes_;
     result->non_local_to_global_ = this->non_local_to_global_;
+    result->comm_mode_ = this->comm_mode_;
+    result->neighbor_comm_.reset();
+    result->boundary_blocks_.clear();
+    result->boundary_scatter_.reset();
     result->set_size(this->get_size());
 }
 
@@ -130,7 +144,20 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::move_to(
     result->recv_offsets_ = std::move(this->recv_offsets_);
     result->recv_sizes_ = std::move(this->recv_sizes_);
     result->send_sizes_ = std::move(this->send_sizes_);
+    result->neighbor_sources_ = std::move(this->neighbor_sources_);
+    result->neighbor_destinations_ = std::move(this->neighbor_destinations_);
+    result->neighbor_send_offsets_ = std::move(this->neighbor_send_offsets_);
+    result->neighbor_send_sizes_ = std::move(this->neighbor_send_sizes_);
+    result->neighbor_recv_offsets_ = std::move(this->neighbor_recv_offsets_);
+    result->neighbor_recv_sizes_ = std::move(this->neighbor_recv_sizes_);
     result->non_local_to_global_ = std::move(this->non_local_to_global_);
+    result->comm_mode_ = this->comm_mode_;
+    result->neighbor_comm_.reset();
+    result->boundary_blocks_.clear();
+    result->boundary_scatter_.reset();
+    this->neighbor_comm_.reset();
+    this->boundary_blocks_.clear();
+    this->boundary_scatter_.reset();
     result->set_size(this->get_size());
     this->set_size({});
 }
@@ -221,6 +248,12 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     if (use_host_buffer) {
         gather_idxs_.set_executor(exec);
     }
+    this->build_neighbor_lists();
+    // the neighborhood and boundary blocks are built on demand, since the
+    // communication mode can still change after reading the matrix
+    neighbor_comm_.reset();
+    boundary_blocks_.clear();
+    boundary_scatter_.reset();
 }
 
 
@@ -260,6 +293,53 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
 }
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::set_communication_mode(
+    communication_mode mode)
+{
+    comm_mode_ = mode;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::build_neighbor_lists()
+{
+    const auto comm = this->get_communicator();
+    neighbor_sources_.clear();
+    neighbor_destinations_.clear();
+    neighbor_send_sizes_.clear();
+    neighbor_send_offsets_.clear();
+    neighbor_recv_sizes_.clear();
+    neighbor_recv_offsets_.clear();
+    for (comm_index_type rank = 0; rank < comm.size(); rank++) {
+        if (recv_sizes_[rank] > 0) {
+            neighbor_sources_.push_back(rank);
+            neighbor_recv_sizes_.push_back(recv_sizes_[rank]);
+            neighbor_recv_offsets_.push_back(recv_offsets_[rank]);
+        }
+        if (send_sizes_[rank] > 0) {
+            neighbor_destinations_.push_back(rank);
+            neighbor_send_sizes_.push_back(send_sizes_[rank]);
+            neighbor_send_offsets_.push_back(send_offsets_[rank]);
+        }
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::build_neighborhood()
+    const
+{
+    const auto comm = this->get_communicator();
+    neighbor_comm_ =
+        std::make_shared<mpi::communicator>(comm.create_dist_graph_adjacent(
+            static_cast<int>(neighbor_sources_.size()),
+            neighbor_sources_.data(),
+            static_cast<int>(neighbor_destinations_.size()),
+            neighbor_destinations_.data()));
+}
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
     const local_vector_type* local_b) const
@@ -289,6 +369,25 @@ mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
     auto recv_ptr = use_host_buffer ? host_recv_buffer_->get_values()
                                     : recv_buffer_->get_values();
     exec->synchronize();
+    if (comm_mode_ == communication_mode::neighborhood) {
+        if (!neighbor_comm_) {
+            this->build_neighborhood();
+        }
+#ifdef GINKGO_FORCE_SPMV_BLOCKING_COMM
+        neighbor_comm_->neighbor_all_to_all_v(
+            use_host_buffer ? exec->get_master() : exec, send_ptr,
+            neighbor_send_sizes_.data(), neighbor_send_offsets_.data(),
+            type.get(), recv_ptr, neighbor_recv_sizes_.data(),
+            neighbor_recv_offsets_.data(), type.get());
+        return {};
+#else
+        return neighbor_comm_->i_neighbor_all_to_all_v(
+            use_host_buffer ? exec->get_master() : exec, send_ptr,
+            neighbor_send_sizes_.data(), neighbor_send_offsets_.data(),
+            type.get(), recv_ptr, neighbor_recv_sizes_.data(),
+            neighbor_recv_offsets_.data(), type.get());
+#endif
+    }
 #ifdef GINKGO_FORCE_SPMV_BLOCKING_COMM
     comm.all_to_all_v(use_host_buffer ? exec->get_master() : exec, send_ptr,
                       send_sizes_.data(), send_offsets_.data(), type.get(),
@@ -304,6 +403,159 @@ mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
 }
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate_pipelined(
+    const local_vector_type* local_b, std::vector<mpi::request>& recv_reqs,
+    std::vector<mpi::request>& send_reqs) const
+{
+    auto exec = this->get_executor();
+    const auto comm = this->get_communicator();
+    auto num_cols = local_b->get_size()[1];
+    auto send_size = send_offsets_.back();
+    auto recv_size = recv_offsets_.back();
+    auto send_dim = dim<2>{static_cast<size_type>(send_size), num_cols};
+    auto recv_dim = dim<2>{static_cast<size_type>(recv_size), num_cols};
+    recv_buffer_.init(exec, recv_dim);
+    send_buffer_.init(exec, send_dim);
+
+    local_b->row_gather(&gather_idxs_, send_buffer_.get());
+
+    auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
+    if (use_host_buffer) {
+        host_recv_buffer_.init(exec->get_master(), recv_dim);
+        host_send_buffer_.init(exec->get_master(), send_dim);
+        host_send_buffer_->copy_from(send_buffer_.get());
+    }
+
+    auto comm_exec = use_host_buffer ? exec->get_master() : exec;
+    auto send_ptr = use_host_buffer ? host_send_buffer_->get_const_values()
+                                    : send_buffer_->get_const_values();
+    auto recv_ptr = use_host_buffer ? host_recv_buffer_->get_values()
+                                    : recv_buffer_->get_values();
+    exec->synchronize();
+    recv_reqs.clear();
+    send_reqs.clear();
+    // post all receives first, so the messages don't need to be buffered
+    for (size_type i = 0; i < neighbor_sources_.size(); i++) {
+        recv_reqs.push_back(comm.i_recv(
+            comm_exec, recv_ptr + neighbor_recv_offsets_[i] * num_cols,
+            static_cast<int>(neighbor_recv_sizes_[i] * num_cols),
+            neighbor_sources_[i], 0));
+    }
+    for (size_type i = 0; i < neighbor_destinations_.size(); i++) {
+        send_reqs.push_back(comm.i_send(
+            comm_exec, send_ptr + neighbor_send_offsets_[i] * num_cols,
+            static_cast<int>(neighbor_send_sizes_[i] * num_cols),
+            neighbor_destinations_[i], 0));
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::build_boundary_blocks(
+    const gko::matrix::Csr<value_type, local_index_type>* non_local) const
+{
+    using csr_type = gko::matrix::Csr<value_type, local_index_type>;
+    using mat_data = matrix_data<value_type, local_index_type>;
+    auto exec = this->get_executor();
+    auto host_non_local = make_temporary_clone(exec->get_master(), non_local);
+    const auto num_rows = host_non_local->get_size()[0];
+    const auto row_ptrs = host_non_local->get_const_row_ptrs();
+    const auto col_idxs = host_non_local->get_const_col_idxs();
+    const auto values = host_non_local->get_const_values();
+    // the non-local columns are ordered by the rank that owns them, so every
+    // neighbor's block is a contiguous column range
+    std::vector<size_type> col_to_source(host_non_local->get_size()[1]);
+    std::vector<mat_data> block_data;
+    for (size_type i = 0; i < neighbor_sources_.size(); i++) {
+        std::fill_n(col_to_source.begin() + neighbor_recv_offsets_[i],
+                    neighbor_recv_sizes_[i], i);
+        block_data.emplace_back(
+            dim<2>{0, static_cast<size_type>(neighbor_recv_sizes_[i])});
+    }
+    mat_data scatter_data;
+    size_type num_boundary_rows{};
+    for (size_type row = 0; row < num_rows; row++) {
+        if (row_ptrs[row] == row_ptrs[row + 1]) {
+            continue;
+        }
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto source = col_to_source[col_idxs[nz]];
+            block_data[source].nonzeros.emplace_back(
+                num_boundary_rows,
+                col_idxs[nz] - neighbor_recv_offsets_[source], values[nz]);
+        }
+        scatter_data.nonzeros.emplace_back(row, num_boundary_rows,
+                                           one<value_type>());
+        num_boundary_rows++;
+    }
+    boundary_blocks_.clear();
+    for (auto& data : block_data) {
+        data.size[0] = num_boundary_rows;
+        data.sort_row_major();
+        auto block = csr_type::create(exec);
+        block->read(data);
+        boundary_blocks_.emplace_back(std::move(block));
+    }
+    scatter_data.size = dim<2>{num_rows, num_boundary_rows};
+    auto scatter = csr_type::create(exec);
+    scatter->read(scatter_data);
+    boundary_scatter_ = std::move(scatter);
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::
+    apply_non_local_pipelined(const local_vector_type* alpha,
+                              std::vector<mpi::request>& recv_reqs,
+                              std::vector<mpi::request>& send_reqs,
+                              local_vector_type* local_x) const
+{
+    auto exec = this->get_executor();
+    const auto comm = this->get_communicator();
+    auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
+    auto non_local =
+        dynamic_cast<const gko::matrix::Csr<value_type, local_index_type>*>(
+            non_local_mtx_.get());
+    if (!non_local) {
+        mpi::wait_all(recv_reqs);
+        if (use_host_buffer) {
+            recv_buffer_->copy_from(host_recv_buffer_.get());
+        }
+        non_local_mtx_->apply(alpha, recv_buffer_.get(), one_scalar_.get(),
+                              local_x);
+        mpi::wait_all(send_reqs);
+        return;
+    }
+    if (!boundary_scatter_) {
+        this->build_boundary_blocks(non_local);
+    }
+    const auto num_cols = local_x->get_size()[1];
+    const span cols{0, num_cols};
+    boundary_buffer_.init(
+        exec, dim<2>{boundary_scatter_->get_size()[1], num_cols});
+    boundary_buffer_->fill(zero<value_type>());
+    for (size_type i = 0; i < neighbor_sources_.size(); i++) {
+        const auto source = mpi::wait_any(recv_reqs);
+        const auto begin =
+            static_cast<size_type>(neighbor_recv_offsets_[source]);
+        const span rows{begin, begin + neighbor_recv_sizes_[source]};
+        auto recv_view = recv_buffer_->create_submatrix(rows, cols);
+        if (use_host_buffer) {
+            auto host_recv_view =
+                host_recv_buffer_->create_submatrix(rows, cols);
+            recv_view->copy_from(host_recv_view.get());
+        }
+        boundary_blocks_[source]->apply(one_scalar_.get(), recv_view,
+                                        one_scalar_.get(),
+                                        boundary_buffer_.get());
+    }
+    boundary_scatter_->apply(alpha, boundary_buffer_.get(), one_scalar_.get(),
+                             local_x);
+    mpi::wait_all(send_reqs);
+}
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
     const LinOp* b, LinOp* x) const
@@ -319,6 +571,17 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
                     dense_x->get_local_values()),
                 dense_x->get_local_vector()->get_stride());
 
+            if (comm_mode_ == communication_mode::pipelined) {
+                std::vector<mpi::request> recv_reqs;
+                std::vector<mpi::request> send_reqs;
+                this->communicate_pipelined(dense_b->get_local_vector(),
+                                            recv_reqs, send_reqs);
+                local_mtx_->apply(dense_b->get_local_vector(), local_x);
+                this->apply_non_local_pipelined(one_scalar_.get(), recv_reqs,
+                                                send_reqs, local_x.get());
+                return;
+            }
+
             auto comm = this->get_communicator();
             auto req = this->communicate(dense_b->get_local_vector());
             local_mtx_->apply(dense_b->get_local_vector(), local_x);
@@ -352,6 +615,18 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
                     dense_x->get_local_values()),
                 dense_x->get_local_vector()->get_stride());
 
+            if (comm_mode_ == communication_mode::pipelined) {
+                std::vector<mpi::request> recv_reqs;
+                std::vector<mpi::request> send_reqs;
+                this->communicate_pipelined(dense_b->get_local_vector(),
+                                            recv_reqs, send_reqs);
+                local_mtx_->apply(local_alpha, dense_b->get_local_vector(),
+                                  local_beta, local_x);
+                this->apply_non_local_pipelined(local_alpha, recv_reqs,
+                                                send_reqs, local_x.get());
+                return;
+            }
+
             auto comm = this->get_communicator();
             auto req = this->communicate(dense_b->get_local_vector());
             local_mtx_->apply(local_alpha, dense_b->get_local_vector(),
@@ -407,7 +682,17 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(
         recv_offsets_ = other.recv_offsets_;
         send_sizes_ = other.send_sizes_;
         recv_sizes_ = other.recv_sizes_;
+        neighbor_sources_ = other.neighbor_sources_;
+        neighbor_destinations_ = other.neighbor_destinations_;
+        neighbor_send_offsets_ = other.neighbor_send_offsets_;
+        neighbor_send_sizes_ = other.neighbor_send_sizes_;
+        neighbor_recv_offsets_ = other.neighbor_recv_offsets_;
+        neighbor_recv_sizes_ = other.neighbor_recv_sizes_;
         non_local_to_global_ = other.non_local_to_global_;
+        comm_mode_ = other.comm_mode_;
+        neighbor_comm_.reset();
+        boundary_blocks_.clear();
+        boundary_scatter_.reset();
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
@@ -431,7 +716,20 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(Matrix&& other)
         recv_offsets_ = std::move(other.recv_offsets_);
         send_sizes_ = std::move(other.send_sizes_);
         recv_sizes_ = std::move(other.recv_sizes_);
+        neighbor_sources_ = std::move(other.neighbor_sources_);
+        neighbor_destinations_ = std::move(other.neighbor_destinations_);
+        neighbor_send_offsets_ = std::move(other.neighbor_send_offsets_);
+        neighbor_send_sizes_ = std::move(other.neighbor_send_sizes_);
+        neighbor_recv_offsets_ = std::move(other.neighbor_recv_offsets_);
+        neighbor_recv_sizes_ = std::move(other.neighbor_recv_sizes_);
         non_local_to_global_ = std::move(other.non_local_to_global_);
+        comm_mode_ = other.comm_mode_;
+        neighbor_comm_.reset();
+        other.neighbor_comm_.reset();
+        boundary_blocks_.clear();
+        other.boundary_blocks_.clear();
+        boundary_scatter_.reset();
+        other.boundary_scatter_.reset();
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
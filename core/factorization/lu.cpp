@@ -129,7 +129,8 @@ std::unique_ptr<LinOp> Lu<ValueType, IndexType>::generate_impl(
     exec->run(make_factorize(storage_offsets.get_const_data(),
                              row_descs.get_const_data(),
                              storage.get_const_data(),
-                             diag_idxs.get_const_data(), factors.get(), tmp));
+                             diag_idxs.get_const_data(), factors.get(),
+                             parameters_.numeric_algorithm, tmp));
     return factorization_type::create_from_combined_lu(std::move(factors));
 }
 
@@ -13,6 +13,7 @@
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/delta_csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/ell.hpp>
 #include <ginkgo/core/matrix/fbcsr.hpp>
@@ -30,6 +31,7 @@
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/delta_csr_kernels.hpp"
 #include "core/matrix/ell_kernels.hpp"
 #include "core/matrix/hybrid_kernels.hpp"
 #include "core/matrix/permutation.hpp"
@@ -46,6 +48,7 @@ GKO_REGISTER_OPERATION(spmv, csr::spmv);
 GKO_REGISTER_OPERATION(advanced_spmv, csr::advanced_spmv);
 GKO_REGISTER_OPERATION(spgemm, csr::spgemm);
 GKO_REGISTER_OPERATION(advanced_spgemm, csr::advanced_spgemm);
+GKO_REGISTER_OPERATION(spgemm_numeric, csr::spgemm_numeric);
 GKO_REGISTER_OPERATION(spgeam, csr::spgeam);
 GKO_REGISTER_OPERATION(convert_idxs_to_ptrs, components::convert_idxs_to_ptrs);
 GKO_REGISTER_OPERATION(convert_ptrs_to_idxs, components::convert_ptrs_to_idxs);
@@ -58,6 +61,9 @@ GKO_REGISTER_OPERATION(convert_to_fbcsr, csr::convert_to_fbcsr);
 GKO_REGISTER_OPERATION(compute_hybrid_coo_row_ptrs,
                        hybrid::compute_coo_row_ptrs);
 GKO_REGISTER_OPERATION(convert_to_hybrid, csr::convert_to_hybrid);
+GKO_REGISTER_OPERATION(compute_compressed_sizes,
+                       delta_csr::compute_compressed_sizes);
+GKO_REGISTER_OPERATION(compress_idxs, delta_csr::compress_idxs);
 GKO_REGISTER_OPERATION(calculate_nonzeros_per_row_in_span,
                        csr::calculate_nonzeros_per_row_in_span);
 GKO_REGISTER_OPERATION(calculate_nonzeros_per_row_in_index_set,
@@ -97,6 +103,8 @@ GKO_REGISTER_OPERATION(add_scaled_identity, csr::add_scaled_identity);
 GKO_REGISTER_OPERATION(check_diagonal_entries,
                        csr::check_diagonal_entries_exist);
 GKO_REGISTER_OPERATION(aos_to_soa, components::aos_to_soa);
+GKO_REGISTER_OPERATION(build_lookup_offsets, csr::build_lookup_offsets);
+GKO_REGISTER_OPERATION(build_lookup, csr::build_lookup);
 
 
 }  // anonymous namespace
@@ -454,6 +462,40 @@ void Csr<ValueType, IndexType>::move_to(
 }
 
 
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::convert_to(
+    DeltaCsr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    auto tmp = make_temporary_clone(exec, result);
+    tmp->values_ = this->values_;
+    tmp->row_ptrs_ = this->row_ptrs_;
+    tmp->row_bases_.resize_and_reset(num_rows);
+    tmp->compressed_idx_ptrs_.resize_and_reset(num_rows + 1);
+    exec->run(csr::make_compute_compressed_sizes(
+        num_rows, this->get_const_row_ptrs(), this->get_const_col_idxs(),
+        tmp->row_bases_.get_data(), tmp->compressed_idx_ptrs_.get_data()));
+    exec->run(csr::make_prefix_sum_nonnegative(
+        tmp->compressed_idx_ptrs_.get_data(), num_rows + 1));
+    tmp->compressed_idxs_.resize_and_reset(
+        get_element(tmp->compressed_idx_ptrs_, num_rows));
+    exec->run(csr::make_compress_idxs(
+        num_rows, this->get_const_row_ptrs(), this->get_const_col_idxs(),
+        tmp->row_bases_.get_const_data(),
+        tmp->compressed_idx_ptrs_.get_const_data(),
+        tmp->compressed_idxs_.get_data()));
+    tmp->set_size(this->get_size());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::move_to(DeltaCsr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
 template <typename ValueType, typename IndexType>
 void Csr<ValueType, IndexType>::convert_to(
     Ell<ValueType, IndexType>* result) const
@@ -816,6 +858,118 @@ Csr<ValueType, IndexType>::scale_permute(
 }
 
 
+template <typename ValueType, typename IndexType>
+struct Csr<ValueType, IndexType>::multiply_reuse_info::lookup_data {
+    dim<2> size1;
+    dim<2> size2;
+    size_type nnz1;
+    size_type nnz2;
+    size_type out_nnz;
+    array<IndexType> storage_offsets;
+    array<int64> row_descs;
+    array<int32> storage;
+};
+
+
+template <typename ValueType, typename IndexType>
+Csr<ValueType, IndexType>::multiply_reuse_info::multiply_reuse_info() = default;
+
+
+template <typename ValueType, typename IndexType>
+Csr<ValueType, IndexType>::multiply_reuse_info::multiply_reuse_info(
+    std::unique_ptr<lookup_data> data)
+    : internal_{std::move(data)}
+{}
+
+
+template <typename ValueType, typename IndexType>
+Csr<ValueType, IndexType>::multiply_reuse_info::~multiply_reuse_info() =
+    default;
+
+
+template <typename ValueType, typename IndexType>
+Csr<ValueType, IndexType>::multiply_reuse_info::multiply_reuse_info(
+    multiply_reuse_info&&) noexcept = default;
+
+
+template <typename ValueType, typename IndexType>
+typename Csr<ValueType, IndexType>::multiply_reuse_info&
+Csr<ValueType, IndexType>::multiply_reuse_info::operator=(
+    multiply_reuse_info&&) noexcept = default;
+
+
+template <typename ValueType, typename IndexType>
+void Csr<ValueType, IndexType>::multiply_reuse_info::update_values(
+    ptr_param<const Csr> mtx1, ptr_param<const Csr> mtx2,
+    ptr_param<Csr> out) const
+{
+    if (!internal_) {
+        GKO_INVALID_STATE("uninitialized multiply_reuse_info");
+    }
+    GKO_ASSERT_EQUAL_DIMENSIONS(mtx1, internal_->size1);
+    GKO_ASSERT_EQUAL_DIMENSIONS(mtx2, internal_->size2);
+    GKO_ASSERT_EQUAL_DIMENSIONS(
+        out, dim<2>(internal_->size1[0], internal_->size2[1]));
+    GKO_ASSERT_EQ(mtx1->get_num_stored_elements(), internal_->nnz1);
+    GKO_ASSERT_EQ(mtx2->get_num_stored_elements(), internal_->nnz2);
+    GKO_ASSERT_EQ(out->get_num_stored_elements(), internal_->out_nnz);
+    const auto exec = out->get_executor();
+    auto local_mtx1 = make_temporary_clone(exec, mtx1);
+    auto local_mtx2 = make_temporary_clone(exec, mtx2);
+    auto storage_offsets =
+        make_temporary_clone(exec, &internal_->storage_offsets);
+    auto row_descs = make_temporary_clone(exec, &internal_->row_descs);
+    auto storage = make_temporary_clone(exec, &internal_->storage);
+    size_type num_missing{};
+    exec->run(csr::make_spgemm_numeric(
+        local_mtx1.get(), local_mtx2.get(), storage_offsets->get_const_data(),
+        row_descs->get_const_data(), storage->get_const_data(), out.get(),
+        num_missing));
+    if (num_missing > 0) {
+        throw ValueMismatch(__FILE__, __LINE__, __func__, num_missing, 0,
+                            "products without an entry in the output "
+                            "sparsity pattern");
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::pair<std::unique_ptr<Csr<ValueType, IndexType>>,
+          typename Csr<ValueType, IndexType>::multiply_reuse_info>
+Csr<ValueType, IndexType>::multiply_reuse(ptr_param<const Csr> other) const
+{
+    GKO_ASSERT_CONFORMANT(this, other);
+    const auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    auto result = Csr::create(exec, dim<2>{num_rows, other->get_size()[1]});
+    auto local_other = make_temporary_clone(exec, other);
+    exec->run(csr::make_spgemm(this, local_other.get(), result.get()));
+    result->make_srow();
+    // the lookup finds the output entry of each scalar product
+    auto data = std::make_unique<typename multiply_reuse_info::lookup_data>(
+        typename multiply_reuse_info::lookup_data{
+            this->get_size(), other->get_size(),
+            this->get_num_stored_elements(), other->get_num_stored_elements(),
+            result->get_num_stored_elements(),
+            array<IndexType>{exec, num_rows + 1}, array<int64>{exec, num_rows},
+            array<int32>{exec}});
+    const auto allowed_sparsity = csr::sparsity_type::bitmap |
+                                  csr::sparsity_type::full |
+                                  csr::sparsity_type::hash;
+    exec->run(csr::make_build_lookup_offsets(
+        result->get_const_row_ptrs(), result->get_const_col_idxs(), num_rows,
+        allowed_sparsity, data->storage_offsets.get_data()));
+    data->storage.resize_and_reset(static_cast<size_type>(
+        get_element(data->storage_offsets, num_rows)));
+    exec->run(csr::make_build_lookup(
+        result->get_const_row_ptrs(), result->get_const_col_idxs(), num_rows,
+        allowed_sparsity, data->storage_offsets.get_const_data(),
+        data->row_descs.get_data(), data->storage.get_data()));
+    return std::make_pair(std::move(result),
+                          multiply_reuse_info{std::move(data)});
+}
+
+
 template <typename IndexType>
 std::unique_ptr<const Permutation<IndexType>> create_permutation_view(
     const array<IndexType>& indices)
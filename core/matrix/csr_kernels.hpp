@@ -60,6 +60,15 @@ namespace kernels {
                          const matrix::Csr<ValueType, IndexType>* d,  \
                          matrix::Csr<ValueType, IndexType>* c)
 
+#define GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL(ValueType, IndexType)  \
+    void spgemm_numeric(std::shared_ptr<const DefaultExecutor> exec, \
+                        const matrix::Csr<ValueType, IndexType>* a,  \
+                        const matrix::Csr<ValueType, IndexType>* b,  \
+                        const IndexType* storage_offsets,            \
+                        const int64* row_desc, const int32* storage, \
+                        matrix::Csr<ValueType, IndexType>* c,        \
+                        size_type& num_missing)
+
 #define GKO_DECLARE_CSR_SPGEAM_KERNEL(ValueType, IndexType)  \
     void spgeam(std::shared_ptr<const DefaultExecutor> exec, \
                 const matrix::Dense<ValueType>* alpha,       \
@@ -275,6 +284,8 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                       \
     GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL(ValueType, IndexType);           \
     template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL(ValueType, IndexType);            \
+    template <typename ValueType, typename IndexType>                       \
     GKO_DECLARE_CSR_SPGEAM_KERNEL(ValueType, IndexType);                    \
     template <typename ValueType, typename IndexType>                       \
     GKO_DECLARE_CSR_FILL_IN_DENSE_KERNEL(ValueType, IndexType);             \
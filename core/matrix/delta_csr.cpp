@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace delta_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, delta_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, delta_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(decompress_idxs, delta_csr::decompress_idxs);
+
+
+}  // anonymous namespace
+}  // namespace delta_csr
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    mixed_precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                delta_csr::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                const LinOp* b,
+                                                const LinOp* beta,
+                                                LinOp* x) const
+{
+    mixed_precision_dispatch_real_complex<ValueType>(
+        [this, alpha, beta](auto dense_b, auto dense_x) {
+            auto dense_alpha = make_temporary_conversion<ValueType>(alpha);
+            auto dense_beta = make_temporary_conversion<
+                typename std::decay_t<decltype(*dense_x)>::value_type>(beta);
+            this->get_executor()->run(delta_csr::make_advanced_spmv(
+                dense_alpha.get(), this, dense_b, dense_beta.get(), dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>& DeltaCsr<ValueType, IndexType>::operator=(
+    const DeltaCsr<ValueType, IndexType>& other)
+{
+    if (&other != this) {
+        EnableLinOp<DeltaCsr>::operator=(other);
+        values_ = other.values_;
+        row_ptrs_ = other.row_ptrs_;
+        row_bases_ = other.row_bases_;
+        compressed_idx_ptrs_ = other.compressed_idx_ptrs_;
+        compressed_idxs_ = other.compressed_idxs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>& DeltaCsr<ValueType, IndexType>::operator=(
+    DeltaCsr<ValueType, IndexType>&& other)
+{
+    if (&other != this) {
+        EnableLinOp<DeltaCsr>::operator=(std::move(other));
+        values_ = std::move(other.values_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        row_bases_ = std::move(other.row_bases_);
+        compressed_idx_ptrs_ = std::move(other.compressed_idx_ptrs_);
+        compressed_idxs_ = std::move(other.compressed_idxs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+        other.compressed_idx_ptrs_.resize_and_reset(1);
+        other.compressed_idx_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>::DeltaCsr(
+    const DeltaCsr<ValueType, IndexType>& other)
+    : DeltaCsr{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>::DeltaCsr(DeltaCsr<ValueType, IndexType>&& other)
+    : DeltaCsr{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+DeltaCsr<ValueType, IndexType>::DeltaCsr(std::shared_ptr<const Executor> exec,
+                                         const dim<2>& size)
+    : EnableLinOp<DeltaCsr>(exec, size),
+      values_(exec),
+      row_ptrs_(exec, size[0] + 1),
+      row_bases_(exec, size[0]),
+      compressed_idx_ptrs_(exec, size[0] + 1),
+      compressed_idxs_(exec)
+{
+    row_ptrs_.fill(0);
+    row_bases_.fill(0);
+    compressed_idx_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<DeltaCsr<ValueType, IndexType>>
+DeltaCsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                       const dim<2>& size)
+{
+    return std::unique_ptr<DeltaCsr>{new DeltaCsr{exec, size}};
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    auto tmp = make_temporary_clone(exec, result);
+    tmp->values_ = this->values_;
+    tmp->row_ptrs_ = this->row_ptrs_;
+    tmp->col_idxs_.resize_and_reset(this->get_num_stored_elements());
+    exec->run(delta_csr::make_decompress_idxs(
+        num_rows, this->get_const_row_ptrs(), this->get_const_row_bases(),
+        this->get_const_compressed_idx_ptrs(),
+        this->get_const_compressed_idxs(), tmp->get_col_idxs()));
+    tmp->set_size(this->get_size());
+    tmp->make_srow();
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::move_to(Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(data);
+    tmp->convert_to(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(data);
+    tmp->convert_to(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(std::move(data));
+    tmp->convert_to(this);
+}
+
+
+template <typename ValueType, typename IndexType>
+void DeltaCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+#define GKO_DECLARE_DELTA_CSR_MATRIX(ValueType, IndexType) \
+    class DeltaCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_DELTA_CSR_CODEC_HPP_
+#define GKO_CORE_MATRIX_DELTA_CSR_CODEC_HPP_
+
+
+#include <type_traits>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace delta_csr {
+
+
+/**
+ * Returns the number of bytes used to store each column delta of a row whose
+ * column indices span the range [base, base + max_delta].
+ */
+template <typename IndexType>
+GKO_ATTRIBUTES GKO_INLINE int64 delta_width(IndexType max_delta)
+{
+    if (max_delta <= 0xff) {
+        return sizeof(uint8);
+    }
+    if (max_delta <= 0xffff) {
+        return sizeof(uint16);
+    }
+    return sizeof(IndexType);
+}
+
+
+/**
+ * Computes the base column index of a row and the number of bytes needed to
+ * store its column deltas.
+ *
+ * @return the number of bytes needed for the row's deltas.
+ */
+template <typename IndexType>
+GKO_ATTRIBUTES GKO_INLINE int64 compute_row_size(const IndexType* row_begin,
+                                                 const IndexType* row_end,
+                                                 IndexType& base)
+{
+    if (row_begin == row_end) {
+        base = zero<IndexType>();
+        return 0;
+    }
+    auto min_col = *row_begin;
+    auto max_col = *row_begin;
+    for (auto it = row_begin; it != row_end; ++it) {
+        min_col = *it < min_col ? *it : min_col;
+        max_col = *it > max_col ? *it : max_col;
+    }
+    base = min_col;
+    return delta_width(max_col - base) * (row_end - row_begin);
+}
+
+
+// The deltas are stored byte-wise in little-endian order, so the compressed
+// indices don't need to be aligned and can be decoded on every device.
+template <typename DeltaType>
+GKO_ATTRIBUTES GKO_INLINE void store_delta(DeltaType delta, uint8* out)
+{
+    const auto bits = static_cast<std::make_unsigned_t<DeltaType>>(delta);
+    for (int i = 0; i < static_cast<int>(sizeof(DeltaType)); i++) {
+        out[i] = static_cast<uint8>(bits >> (8 * i));
+    }
+}
+
+
+template <typename DeltaType>
+GKO_ATTRIBUTES GKO_INLINE DeltaType load_delta(const uint8* in)
+{
+    std::make_unsigned_t<DeltaType> bits{};
+    for (int i = 0; i < static_cast<int>(sizeof(DeltaType)); i++) {
+        bits |= static_cast<std::make_unsigned_t<DeltaType>>(in[i]) << (8 * i);
+    }
+    return static_cast<DeltaType>(bits);
+}
+
+
+template <typename DeltaType, typename IndexType>
+GKO_ATTRIBUTES GKO_INLINE void encode_row_as(const IndexType* row_begin,
+                                             const IndexType* row_end,
+                                             IndexType base, uint8* out)
+{
+    for (auto it = row_begin; it != row_end; ++it) {
+        store_delta(static_cast<DeltaType>(*it - base), out);
+        out += sizeof(DeltaType);
+    }
+}
+
+
+/**
+ * Stores the deltas of the column indices of a row to the given base in `out`,
+ * which needs to be able to hold compute_row_size(...) bytes.
+ */
+template <typename IndexType>
+GKO_ATTRIBUTES GKO_INLINE void encode_row(const IndexType* row_begin,
+                                          const IndexType* row_end,
+                                          IndexType base, int64 width,
+                                          uint8* out)
+{
+    switch (width) {
+    case sizeof(uint8):
+        encode_row_as<uint8>(row_begin, row_end, base, out);
+        break;
+    case sizeof(uint16):
+        encode_row_as<uint16>(row_begin, row_end, base, out);
+        break;
+    default:
+        encode_row_as<IndexType>(row_begin, row_end, base, out);
+    }
+}
+
+
+template <typename DeltaType, typename IndexType, typename Callback>
+GKO_ATTRIBUTES GKO_INLINE void for_each_entry_as(IndexType begin, IndexType end,
+                                                 IndexType base,
+                                                 const uint8* deltas,
+                                                 Callback fn)
+{
+    for (auto nz = begin; nz < end; nz++) {
+        const auto delta = load_delta<DeltaType>(deltas);
+        deltas += sizeof(DeltaType);
+        fn(nz, static_cast<IndexType>(base + delta));
+    }
+}
+
+
+/**
+ * Calls fn(nz, col) for every stored entry of a DeltaCsr row, where nz is the
+ * index of the entry in the value array and col its column index. The
+ * decoding loop is specialized for every delta width.
+ */
+template <typename IndexType, typename Callback>
+GKO_ATTRIBUTES GKO_INLINE void for_each_entry(const IndexType* row_ptrs,
+                                              const IndexType* row_bases,
+                                              const int64* compressed_idx_ptrs,
+                                              const uint8* compressed_idxs,
+                                              size_type row, Callback fn)
+{
+    const auto begin = row_ptrs[row];
+    const auto end = row_ptrs[row + 1];
+    if (begin == end) {
+        return;
+    }
+    const auto base = row_bases[row];
+    const auto deltas = compressed_idxs + compressed_idx_ptrs[row];
+    const auto width =
+        (compressed_idx_ptrs[row + 1] - compressed_idx_ptrs[row]) /
+        (end - begin);
+    switch (width) {
+    case sizeof(uint8):
+        for_each_entry_as<uint8>(begin, end, base, deltas, fn);
+        break;
+    case sizeof(uint16):
+        for_each_entry_as<uint16>(begin, end, base, deltas, fn);
+        break;
+    default:
+        for_each_entry_as<IndexType>(begin, end, base, deltas, fn);
+    }
+}
+
+
+}  // namespace delta_csr
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_DELTA_CSR_CODEC_HPP_
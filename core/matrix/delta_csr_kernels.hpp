@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_DELTA_CSR_KERNELS_HPP_
+#define GKO_CORE_MATRIX_DELTA_CSR_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_DELTA_CSR_SPMV_KERNEL(MatrixValueType, InputValueType, \
+                                          OutputValueType, IndexType)      \
+    void spmv(std::shared_ptr<const DefaultExecutor> exec,                 \
+              const matrix::DeltaCsr<MatrixValueType, IndexType>* a,       \
+              const matrix::Dense<InputValueType>* b,                      \
+              matrix::Dense<OutputValueType>* c)
+
+#define GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL(              \
+    MatrixValueType, InputValueType, OutputValueType, IndexType) \
+    void advanced_spmv(                                          \
+        std::shared_ptr<const DefaultExecutor> exec,             \
+        const matrix::Dense<MatrixValueType>* alpha,             \
+        const matrix::DeltaCsr<MatrixValueType, IndexType>* a,   \
+        const matrix::Dense<InputValueType>* b,                  \
+        const matrix::Dense<OutputValueType>* beta,              \
+        matrix::Dense<OutputValueType>* c)
+
+#define GKO_DECLARE_DELTA_CSR_COMPUTE_COMPRESSED_SIZES_KERNEL(IndexType) \
+    void compute_compressed_sizes(                                       \
+        std::shared_ptr<const DefaultExecutor> exec, size_type num_rows, \
+        const IndexType* row_ptrs, const IndexType* col_idxs,            \
+        IndexType* row_bases, int64* compressed_sizes)
+
+#define GKO_DECLARE_DELTA_CSR_COMPRESS_IDXS_KERNEL(IndexType)                 \
+    void compress_idxs(std::shared_ptr<const DefaultExecutor> exec,           \
+                       size_type num_rows, const IndexType* row_ptrs,         \
+                       const IndexType* col_idxs, const IndexType* row_bases, \
+                       const int64* compressed_idx_ptrs,                      \
+                       uint8* compressed_idxs)
+
+#define GKO_DECLARE_DELTA_CSR_DECOMPRESS_IDXS_KERNEL(IndexType)             \
+    void decompress_idxs(std::shared_ptr<const DefaultExecutor> exec,       \
+                         size_type num_rows, const IndexType* row_ptrs,     \
+                         const IndexType* row_bases,                        \
+                         const int64* compressed_idx_ptrs,                  \
+                         const uint8* compressed_idxs, IndexType* col_idxs)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                   \
+    template <typename MatrixValueType, typename InputValueType,       \
+              typename OutputValueType, typename IndexType>            \
+    GKO_DECLARE_DELTA_CSR_SPMV_KERNEL(MatrixValueType, InputValueType, \
+                                      OutputValueType, IndexType);     \
+    template <typename MatrixValueType, typename InputValueType,       \
+              typename OutputValueType, typename IndexType>            \
+    GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL(                        \
+        MatrixValueType, InputValueType, OutputValueType, IndexType);  \
+    template <typename IndexType>                                      \
+    GKO_DECLARE_DELTA_CSR_COMPUTE_COMPRESSED_SIZES_KERNEL(IndexType);  \
+    template <typename IndexType>                                      \
+    GKO_DECLARE_DELTA_CSR_COMPRESS_IDXS_KERNEL(IndexType);             \
+    template <typename IndexType>                                      \
+    GKO_DECLARE_DELTA_CSR_DECOMPRESS_IDXS_KERNEL(IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(delta_csr,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_DELTA_CSR_KERNELS_HPP_
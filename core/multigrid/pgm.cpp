@@ -5,12 +5,22 @@
 #include <ginkgo/core/multigrid/pgm.hpp>
 
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+
 #include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/polymorphic_object.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
+#include <ginkgo/core/distributed/partition_helpers.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
@@ -19,9 +29,11 @@
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
+#include "core/base/dispatch_helper.hpp"
 #include "core/base/utils.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
+#include "core/distributed/helpers.hpp"
 #include "core/matrix/csr_builder.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
 
@@ -46,6 +58,9 @@ GKO_REGISTER_OPERATION(compute_coarse_coo, pgm::compute_coarse_coo);
 GKO_REGISTER_OPERATION(fill_array, components::fill_array);
 GKO_REGISTER_OPERATION(fill_seq_array, components::fill_seq_array);
 GKO_REGISTER_OPERATION(convert_idxs_to_ptrs, components::convert_idxs_to_ptrs);
+GKO_REGISTER_OPERATION(convert_ptrs_to_idxs, components::convert_ptrs_to_idxs);
+GKO_REGISTER_OPERATION(map_to_global, pgm::map_to_global);
+GKO_REGISTER_OPERATION(gather_index, pgm::gather_index);
 
 
 }  // anonymous namespace
@@ -112,34 +127,19 @@ std::shared_ptr<matrix::Csr<ValueType, IndexType>> generate_coarse(
 }
 
 
-}  // namespace
-
-
-template <typename ValueType, typename IndexType>
-void Pgm<ValueType, IndexType>::generate()
+template <typename ValueType, typename IndexType, typename Parameters>
+IndexType aggregate(std::shared_ptr<const Executor> exec,
+                    const matrix::Csr<ValueType, IndexType>* pgm_op,
+                    const Parameters& parameters, gko::array<IndexType>& agg)
 {
-    using csr_type = matrix::Csr<ValueType, IndexType>;
     using real_type = remove_complex<ValueType>;
-    using weight_csr_type = remove_complex<csr_type>;
-    auto exec = this->get_executor();
-    const auto num_rows = this->system_matrix_->get_size()[0];
-    array<IndexType> strongest_neighbor(this->get_executor(), num_rows);
-    array<IndexType> intermediate_agg(this->get_executor(),
-                                      parameters_.deterministic * num_rows);
-    // Only support csr matrix currently.
-    const csr_type* pgm_op =
-        dynamic_cast<const csr_type*>(system_matrix_.get());
-    std::shared_ptr<const csr_type> pgm_op_shared_ptr{};
-    // If system matrix is not csr or need sorting, generate the csr.
-    if (!parameters_.skip_sorting || !pgm_op) {
-        pgm_op_shared_ptr = convert_to_with_sorting<csr_type>(
-            exec, system_matrix_, parameters_.skip_sorting);
-        pgm_op = pgm_op_shared_ptr.get();
-        // keep the same precision data in fine_op
-        this->set_fine_op(pgm_op_shared_ptr);
-    }
+    using weight_csr_type = matrix::Csr<real_type, IndexType>;
+    const auto num_rows = pgm_op->get_size()[0];
+    array<IndexType> strongest_neighbor(exec, num_rows);
+    array<IndexType> intermediate_agg(exec,
+                                      parameters.deterministic * num_rows);
     // Initial agg = -1
-    exec->run(pgm::make_fill_array(agg_.get_data(), agg_.get_size(),
+    exec->run(pgm::make_fill_array(agg.get_data(), agg.get_size(),
                                    -one<IndexType>()));
     IndexType num_unagg = num_rows;
     IndexType num_unagg_prev = num_rows;
@@ -154,35 +154,359 @@ void Pgm<ValueType, IndexType>::generate()
     abs_mtx->apply(half_scalar, identity, half_scalar, weight_mtx);
     // Extract the diagonal value of matrix
     auto diag = weight_mtx->extract_diagonal();
-    for (int i = 0; i < parameters_.max_iterations; i++) {
+    for (int i = 0; i < parameters.max_iterations; i++) {
         // Find the strongest neighbor of each row
         exec->run(pgm::make_find_strongest_neighbor(
-            weight_mtx.get(), diag.get(), agg_, strongest_neighbor));
+            weight_mtx.get(), diag.get(), agg, strongest_neighbor));
         // Match edges
-        exec->run(pgm::make_match_edge(strongest_neighbor, agg_));
+        exec->run(pgm::make_match_edge(strongest_neighbor, agg));
         // Get the num_unagg
-        exec->run(pgm::make_count_unagg(agg_, &num_unagg));
+        exec->run(pgm::make_count_unagg(agg, &num_unagg));
         // no new match, all match, or the ratio of num_unagg/num is lower
         // than parameter.max_unassigned_ratio
         if (num_unagg == 0 || num_unagg == num_unagg_prev ||
-            num_unagg < parameters_.max_unassigned_ratio * num_rows) {
+            num_unagg < parameters.max_unassigned_ratio * num_rows) {
             break;
         }
         num_unagg_prev = num_unagg;
     }
     // Handle the left unassign points
-    if (num_unagg != 0 && parameters_.deterministic) {
+    if (num_unagg != 0 && parameters.deterministic) {
         // copy the agg to intermediate_agg
-        intermediate_agg = agg_;
+        intermediate_agg = agg;
     }
     if (num_unagg != 0) {
         // Assign all left points
         exec->run(pgm::make_assign_to_exist_agg(weight_mtx.get(), diag.get(),
-                                                agg_, intermediate_agg));
+                                                agg, intermediate_agg));
     }
     IndexType num_agg = 0;
     // Renumber the index
-    exec->run(pgm::make_renumber(agg_, &num_agg));
+    exec->run(pgm::make_renumber(agg, &num_agg));
+    return num_agg;
+}
+
+
+#if GINKGO_BUILD_MPI
+
+
+/**
+ * Sends the value of every local row that is a non-local column on another
+ * rank, using the communication pattern of the distributed matrix. All values
+ * are stored on the host.
+ *
+ * @return the received value of every non-local column of the matrix
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType,
+          typename T>
+std::vector<T> exchange_non_local(
+    const experimental::distributed::Matrix<ValueType, LocalIndexType,
+                                            GlobalIndexType>* matrix,
+    const std::vector<T>& local_values)
+{
+    auto host_exec = matrix->get_executor()->get_master();
+    auto comm = matrix->get_communicator();
+    const array<LocalIndexType> gather_idxs{host_exec,
+                                            matrix->get_gather_idxs()};
+    std::vector<T> send_values(gather_idxs.get_size());
+    for (size_type i = 0; i < send_values.size(); i++) {
+        send_values[i] = local_values[gather_idxs.get_const_data()[i]];
+    }
+    std::vector<T> recv_values(matrix->get_non_local_to_global().get_size());
+    comm.all_to_all_v(host_exec, send_values.data(),
+                      matrix->get_send_sizes().data(),
+                      matrix->get_send_offsets().data(), recv_values.data(),
+                      matrix->get_recv_sizes().data(),
+                      matrix->get_recv_offsets().data());
+    return recv_values;
+}
+
+
+/**
+ * Pairs the rows of the distributed matrix with rows on other ranks by
+ * one-phase handshaking. Each row prefers its strongest non-local neighbor if
+ * it is at least as strong as its strongest local neighbor, where the strength
+ * is |a_ij| / max(|a_ii|, |a_jj|). Two rows that prefer each other are paired.
+ *
+ * @param matrix  the distributed matrix
+ * @param offset  the global index of the first local row
+ *
+ * @return the non-local column paired with each local row, or invalid_index
+ *         if it is not paired
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::vector<LocalIndexType> find_non_local_partners(
+    const experimental::distributed::Matrix<ValueType, LocalIndexType,
+                                            GlobalIndexType>* matrix,
+    GlobalIndexType offset)
+{
+    using csr_type = matrix::Csr<ValueType, LocalIndexType>;
+    using real_type = remove_complex<ValueType>;
+    auto host_exec = matrix->get_executor()->get_master();
+    auto local =
+        convert_to_with_sorting<csr_type>(host_exec, matrix->get_local_matrix(),
+                                          true);
+    auto non_local = convert_to_with_sorting<csr_type>(
+        host_exec, matrix->get_non_local_matrix(), true);
+    const array<GlobalIndexType> non_local_to_global{
+        host_exec, matrix->get_non_local_to_global()};
+    const auto num_rows = static_cast<LocalIndexType>(local->get_size()[0]);
+    const auto row_ptrs = local->get_const_row_ptrs();
+    const auto col_idxs = local->get_const_col_idxs();
+    const auto vals = local->get_const_values();
+    const auto non_local_row_ptrs = non_local->get_const_row_ptrs();
+    const auto non_local_col_idxs = non_local->get_const_col_idxs();
+    const auto non_local_vals = non_local->get_const_values();
+    auto strength = [](ValueType val, real_type diag_i, real_type diag_j) {
+        const auto max_diag = std::max(diag_i, diag_j);
+        return max_diag > zero<real_type>() ? abs(val) / max_diag
+                                            : zero<real_type>();
+    };
+    std::vector<real_type> diag(num_rows, zero<real_type>());
+    for (LocalIndexType row = 0; row < num_rows; row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] == row) {
+                diag[row] = abs(vals[nz]);
+            }
+        }
+    }
+    const auto non_local_diag = exchange_non_local(matrix, diag);
+    std::vector<LocalIndexType> candidate(num_rows,
+                                          invalid_index<LocalIndexType>());
+    std::vector<GlobalIndexType> choice(num_rows,
+                                        invalid_index<GlobalIndexType>());
+    for (LocalIndexType row = 0; row < num_rows; row++) {
+        auto local_strength = zero<real_type>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (col != row) {
+                local_strength =
+                    std::max(local_strength,
+                             strength(vals[nz], diag[row], diag[col]));
+            }
+        }
+        auto non_local_strength = zero<real_type>();
+        for (auto nz = non_local_row_ptrs[row];
+             nz < non_local_row_ptrs[row + 1]; nz++) {
+            const auto col = non_local_col_idxs[nz];
+            const auto col_strength =
+                strength(non_local_vals[nz], diag[row], non_local_diag[col]);
+            if (col_strength > non_local_strength) {
+                non_local_strength = col_strength;
+                candidate[row] = col;
+            }
+        }
+        if (candidate[row] != invalid_index<LocalIndexType>() &&
+            non_local_strength >= local_strength) {
+            choice[row] =
+                non_local_to_global.get_const_data()[candidate[row]];
+        } else {
+            candidate[row] = invalid_index<LocalIndexType>();
+        }
+    }
+    const auto non_local_choice = exchange_non_local(matrix, choice);
+    std::vector<LocalIndexType> partner(num_rows,
+                                        invalid_index<LocalIndexType>());
+    for (LocalIndexType row = 0; row < num_rows; row++) {
+        const auto col = candidate[row];
+        if (col != invalid_index<LocalIndexType>() &&
+            non_local_choice[col] == offset + row) {
+            partner[row] = col;
+        }
+    }
+    return partner;
+}
+
+
+/**
+ * Maps the entries of a distributed matrix to the global coarse indices given
+ * for its local rows. The coarse indices of the non-local columns are
+ * received from their owners. Duplicate entries are not summed up.
+ *
+ * @param matrix  the distributed matrix
+ * @param local_csr  the local matrix of `matrix` as Csr
+ * @param non_local_csr  the non-local matrix of `matrix` as Csr
+ * @param coarse_map  the global coarse index of every local row
+ * @param coarse_size  the global number of coarse rows
+ *
+ * @return the coarse entries of the local rows
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> map_to_coarse(
+    const experimental::distributed::Matrix<ValueType, LocalIndexType,
+                                            GlobalIndexType>* matrix,
+    const matrix::Csr<ValueType, LocalIndexType>* local_csr,
+    const matrix::Csr<ValueType, LocalIndexType>* non_local_csr,
+    const array<GlobalIndexType>& coarse_map, size_type coarse_size)
+{
+    auto exec = coarse_map.get_executor();
+    auto comm = matrix->get_communicator();
+    // Send the coarse index of every row that is a non-local column on
+    // another rank, using the communication pattern of the matrix.
+    const auto& gather_idxs = matrix->get_gather_idxs();
+    const auto num_send = gather_idxs.get_size();
+    const auto num_recv = matrix->get_non_local_to_global().get_size();
+    array<GlobalIndexType> send_map(exec, num_send);
+    array<GlobalIndexType> non_local_map(exec, num_recv);
+    exec->run(pgm::make_gather_index(num_send, coarse_map.get_const_data(),
+                                     gather_idxs.get_const_data(),
+                                     send_map.get_data()));
+    auto use_host_buffer = experimental::mpi::requires_host_buffer(exec, comm);
+    if (use_host_buffer) {
+        send_map.set_executor(exec->get_master());
+        non_local_map.set_executor(exec->get_master());
+    }
+    exec->synchronize();
+    comm.all_to_all_v(use_host_buffer ? exec->get_master() : exec,
+                      send_map.get_const_data(),
+                      matrix->get_send_sizes().data(),
+                      matrix->get_send_offsets().data(),
+                      non_local_map.get_data(),
+                      matrix->get_recv_sizes().data(),
+                      matrix->get_recv_offsets().data());
+    non_local_map.set_executor(exec);
+
+    const auto num_rows = local_csr->get_size()[0];
+    const auto local_nnz = local_csr->get_num_stored_elements();
+    const auto non_local_nnz = non_local_csr->get_num_stored_elements();
+    device_matrix_data<ValueType, GlobalIndexType> coarse_data{
+        exec, dim<2>{coarse_size, coarse_size}, local_nnz + non_local_nnz};
+    array<LocalIndexType> row_idxs(exec, std::max(local_nnz, non_local_nnz));
+    exec->run(pgm::make_convert_ptrs_to_idxs(local_csr->get_const_row_ptrs(),
+                                             num_rows, row_idxs.get_data()));
+    exec->run(pgm::make_gather_index(local_nnz, coarse_map.get_const_data(),
+                                     row_idxs.get_const_data(),
+                                     coarse_data.get_row_idxs()));
+    exec->run(pgm::make_gather_index(
+        local_nnz, coarse_map.get_const_data(),
+        local_csr->get_const_col_idxs(), coarse_data.get_col_idxs()));
+    exec->copy(local_nnz, local_csr->get_const_values(),
+               coarse_data.get_values());
+    exec->run(pgm::make_convert_ptrs_to_idxs(
+        non_local_csr->get_const_row_ptrs(), num_rows, row_idxs.get_data()));
+    exec->run(pgm::make_gather_index(
+        non_local_nnz, coarse_map.get_const_data(), row_idxs.get_const_data(),
+        coarse_data.get_row_idxs() + local_nnz));
+    exec->run(pgm::make_gather_index(
+        non_local_nnz, non_local_map.get_const_data(),
+        non_local_csr->get_const_col_idxs(),
+        coarse_data.get_col_idxs() + local_nnz));
+    exec->copy(non_local_nnz, non_local_csr->get_const_values(),
+               coarse_data.get_values() + local_nnz);
+    return coarse_data;
+}
+
+
+/**
+ * Sends every entry of the matrix data to the rank that owns its row. The
+ * partition must consist of one (possibly empty) range per rank.
+ *
+ * @return the entries of the rows owned by this rank in row-major order
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> send_to_row_owners(
+    std::shared_ptr<const Executor> exec, experimental::mpi::communicator comm,
+    const device_matrix_data<ValueType, GlobalIndexType>& data,
+    const experimental::distributed::Partition<LocalIndexType, GlobalIndexType>*
+        partition)
+{
+    using experimental::distributed::comm_index_type;
+    auto host_exec = exec->get_master();
+    const auto num_ranks = comm.size();
+    const device_matrix_data<ValueType, GlobalIndexType> host_data{host_exec,
+                                                                   data};
+    std::vector<GlobalIndexType> range_bounds(num_ranks + 1);
+    host_exec->copy_from(partition->get_executor(), num_ranks + 1,
+                         partition->get_range_bounds(), range_bounds.data());
+    const auto num_entries = host_data.get_num_stored_elements();
+    const auto row_idxs = host_data.get_const_row_idxs();
+    const auto col_idxs = host_data.get_const_col_idxs();
+    const auto vals = host_data.get_const_values();
+    std::vector<comm_index_type> owners(num_entries);
+    std::vector<comm_index_type> send_sizes(num_ranks);
+    std::vector<comm_index_type> send_offsets(num_ranks + 1);
+    std::vector<comm_index_type> recv_sizes(num_ranks);
+    std::vector<comm_index_type> recv_offsets(num_ranks + 1);
+    for (size_type i = 0; i < num_entries; i++) {
+        // the last range starting before the row is the non-empty range
+        // containing it
+        owners[i] = std::upper_bound(range_bounds.begin(), range_bounds.end(),
+                                     row_idxs[i]) -
+                    range_bounds.begin() - 1;
+        send_sizes[owners[i]]++;
+    }
+    std::partial_sum(send_sizes.begin(), send_sizes.end(),
+                     send_offsets.begin() + 1);
+    comm.all_to_all(host_exec, send_sizes.data(), 1, recv_sizes.data(), 1);
+    std::partial_sum(recv_sizes.begin(), recv_sizes.end(),
+                     recv_offsets.begin() + 1);
+    array<GlobalIndexType> send_row_idxs(host_exec, num_entries);
+    array<GlobalIndexType> send_col_idxs(host_exec, num_entries);
+    array<ValueType> send_vals(host_exec, num_entries);
+    auto positions = send_offsets;
+    for (size_type i = 0; i < num_entries; i++) {
+        const auto pos = positions[owners[i]]++;
+        send_row_idxs.get_data()[pos] = row_idxs[i];
+        send_col_idxs.get_data()[pos] = col_idxs[i];
+        send_vals.get_data()[pos] = vals[i];
+    }
+    const auto num_recv = static_cast<size_type>(recv_offsets.back());
+    array<GlobalIndexType> recv_row_idxs(host_exec, num_recv);
+    array<GlobalIndexType> recv_col_idxs(host_exec, num_recv);
+    array<ValueType> recv_vals(host_exec, num_recv);
+    comm.all_to_all_v(host_exec, send_row_idxs.get_const_data(),
+                      send_sizes.data(), send_offsets.data(),
+                      recv_row_idxs.get_data(), recv_sizes.data(),
+                      recv_offsets.data());
+    comm.all_to_all_v(host_exec, send_col_idxs.get_const_data(),
+                      send_sizes.data(), send_offsets.data(),
+                      recv_col_idxs.get_data(), recv_sizes.data(),
+                      recv_offsets.data());
+    comm.all_to_all_v(host_exec, send_vals.get_const_data(), send_sizes.data(),
+                      send_offsets.data(), recv_vals.get_data(),
+                      recv_sizes.data(), recv_offsets.data());
+    device_matrix_data<ValueType, GlobalIndexType> result{
+        exec, data.get_size(), std::move(recv_row_idxs),
+        std::move(recv_col_idxs), std::move(recv_vals)};
+    result.sort_row_major();
+    return result;
+}
+
+
+#endif
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void Pgm<ValueType, IndexType>::generate()
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+#if GINKGO_BUILD_MPI
+    if (gko::detail::is_distributed(system_matrix_.get())) {
+        using experimental::distributed::Matrix;
+        run<const Matrix<ValueType, IndexType, IndexType>*,
+            const Matrix<ValueType, IndexType, int64>*>(
+            system_matrix_.get(),
+            [this](auto matrix) { this->generate_distributed(matrix); });
+        return;
+    }
+#endif
+    auto exec = this->get_executor();
+    // Only support csr matrix currently.
+    const csr_type* pgm_op =
+        dynamic_cast<const csr_type*>(system_matrix_.get());
+    std::shared_ptr<const csr_type> pgm_op_shared_ptr{};
+    // If system matrix is not csr or need sorting, generate the csr.
+    if (!parameters_.skip_sorting || !pgm_op) {
+        pgm_op_shared_ptr = convert_to_with_sorting<csr_type>(
+            exec, system_matrix_, parameters_.skip_sorting);
+        pgm_op = pgm_op_shared_ptr.get();
+        // keep the same precision data in fine_op
+        this->set_fine_op(pgm_op_shared_ptr);
+    }
+    const auto num_agg = aggregate(exec, pgm_op, parameters_, agg_);
 
     gko::dim<2>::dimension_type coarse_dim = num_agg;
     auto fine_dim = system_matrix_->get_size()[0];
@@ -206,6 +530,163 @@ void Pgm<ValueType, IndexType>::generate()
 }
 
 
+#if GINKGO_BUILD_MPI
+
+
+template <typename ValueType, typename IndexType>
+template <typename GlobalIndexType>
+void Pgm<ValueType, IndexType>::generate_distributed(
+    const experimental::distributed::Matrix<ValueType, IndexType,
+                                            GlobalIndexType>* matrix)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using matrix_type = experimental::distributed::Matrix<ValueType, IndexType,
+                                                          GlobalIndexType>;
+    using experimental::distributed::build_partition_from_local_size;
+    auto exec = this->get_executor();
+    auto host_exec = exec->get_master();
+    auto comm = matrix->get_communicator();
+    const auto num_ranks = comm.size();
+    const auto rank = comm.rank();
+    // The first aggregation only uses the rank-local block, so each aggregate
+    // consists of rows owned by a single rank.
+    auto local_csr = convert_to_with_sorting<csr_type>(
+        exec, matrix->get_local_matrix(), parameters_.skip_sorting);
+    auto non_local_csr = convert_to_with_sorting<csr_type>(
+        exec, matrix->get_non_local_matrix(), true);
+    const auto num_rows = local_csr->get_size()[0];
+    agg_.resize_and_reset(num_rows);
+    const auto num_agg = aggregate(exec, local_csr.get(), parameters_, agg_);
+
+    // The aggregates of every rank form a contiguous global range.
+    auto fine_partition =
+        share(build_partition_from_local_size<IndexType, GlobalIndexType>(
+            exec, comm, num_rows));
+    auto agg_partition =
+        share(build_partition_from_local_size<IndexType, GlobalIndexType>(
+            exec, comm, num_agg));
+    const auto fine_offset = exec->copy_val_to_host(
+        fine_partition->get_range_bounds() + comm.rank());
+    const auto agg_offset = exec->copy_val_to_host(
+        agg_partition->get_range_bounds() + comm.rank());
+    array<GlobalIndexType> global_agg(exec, num_rows);
+    exec->run(pgm::make_map_to_global(num_rows, agg_offset,
+                                      agg_.get_const_data(),
+                                      global_agg.get_data()));
+    auto agg_data = map_to_coarse(matrix, local_csr.get(), non_local_csr.get(),
+                                  global_agg, agg_partition->get_size());
+    agg_data.sum_duplicates();
+    auto agg_matrix = share(matrix_type::create(exec, comm));
+    agg_matrix->read_distributed(agg_data, agg_partition);
+
+    // Merge the aggregates on different ranks that prefer each other. The
+    // merged aggregate belongs to the rank of the smaller global index.
+    const auto partner = find_non_local_partners(agg_matrix.get(), agg_offset);
+    const array<GlobalIndexType> agg_non_local_to_global{
+        host_exec, agg_matrix->get_non_local_to_global()};
+    auto is_merged_away = [&](IndexType agg) {
+        return partner[agg] != invalid_index<IndexType>() &&
+               agg_non_local_to_global.get_const_data()[partner[agg]] <
+                   agg_offset + agg;
+    };
+    size_type num_coarse = 0;
+    for (IndexType agg = 0; agg < num_agg; agg++) {
+        num_coarse += !is_merged_away(agg);
+    }
+    std::vector<size_type> coarse_sizes(num_ranks);
+    comm.all_gather(host_exec, &num_coarse, 1, coarse_sizes.data(), 1);
+    const auto coarse_offset = std::accumulate(
+        coarse_sizes.begin(), coarse_sizes.begin() + rank, size_type{});
+    const auto coarse_size = std::accumulate(
+        coarse_sizes.begin() + rank, coarse_sizes.end(), coarse_offset);
+    // A small coarse matrix is agglomerated onto fewer ranks. The ranks are
+    // split into consecutive groups and the first rank of each group owns the
+    // coarse rows of the whole group, which keeps the global numbering.
+    auto local_coarse_size = num_coarse;
+    const auto min_rows = parameters_.min_rows_per_rank;
+    if (min_rows > 0 && coarse_size < min_rows * num_ranks) {
+        const auto num_groups = std::max<size_type>(
+            ceildiv(static_cast<int64>(coarse_size),
+                    static_cast<int64>(min_rows)),
+            1);
+        auto group = [&](int r) { return r * num_groups / num_ranks; };
+        local_coarse_size = 0;
+        if (rank == 0 || group(rank - 1) != group(rank)) {
+            for (auto r = rank; r < num_ranks && group(r) == group(rank);
+                 r++) {
+                local_coarse_size += coarse_sizes[r];
+            }
+        }
+    }
+    auto coarse_partition =
+        share(build_partition_from_local_size<IndexType, GlobalIndexType>(
+            exec, comm, local_coarse_size));
+
+    // Number the remaining aggregates consecutively, the aggregates that were
+    // merged away receive the index of their partner.
+    std::vector<GlobalIndexType> coarse_idxs(num_agg,
+                                             invalid_index<GlobalIndexType>());
+    auto next_idx = static_cast<GlobalIndexType>(coarse_offset);
+    for (IndexType agg = 0; agg < num_agg; agg++) {
+        if (!is_merged_away(agg)) {
+            coarse_idxs[agg] = next_idx++;
+        }
+    }
+    const auto partner_idxs = exchange_non_local(agg_matrix.get(), coarse_idxs);
+    for (IndexType agg = 0; agg < num_agg; agg++) {
+        if (is_merged_away(agg)) {
+            coarse_idxs[agg] = partner_idxs[partner[agg]];
+        }
+    }
+    const array<GlobalIndexType> coarse_map{exec, coarse_idxs.begin(),
+                                            coarse_idxs.end()};
+    auto agg_local_csr = convert_to_with_sorting<csr_type>(
+        exec, agg_matrix->get_local_matrix(), true);
+    auto agg_non_local_csr = convert_to_with_sorting<csr_type>(
+        exec, agg_matrix->get_non_local_matrix(), true);
+    auto coarse_data = send_to_row_owners(
+        exec, comm,
+        map_to_coarse(agg_matrix.get(), agg_local_csr.get(),
+                      agg_non_local_csr.get(), coarse_map, coarse_size),
+        coarse_partition.get());
+    coarse_data.sum_duplicates();
+    auto coarse_matrix = share(matrix_type::create(exec, comm));
+    coarse_matrix->read_distributed(coarse_data, coarse_partition);
+    exec->run(pgm::make_gather_index(num_rows, coarse_map.get_const_data(),
+                                     agg_.get_const_data(),
+                                     global_agg.get_data()));
+
+    // The prolongation maps every fine row to its aggregate, the restriction
+    // is its transpose. The rows of the restriction are sent to the owners of
+    // the aggregates.
+    const auto fine_size = fine_partition->get_size();
+    array<IndexType> local_rows(exec, num_rows);
+    exec->run(pgm::make_fill_seq_array(local_rows.get_data(), num_rows));
+    array<GlobalIndexType> fine_rows(exec, num_rows);
+    exec->run(pgm::make_map_to_global(num_rows, fine_offset,
+                                      local_rows.get_const_data(),
+                                      fine_rows.get_data()));
+    array<ValueType> ones(exec, num_rows);
+    ones.fill(one<ValueType>());
+    device_matrix_data<ValueType, GlobalIndexType> prolong_data{
+        exec, dim<2>{fine_size, coarse_size}, fine_rows, global_agg, ones};
+    auto prolong = share(matrix_type::create(exec, comm));
+    prolong->read_distributed(prolong_data, fine_partition, coarse_partition);
+    device_matrix_data<ValueType, GlobalIndexType> restrict_data{
+        exec, dim<2>{coarse_size, fine_size}, std::move(global_agg),
+        std::move(fine_rows), std::move(ones)};
+    auto restrict_op = share(matrix_type::create(exec, comm));
+    restrict_op->read_distributed(
+        send_to_row_owners(exec, comm, restrict_data, coarse_partition.get()),
+        coarse_partition, fine_partition);
+
+    this->set_multigrid_level(prolong, coarse_matrix, restrict_op);
+}
+
+
+#endif
+
+
 #define GKO_DECLARE_PGM(_vtype, _itype) class Pgm<_vtype, _itype>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM);
 
@@ -85,30 +85,46 @@ namespace pgm {
                             const IndexType* col_idxs, const ValueType* vals, \
                             matrix::Coo<ValueType, IndexType>* coarse_coo)
 
-
-#define GKO_DECLARE_ALL_AS_TEMPLATES                               \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_MATCH_EDGE_KERNEL(IndexType);                  \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL(IndexType);                 \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_RENUMBER_KERNEL(IndexType);                    \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_SORT_AGG_KERNEL(IndexType);                    \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_MAP_ROW_KERNEL(IndexType);                     \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_MAP_COL_KERNEL(IndexType);                     \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_COUNT_UNREPEATED_NNZ_KERNEL(IndexType);        \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR(ValueType, IndexType); \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG(ValueType, IndexType);     \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_SORT_ROW_MAJOR(ValueType, IndexType);          \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_COMPUTE_COARSE_COO(ValueType, IndexType)
+#define GKO_DECLARE_PGM_MAP_TO_GLOBAL(LocalIndexType, GlobalIndexType) \
+    void map_to_global(std::shared_ptr<const DefaultExecutor> exec,    \
+                       size_type num, GlobalIndexType offset,          \
+                       const LocalIndexType* local_idxs,               \
+                       GlobalIndexType* global_idxs)
+
+#define GKO_DECLARE_PGM_GATHER_INDEX(LocalIndexType, GlobalIndexType) \
+    void gather_index(std::shared_ptr<const DefaultExecutor> exec,    \
+                      size_type num, const GlobalIndexType* orig,     \
+                      const LocalIndexType* gather_map,               \
+                      GlobalIndexType* result)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                \
+    template <typename IndexType>                                   \
+    GKO_DECLARE_PGM_MATCH_EDGE_KERNEL(IndexType);                   \
+    template <typename IndexType>                                   \
+    GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL(IndexType);                  \
+    template <typename IndexType>                                   \
+    GKO_DECLARE_PGM_RENUMBER_KERNEL(IndexType);                     \
+    template <typename IndexType>                                   \
+    GKO_DECLARE_PGM_SORT_AGG_KERNEL(IndexType);                     \
+    template <typename IndexType>                                   \
+    GKO_DECLARE_PGM_MAP_ROW_KERNEL(IndexType);                      \
+    template <typename IndexType>                                   \
+    GKO_DECLARE_PGM_MAP_COL_KERNEL(IndexType);                      \
+    template <typename IndexType>                                   \
+    GKO_DECLARE_PGM_COUNT_UNREPEATED_NNZ_KERNEL(IndexType);         \
+    template <typename ValueType, typename IndexType>               \
+    GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR(ValueType, IndexType);  \
+    template <typename ValueType, typename IndexType>               \
+    GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG(ValueType, IndexType);      \
+    template <typename ValueType, typename IndexType>               \
+    GKO_DECLARE_PGM_SORT_ROW_MAJOR(ValueType, IndexType);           \
+    template <typename ValueType, typename IndexType>               \
+    GKO_DECLARE_PGM_COMPUTE_COARSE_COO(ValueType, IndexType);       \
+    template <typename LocalIndexType, typename GlobalIndexType>    \
+    GKO_DECLARE_PGM_MAP_TO_GLOBAL(LocalIndexType, GlobalIndexType); \
+    template <typename LocalIndexType, typename GlobalIndexType>    \
+    GKO_DECLARE_PGM_GATHER_INDEX(LocalIndexType, GlobalIndexType)
 
 
 }  // namespace pgm
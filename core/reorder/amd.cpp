@@ -17,6 +17,7 @@
 
 
 #include "core/base/allocator.hpp"
+#include "core/reorder/amd_kernels.hpp"
 
 
 namespace gko {
@@ -67,6 +68,17 @@ GKO_REGISTER_HOST_OPERATION(amd_reorder, amd_reorder);
 }  // namespace suitesparse_wrapper
 
 
+namespace amd {
+namespace {
+
+
+GKO_REGISTER_OPERATION(compute_permutation, amd::compute_permutation);
+
+
+}  // anonymous namespace
+}  // namespace amd
+
+
 template <typename IndexType>
 Amd<IndexType>::Amd(std::shared_ptr<const Executor> exec,
                     const parameters_type& params)
@@ -153,6 +165,16 @@ std::unique_ptr<LinOp> Amd<IndexType>::generate_impl(
     host_exec->copy_from(exec, num_rows + 1, pattern->get_const_row_ptrs(),
                          row_ptrs.get_data());
     const auto nnz = row_ptrs.get_data()[num_rows];
+    array<IndexType> permutation{host_exec, num_rows};
+    if (parameters_.algorithm == amd_algorithm::multiple_elimination) {
+        array<IndexType> col_idxs{host_exec, static_cast<size_type>(nnz)};
+        host_exec->copy_from(exec, nnz, pattern->get_const_col_idxs(),
+                             col_idxs.get_data());
+        host_exec->run(amd::make_compute_permutation(
+            static_cast<IndexType>(num_rows), row_ptrs.get_const_data(),
+            col_idxs.get_const_data(), permutation.get_data()));
+        return permutation_type::create(exec, std::move(permutation));
+    }
     // we use this much space for the column index workspace, the rest for
     // row workspace
     const auto col_idxs_plus_workspace_size = nnz + nnz / 5 + 2 * num_rows;
@@ -161,7 +183,6 @@ std::unique_ptr<LinOp> Amd<IndexType>::generate_impl(
     host_exec->copy_from(exec, nnz, pattern->get_const_col_idxs(),
                          col_idxs_plus_workspace.get_data());
 
-    array<IndexType> permutation{host_exec, num_rows};
     array<IndexType> row_lengths{host_exec, num_rows};
     for (size_type row = 0; row < num_rows; row++) {
         row_lengths.get_data()[row] =
@@ -0,0 +1,459 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_GRAPH_BISECTION_HPP_
+#define GKO_CORE_REORDER_GRAPH_BISECTION_HPP_
+
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace bisection {
+
+
+/** Part of a node after computing a vertex separator. */
+enum class node_part : uint8 { left, right, separator };
+
+
+// Coarsening stops once the graph has at most this many nodes.
+constexpr int coarsest_size = 100;
+
+// Coarsening stops if a level reduces the number of nodes by less than
+// 1 / coarsening_stall_factor.
+constexpr int coarsening_stall_factor = 20;
+
+// Number of different starting nodes for the initial partitioning.
+constexpr int num_initial_partitions = 4;
+
+// Maximum number of refinement passes on each level.
+constexpr int max_refinement_passes = 4;
+
+
+/**
+ * An undirected graph with node and edge weights stored in CSR format.
+ */
+template <typename IndexType>
+struct weighted_graph {
+    explicit weighted_graph(std::shared_ptr<const Executor> exec)
+        : row_ptrs(exec),
+          col_idxs(exec),
+          edge_weights(exec),
+          node_weights(exec),
+          total_weight{}
+    {}
+
+    IndexType get_size() const
+    {
+        return static_cast<IndexType>(node_weights.size());
+    }
+
+    vector<IndexType> row_ptrs;
+    vector<IndexType> col_idxs;
+    vector<IndexType> edge_weights;
+    vector<IndexType> node_weights;
+    IndexType total_weight;
+};
+
+
+/**
+ * Contracts a heavy-edge matching of the fine graph into the coarse graph.
+ * Nodes are visited in ascending order of their degree and matched with the
+ * unmatched neighbor connected by the heaviest edge.
+ *
+ * @param coarse_map  maps each fine node to its coarse node.
+ */
+template <typename IndexType>
+void coarsen(std::shared_ptr<const Executor> exec,
+             const weighted_graph<IndexType>& fine,
+             weighted_graph<IndexType>& coarse, vector<IndexType>& coarse_map)
+{
+    const auto size = fine.get_size();
+    const auto row_ptrs = fine.row_ptrs.data();
+    const auto col_idxs = fine.col_idxs.data();
+    vector<IndexType> order(size, exec);
+    std::iota(order.begin(), order.end(), IndexType{});
+    std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) {
+        return row_ptrs[a + 1] - row_ptrs[a] < row_ptrs[b + 1] - row_ptrs[b];
+    });
+    vector<IndexType> matches(size, invalid_index<IndexType>(), exec);
+    for (const auto node : order) {
+        if (matches[node] != invalid_index<IndexType>()) {
+            continue;
+        }
+        auto match = node;
+        IndexType match_weight{};
+        for (auto nz = row_ptrs[node]; nz < row_ptrs[node + 1]; nz++) {
+            const auto neighbor = col_idxs[nz];
+            if (neighbor != node &&
+                matches[neighbor] == invalid_index<IndexType>() &&
+                fine.edge_weights[nz] > match_weight) {
+                match = neighbor;
+                match_weight = fine.edge_weights[nz];
+            }
+        }
+        matches[node] = match;
+        matches[match] = node;
+    }
+    coarse_map.assign(size, invalid_index<IndexType>());
+    vector<IndexType> first_nodes(exec);
+    for (const auto node : order) {
+        if (coarse_map[node] == invalid_index<IndexType>()) {
+            const auto coarse_node =
+                static_cast<IndexType>(first_nodes.size());
+            coarse_map[node] = coarse_node;
+            coarse_map[matches[node]] = coarse_node;
+            first_nodes.push_back(node);
+        }
+    }
+    const auto coarse_size = static_cast<IndexType>(first_nodes.size());
+    coarse.row_ptrs.assign(1, IndexType{});
+    coarse.col_idxs.clear();
+    coarse.edge_weights.clear();
+    coarse.node_weights.assign(coarse_size, IndexType{});
+    coarse.total_weight = fine.total_weight;
+    vector<IndexType> last_seen(coarse_size, invalid_index<IndexType>(), exec);
+    vector<IndexType> edge_positions(coarse_size, exec);
+    for (IndexType coarse_node = 0; coarse_node < coarse_size; coarse_node++) {
+        const auto first = first_nodes[coarse_node];
+        const auto second = matches[first];
+        const int num_members = first == second ? 1 : 2;
+        for (int member = 0; member < num_members; member++) {
+            const auto node = member == 0 ? first : second;
+            coarse.node_weights[coarse_node] += fine.node_weights[node];
+            for (auto nz = row_ptrs[node]; nz < row_ptrs[node + 1]; nz++) {
+                const auto neighbor = coarse_map[col_idxs[nz]];
+                if (neighbor == coarse_node) {
+                    continue;
+                }
+                if (last_seen[neighbor] != coarse_node) {
+                    last_seen[neighbor] = coarse_node;
+                    edge_positions[neighbor] =
+                        static_cast<IndexType>(coarse.col_idxs.size());
+                    coarse.col_idxs.push_back(neighbor);
+                    coarse.edge_weights.push_back(fine.edge_weights[nz]);
+                } else {
+                    coarse.edge_weights[edge_positions[neighbor]] +=
+                        fine.edge_weights[nz];
+                }
+            }
+        }
+        coarse.row_ptrs.push_back(
+            static_cast<IndexType>(coarse.col_idxs.size()));
+    }
+}
+
+
+/**
+ * Greedily moves nodes between the two parts as long as this reduces the
+ * edge cut without violating the balance constraint, or improves the balance
+ * without increasing the edge cut.
+ */
+template <typename IndexType>
+void refine(const weighted_graph<IndexType>& graph, uint8* parts)
+{
+    const auto size = graph.get_size();
+    IndexType part_weights[2]{};
+    IndexType max_node_weight{};
+    for (IndexType node = 0; node < size; node++) {
+        part_weights[parts[node]] += graph.node_weights[node];
+        max_node_weight = std::max(max_node_weight, graph.node_weights[node]);
+    }
+    const auto max_part_weight =
+        std::max(graph.total_weight / 2 + max_node_weight,
+                 graph.total_weight - graph.total_weight * 9 / 20);
+    for (int pass = 0; pass < max_refinement_passes; pass++) {
+        bool moved = false;
+        for (IndexType node = 0; node < size; node++) {
+            const auto part = parts[node];
+            const auto other = 1 - part;
+            IndexType internal{};
+            IndexType external{};
+            for (auto nz = graph.row_ptrs[node]; nz < graph.row_ptrs[node + 1];
+                 nz++) {
+                if (parts[graph.col_idxs[nz]] == part) {
+                    internal += graph.edge_weights[nz];
+                } else {
+                    external += graph.edge_weights[nz];
+                }
+            }
+            const auto weight = graph.node_weights[node];
+            if (external == 0 || part_weights[part] == weight) {
+                continue;
+            }
+            const auto new_weight = part_weights[other] + weight;
+            if ((external > internal && new_weight <= max_part_weight) ||
+                (external == internal && new_weight < part_weights[part])) {
+                parts[node] = static_cast<uint8>(other);
+                part_weights[part] -= weight;
+                part_weights[other] = new_weight;
+                moved = true;
+            }
+        }
+        if (!moved) {
+            break;
+        }
+    }
+}
+
+
+/** Returns the total weight of all edges between the two parts. */
+template <typename IndexType>
+IndexType compute_edge_cut(const weighted_graph<IndexType>& graph,
+                           const uint8* parts)
+{
+    IndexType cut{};
+    for (IndexType node = 0; node < graph.get_size(); node++) {
+        for (auto nz = graph.row_ptrs[node]; nz < graph.row_ptrs[node + 1];
+             nz++) {
+            if (parts[graph.col_idxs[nz]] != parts[node]) {
+                cut += graph.edge_weights[nz];
+            }
+        }
+    }
+    return cut / 2;
+}
+
+
+/**
+ * Grows the first part by breadth-first search from the given node until it
+ * contains half of the total node weight, continuing in other connected
+ * components if necessary.
+ */
+template <typename IndexType>
+void grow_partition(std::shared_ptr<const Executor> exec,
+                    const weighted_graph<IndexType>& graph, IndexType start,
+                    uint8* parts)
+{
+    const auto size = graph.get_size();
+    std::fill_n(parts, size, uint8{1});
+    vector<IndexType> queue(exec);
+    queue.reserve(size);
+    IndexType weight{};
+    IndexType next_unvisited{};
+    parts[start] = 0;
+    queue.push_back(start);
+    size_type head{};
+    while (weight < graph.total_weight / 2) {
+        if (head == queue.size()) {
+            while (parts[next_unvisited] == 0) {
+                next_unvisited++;
+            }
+            parts[next_unvisited] = 0;
+            queue.push_back(next_unvisited);
+        }
+        const auto node = queue[head++];
+        weight += graph.node_weights[node];
+        for (auto nz = graph.row_ptrs[node]; nz < graph.row_ptrs[node + 1];
+             nz++) {
+            const auto neighbor = graph.col_idxs[nz];
+            if (parts[neighbor] != 0) {
+                parts[neighbor] = 0;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+    // the queue may contain nodes that were never processed
+    for (auto i = head; i < queue.size(); i++) {
+        parts[queue[i]] = 1;
+    }
+}
+
+
+/**
+ * Computes an edge bisection of the coarsest graph by trying multiple
+ * starting nodes for graph growing, keeping the one with the smallest cut.
+ */
+template <typename IndexType>
+void initial_partition(std::shared_ptr<const Executor> exec,
+                       const weighted_graph<IndexType>& graph, uint8* parts)
+{
+    const auto size = graph.get_size();
+    vector<uint8> trial_parts(size, exec);
+    auto best_cut = std::numeric_limits<IndexType>::max();
+    for (int trial = 0; trial < num_initial_partitions; trial++) {
+        const auto start = static_cast<IndexType>(
+            static_cast<int64>(size) * trial / num_initial_partitions);
+        grow_partition(exec, graph, start, trial_parts.data());
+        refine(graph, trial_parts.data());
+        const auto cut = compute_edge_cut(graph, trial_parts.data());
+        if (cut < best_cut) {
+            best_cut = cut;
+            std::copy(trial_parts.begin(), trial_parts.end(), parts);
+        }
+    }
+}
+
+
+/**
+ * Turns an edge bisection into a vertex separator by moving the boundary
+ * nodes of the part with the smaller boundary into the separator. Separator
+ * nodes without neighbors in their original part are moved to the other part.
+ */
+template <typename IndexType>
+void compute_vertex_separator(const weighted_graph<IndexType>& graph,
+                              uint8* parts)
+{
+    const auto size = graph.get_size();
+    const auto is_boundary = [&](IndexType node) {
+        for (auto nz = graph.row_ptrs[node]; nz < graph.row_ptrs[node + 1];
+             nz++) {
+            if (parts[graph.col_idxs[nz]] != parts[node]) {
+                return true;
+            }
+        }
+        return false;
+    };
+    IndexType boundary_sizes[2]{};
+    for (IndexType node = 0; node < size; node++) {
+        if (is_boundary(node)) {
+            boundary_sizes[parts[node]]++;
+        }
+    }
+    const uint8 separator_part = boundary_sizes[1] < boundary_sizes[0] ? 1 : 0;
+    const uint8 other_part = 1 - separator_part;
+    const auto separator = static_cast<uint8>(node_part::separator);
+    for (IndexType node = 0; node < size; node++) {
+        if (parts[node] == separator_part && is_boundary(node)) {
+            parts[node] = separator;
+        }
+    }
+    // the boundary check must not see separator nodes as different part, so
+    // we only do this after all separator nodes are known
+    for (IndexType node = 0; node < size; node++) {
+        if (parts[node] != separator) {
+            continue;
+        }
+        bool has_separator_part_neighbor = false;
+        for (auto nz = graph.row_ptrs[node]; nz < graph.row_ptrs[node + 1];
+             nz++) {
+            has_separator_part_neighbor =
+                has_separator_part_neighbor ||
+                parts[graph.col_idxs[nz]] == separator_part;
+        }
+        if (!has_separator_part_neighbor) {
+            parts[node] = other_part;
+        }
+    }
+}
+
+
+/**
+ * Computes a vertex separator of the graph given by its adjacency matrix
+ * (symmetric, without diagonal entries) using multilevel bisection: The graph
+ * is coarsened by heavy-edge matching, the coarsest graph is bisected by
+ * graph growing, and the bisection is refined while projecting it back to the
+ * original graph, where it is finally turned into a vertex separator.
+ *
+ * The matching and the refinement are greedy and sequential: every decision
+ * depends on the ones before it, which keeps the separator identical for all
+ * executors and thread counts. The separator of a single graph is thus
+ * computed by one thread; executors only get parallelism by dissecting
+ * independent subgraphs concurrently.
+ *
+ * @param parts  the output array, after the call it contains the node_part of
+ *               every node.
+ */
+template <typename IndexType>
+void compute_separator(std::shared_ptr<const Executor> exec,
+                       IndexType num_nodes, const IndexType* row_ptrs,
+                       const IndexType* col_idxs, uint8* parts)
+{
+    const auto nnz = row_ptrs[num_nodes];
+    vector<weighted_graph<IndexType>> levels(exec);
+    vector<vector<IndexType>> coarse_maps(exec);
+    levels.emplace_back(exec);
+    auto& graph = levels.back();
+    graph.row_ptrs.assign(row_ptrs, row_ptrs + num_nodes + 1);
+    graph.col_idxs.assign(col_idxs, col_idxs + nnz);
+    graph.edge_weights.assign(nnz, IndexType{1});
+    graph.node_weights.assign(num_nodes, IndexType{1});
+    graph.total_weight = num_nodes;
+    while (levels.back().get_size() > coarsest_size) {
+        weighted_graph<IndexType> coarse{exec};
+        vector<IndexType> coarse_map{exec};
+        coarsen(exec, levels.back(), coarse, coarse_map);
+        const auto fine_size = levels.back().get_size();
+        if (coarse.get_size() >
+            fine_size - fine_size / coarsening_stall_factor) {
+            break;
+        }
+        levels.push_back(std::move(coarse));
+        coarse_maps.push_back(std::move(coarse_map));
+    }
+    vector<uint8> coarse_parts(levels.back().get_size(), exec);
+    initial_partition(exec, levels.back(), coarse_parts.data());
+    for (auto level = coarse_maps.size(); level > 0; level--) {
+        const auto& coarse_map = coarse_maps[level - 1];
+        vector<uint8> fine_parts(coarse_map.size(), exec);
+        for (size_type node = 0; node < coarse_map.size(); node++) {
+            fine_parts[node] = coarse_parts[coarse_map[node]];
+        }
+        refine(levels[level - 1], fine_parts.data());
+        coarse_parts = std::move(fine_parts);
+    }
+    std::copy(coarse_parts.begin(), coarse_parts.end(), parts);
+    compute_vertex_separator(levels.front(), parts);
+}
+
+
+/**
+ * Extracts the subgraph induced by all nodes of the given part.
+ *
+ * @param node_ids  the original node ID of every node in the graph.
+ */
+template <typename IndexType>
+void extract_subgraph(std::shared_ptr<const Executor> exec,
+                      IndexType num_nodes, const IndexType* row_ptrs,
+                      const IndexType* col_idxs, const IndexType* node_ids,
+                      const uint8* parts, node_part part,
+                      vector<IndexType>& sub_row_ptrs,
+                      vector<IndexType>& sub_col_idxs,
+                      vector<IndexType>& sub_node_ids)
+{
+    const auto sub_part = static_cast<uint8>(part);
+    vector<IndexType> local_ids(num_nodes, invalid_index<IndexType>(), exec);
+    sub_node_ids.clear();
+    for (IndexType node = 0; node < num_nodes; node++) {
+        if (parts[node] == sub_part) {
+            local_ids[node] = static_cast<IndexType>(sub_node_ids.size());
+            sub_node_ids.push_back(node_ids[node]);
+        }
+    }
+    sub_row_ptrs.assign(1, IndexType{});
+    sub_col_idxs.clear();
+    for (IndexType node = 0; node < num_nodes; node++) {
+        if (parts[node] != sub_part) {
+            continue;
+        }
+        for (auto nz = row_ptrs[node]; nz < row_ptrs[node + 1]; nz++) {
+            const auto neighbor = col_idxs[nz];
+            if (parts[neighbor] == sub_part) {
+                sub_col_idxs.push_back(local_ids[neighbor]);
+            }
+        }
+        sub_row_ptrs.push_back(static_cast<IndexType>(sub_col_idxs.size()));
+    }
+}
+
+
+}  // namespace bisection
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_GRAPH_BISECTION_HPP_
@@ -8,6 +8,7 @@
 #include <memory>
 
 
+#include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
@@ -19,14 +20,30 @@
 
 
 #include "core/base/allocator.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
 
 
 namespace gko {
 namespace experimental {
 namespace reorder {
+namespace nested_dissection {
 namespace {
 
 
+GKO_REGISTER_OPERATION(compute_permutation,
+                       nested_dissection::compute_permutation);
+
+
+}  // anonymous namespace
+}  // namespace nested_dissection
+
+
+namespace {
+
+
+#if GKO_HAVE_METIS
+
+
 std::string metis_error_message(idx_t metis_error)
 {
     switch (metis_error) {
@@ -107,6 +124,9 @@ void metis_nd<idx_t>(std::shared_ptr<const Executor> host_exec,
 GKO_REGISTER_HOST_OPERATION(metis_nd, metis_nd);
 
 
+#endif  // GKO_HAVE_METIS
+
+
 }  // namespace
 
 
@@ -147,12 +167,22 @@ std::unique_ptr<LinOp> NestedDissection<ValueType, IndexType>::generate_impl(
     const auto host_mtx = make_temporary_clone(host_exec, sparsity_mtx);
     const auto num_rows = host_mtx->get_size()[0];
     array<IndexType> permutation(host_exec, num_rows);
-    array<IndexType> inv_permutation(host_exec, num_rows);
-    exec->run(make_metis_nd(host_exec, num_rows, host_mtx->get_const_row_ptrs(),
-                            host_mtx->get_const_col_idxs(),
-                            build_metis_options(parameters_.options),
-                            permutation.get_data(),
-                            inv_permutation.get_data()));
+    if (parameters_.algorithm == nested_dissection_algorithm::native) {
+        host_exec->run(nested_dissection::make_compute_permutation(
+            static_cast<IndexType>(num_rows), host_mtx->get_const_row_ptrs(),
+            host_mtx->get_const_col_idxs(), permutation.get_data()));
+    } else {
+#if GKO_HAVE_METIS
+        array<IndexType> inv_permutation(host_exec, num_rows);
+        exec->run(make_metis_nd(
+            host_exec, num_rows, host_mtx->get_const_row_ptrs(),
+            host_mtx->get_const_col_idxs(),
+            build_metis_options(parameters_.options), permutation.get_data(),
+            inv_permutation.get_data()));
+#else
+        GKO_NOT_COMPILED(metis);
+#endif
+    }
     permutation.set_executor(exec);
     // we discard the inverse permutation
     return permutation_type::create(exec, std::move(permutation));
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_NESTED_DISSECTION_KERNELS_HPP_
+#define GKO_CORE_REORDER_NESTED_DISSECTION_KERNELS_HPP_
+
+
+#include <ginkgo/core/reorder/nested_dissection.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_NESTED_DISSECTION_COMPUTE_PERMUTATION_KERNEL(IndexType) \
+    void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,  \
+                             IndexType num_rows, const IndexType* row_ptrs, \
+                             const IndexType* col_idxs,                     \
+                             IndexType* permutation)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES \
+    template <typename IndexType>    \
+    GKO_DECLARE_NESTED_DISSECTION_COMPUTE_PERMUTATION_KERNEL(IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(nested_dissection,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_NESTED_DISSECTION_KERNELS_HPP_
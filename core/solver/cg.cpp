@@ -5,6 +5,11 @@
 #include <ginkgo/core/solver/cg.hpp>
 
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
@@ -28,12 +33,144 @@ namespace {
 GKO_REGISTER_OPERATION(initialize, cg::initialize);
 GKO_REGISTER_OPERATION(step_1, cg::step_1);
 GKO_REGISTER_OPERATION(step_2, cg::step_2);
+GKO_REGISTER_OPERATION(gather_columns, cg::gather_columns);
+GKO_REGISTER_OPERATION(scatter_columns, cg::scatter_columns);
+GKO_REGISTER_OPERATION(block_conj_dot, cg::block_conj_dot);
 
 
 }  // anonymous namespace
 }  // namespace cg
 
 
+namespace {
+
+
+/**
+ * Removes all columns that have stopped from the active columns.
+ *
+ * @param stop_status  the stopping status of all columns
+ * @param active_columns  the indices of the columns that are part of the
+ *                        working vectors. The stopped columns are removed.
+ *
+ * @return the positions of the remaining columns within the previous
+ *         active_columns, i.e. within the working vectors.
+ */
+std::vector<size_type> remove_stopped_columns(
+    const array<stopping_status>& stop_status,
+    std::vector<size_type>& active_columns)
+{
+    const array<stopping_status> host_status{
+        stop_status.get_executor()->get_master(), stop_status};
+    std::vector<size_type> positions;
+    for (size_type i = 0; i < active_columns.size(); i++) {
+        const auto col = active_columns[i];
+        if (!host_status.get_const_data()[col].has_stopped()) {
+            active_columns[positions.size()] = col;
+            positions.push_back(i);
+        }
+    }
+    active_columns.resize(positions.size());
+    return positions;
+}
+
+
+array<stopping_status> create_reset_status(
+    std::shared_ptr<const Executor> exec, size_type size)
+{
+    array<stopping_status> host_status{exec->get_master(), size};
+    for (size_type i = 0; i < size; i++) {
+        host_status.get_data()[i].reset();
+    }
+    return array<stopping_status>{exec, host_status};
+}
+
+
+template <typename ValueType>
+std::unique_ptr<matrix::Dense<ValueType>> gather_columns(
+    const array<size_type>& columns, const matrix::Dense<ValueType>* orig)
+{
+    auto exec = orig->get_executor();
+    auto gathered = matrix::Dense<ValueType>::create(
+        exec, dim<2>{orig->get_size()[0], columns.get_size()});
+    exec->run(cg::make_gather_columns(columns, orig, gathered.get()));
+    return gathered;
+}
+
+
+/**
+ * Solves mat * result = rhs for a small dense system on the host using
+ * Gaussian elimination with partial pivoting. The solution components
+ * belonging to numerically zero pivots are set to zero, which deflates
+ * linearly dependent block vectors.
+ */
+template <typename ValueType>
+void solve_small_system(const matrix::Dense<ValueType>* mat,
+                        const matrix::Dense<ValueType>* rhs,
+                        matrix::Dense<ValueType>* result)
+{
+    using std::swap;
+    auto host_exec = mat->get_executor()->get_master();
+    auto host_mat = gko::clone(host_exec, mat);
+    auto host_rhs = gko::clone(host_exec, rhs);
+    const auto size = host_mat->get_size()[0];
+    const auto num_rhs = host_rhs->get_size()[1];
+    remove_complex<ValueType> max_abs{};
+    for (size_type i = 0; i < size; i++) {
+        for (size_type j = 0; j < size; j++) {
+            max_abs = std::max(max_abs, abs(host_mat->at(i, j)));
+        }
+    }
+    const auto tolerance =
+        max_abs * static_cast<remove_complex<ValueType>>(size) *
+        std::numeric_limits<remove_complex<ValueType>>::epsilon();
+    std::vector<bool> singular(size);
+    for (size_type k = 0; k < size; k++) {
+        auto pivot = k;
+        for (auto i = k + 1; i < size; i++) {
+            if (abs(host_mat->at(i, k)) > abs(host_mat->at(pivot, k))) {
+                pivot = i;
+            }
+        }
+        if (abs(host_mat->at(pivot, k)) <= tolerance) {
+            singular[k] = true;
+            continue;
+        }
+        for (size_type j = 0; j < size; j++) {
+            swap(host_mat->at(k, j), host_mat->at(pivot, j));
+        }
+        for (size_type j = 0; j < num_rhs; j++) {
+            swap(host_rhs->at(k, j), host_rhs->at(pivot, j));
+        }
+        for (auto i = k + 1; i < size; i++) {
+            const auto factor = host_mat->at(i, k) / host_mat->at(k, k);
+            for (auto j = k; j < size; j++) {
+                host_mat->at(i, j) -= factor * host_mat->at(k, j);
+            }
+            for (size_type j = 0; j < num_rhs; j++) {
+                host_rhs->at(i, j) -= factor * host_rhs->at(k, j);
+            }
+        }
+    }
+    for (auto k = size; k-- > 0;) {
+        for (size_type j = 0; j < num_rhs; j++) {
+            if (singular[k]) {
+                host_rhs->at(k, j) = zero<ValueType>();
+                continue;
+            }
+            auto value = host_rhs->at(k, j);
+            for (auto i = k + 1; i < size; i++) {
+                value -= host_mat->at(k, i) * host_rhs->at(i, j);
+            }
+            host_rhs->at(k, j) = value / host_mat->at(k, k);
+        }
+    }
+    result->copy_from(host_rhs.get());
+}
+
+
+}  // anonymous namespace
+
+
 template <typename ValueType>
 std::unique_ptr<LinOp> Cg<ValueType>::transpose() const
 {
@@ -41,6 +178,7 @@ std::unique_ptr<LinOp> Cg<ValueType>::transpose() const
         .with_generated_preconditioner(
             share(as<Transposable>(this->get_preconditioner())->transpose()))
         .with_criteria(this->get_stop_criterion_factory())
+        .with_multi_rhs_method(this->get_parameters().multi_rhs_method)
         .on(this->get_executor())
         ->generate(
             share(as<Transposable>(this->get_system_matrix())->transpose()));
@@ -54,6 +192,7 @@ std::unique_ptr<LinOp> Cg<ValueType>::conj_transpose() const
         .with_generated_preconditioner(share(
             as<Transposable>(this->get_preconditioner())->conj_transpose()))
         .with_criteria(this->get_stop_criterion_factory())
+        .with_multi_rhs_method(this->get_parameters().multi_rhs_method)
         .on(this->get_executor())
         ->generate(share(
             as<Transposable>(this->get_system_matrix())->conj_transpose()));
@@ -68,7 +207,7 @@ void Cg<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
     }
     experimental::precision_dispatch_real_complex_distributed<ValueType>(
         [this](auto dense_b, auto dense_x) {
-            this->apply_dense_impl(dense_b, dense_x);
+            this->apply_multi_rhs_impl(dense_b, dense_x);
         },
         b, x);
 }
@@ -168,6 +307,348 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
 }
 
 
+template <typename ValueType>
+void Cg<ValueType>::apply_multi_rhs_impl(
+    const matrix::Dense<ValueType>* dense_b,
+    matrix::Dense<ValueType>* dense_x) const
+{
+    if (dense_b->get_size()[1] <= 1) {
+        this->apply_dense_impl(dense_b, dense_x);
+        return;
+    }
+    switch (parameters_.multi_rhs_method) {
+    case cg::multi_rhs_method::compact:
+        this->apply_compact_impl(dense_b, dense_x);
+        break;
+    case cg::multi_rhs_method::block:
+        this->apply_block_impl(dense_b, dense_x);
+        break;
+    default:
+        this->apply_dense_impl(dense_b, dense_x);
+    }
+}
+
+
+template <typename ValueType>
+void Cg<ValueType>::apply_compact_impl(const matrix::Dense<ValueType>* dense_b,
+                                       matrix::Dense<ValueType>* dense_x) const
+{
+    using std::swap;
+    using LocalVector = matrix::Dense<ValueType>;
+    using NormVector = matrix::Dense<remove_complex<ValueType>>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(z, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+    GKO_SOLVER_VECTOR(q, dense_b);
+
+    GKO_SOLVER_SCALAR(beta, dense_b);
+    GKO_SOLVER_SCALAR(prev_rho, dense_b);
+    GKO_SOLVER_SCALAR(rho, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    exec->run(cg::make_initialize(dense_b, r, z, p, q, prev_rho, rho,
+                                  &stop_status));
+
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+
+    // The working vectors only contain the active columns. As long as all
+    // columns are active, they are the workspace vectors and the solution
+    // itself, afterwards they are owned by the *_storage pointers.
+    auto num_active = dense_b->get_size()[1];
+    std::vector<size_type> host_active_columns(num_active);
+    std::iota(host_active_columns.begin(), host_active_columns.end(),
+              size_type{});
+    array<size_type> active_columns{exec};
+    auto r_c = r;
+    auto z_c = z;
+    auto p_c = p;
+    auto q_c = q;
+    auto x_c = dense_x;
+    auto beta_c = beta;
+    auto prev_rho_c = prev_rho;
+    auto rho_c = rho;
+    auto stop_c = &stop_status;
+    std::unique_ptr<LocalVector> r_storage;
+    std::unique_ptr<LocalVector> z_storage;
+    std::unique_ptr<LocalVector> p_storage;
+    std::unique_ptr<LocalVector> q_storage;
+    std::unique_ptr<LocalVector> x_storage;
+    std::unique_ptr<LocalVector> beta_storage;
+    std::unique_ptr<LocalVector> prev_rho_storage;
+    std::unique_ptr<LocalVector> rho_storage;
+    array<stopping_status> stop_storage{exec};
+    auto res_norm = NormVector::create(exec, dim<2>{1, num_active});
+    std::unique_ptr<NormVector> res_norm_c;
+
+    int iter = -1;
+    while (true) {
+        // z = preconditioner * r
+        this->get_preconditioner()->apply(r_c, z_c);
+        // rho = dot(r, z)
+        r_c->compute_conj_dot(z_c, rho_c, reduction_tmp);
+
+        ++iter;
+        // Once the working vectors are compacted, the stopping criteria only
+        // receive the norms of the compacted residual, scattered into the
+        // norms of all columns. The full residual and solution are only
+        // updated when a column stops.
+        const bool compacted = r_c != r;
+        // rho_c alternates with prev_rho_c, so it needs to be passed on
+        // directly as long as all columns are active
+        auto full_rho = rho_c;
+        if (compacted) {
+            r_c->compute_norm2(res_norm_c.get(), reduction_tmp);
+            exec->run(cg::make_scatter_columns(active_columns, res_norm_c.get(),
+                                               res_norm.get()));
+            exec->run(cg::make_scatter_columns(active_columns, rho_c, rho));
+            full_rho = rho;
+        }
+        const auto& updater = stop_criterion->update();
+        updater.num_iterations(iter).implicit_sq_residual_norm(full_rho);
+        if (compacted) {
+            updater.residual_norm(res_norm);
+        } else {
+            updater.residual(r);
+        }
+        bool all_stopped = updater.check(RelativeStoppingId, true,
+                                         &stop_status, &one_changed);
+        if (compacted && (all_stopped || one_changed)) {
+            exec->run(cg::make_scatter_columns(active_columns, x_c, dense_x));
+            exec->run(cg::make_scatter_columns(active_columns, r_c, r));
+        }
+        if (compacted && !all_stopped) {
+            this->template log<log::Logger::iteration_complete>(
+                this, dense_b, nullptr, iter, nullptr, res_norm.get(),
+                full_rho, &stop_status, all_stopped);
+        } else {
+            this->template log<log::Logger::iteration_complete>(
+                this, dense_b, dense_x, iter, r, nullptr, full_rho,
+                &stop_status, all_stopped);
+        }
+        if (all_stopped) {
+            break;
+        }
+
+        // the stopping criteria also report columns that stopped earlier
+        const auto host_positions =
+            one_changed
+                ? remove_stopped_columns(stop_status, host_active_columns)
+                : std::vector<size_type>{};
+        if (one_changed && host_positions.size() < num_active) {
+            // remove the stopped columns from the working vectors
+            const array<size_type> positions{exec, host_positions.begin(),
+                                             host_positions.end()};
+            active_columns =
+                array<size_type>{exec, host_active_columns.begin(),
+                                 host_active_columns.end()};
+            num_active = host_positions.size();
+            const auto compact = [&](LocalVector*& vec,
+                                     std::unique_ptr<LocalVector>& storage) {
+                storage = gather_columns(positions, vec);
+                vec = storage.get();
+            };
+            compact(r_c, r_storage);
+            compact(z_c, z_storage);
+            compact(p_c, p_storage);
+            compact(x_c, x_storage);
+            compact(prev_rho_c, prev_rho_storage);
+            compact(rho_c, rho_storage);
+            q_storage = LocalVector::create(
+                exec, dim<2>{dense_b->get_size()[0], num_active});
+            q_c = q_storage.get();
+            beta_storage = LocalVector::create(exec, dim<2>{1, num_active});
+            beta_c = beta_storage.get();
+            res_norm_c = NormVector::create(exec, dim<2>{1, num_active});
+            stop_storage = create_reset_status(exec, num_active);
+            stop_c = &stop_storage;
+        }
+
+        // tmp = rho / prev_rho
+        // p = z + tmp * p
+        exec->run(cg::make_step_1(p_c, z_c, rho_c, prev_rho_c, stop_c));
+        // q = A * p
+        this->get_system_matrix()->apply(p_c, q_c);
+        // beta = dot(p, q)
+        p_c->compute_conj_dot(q_c, beta_c, reduction_tmp);
+        // tmp = rho / beta
+        // x = x + tmp * p
+        // r = r - tmp * q
+        exec->run(cg::make_step_2(x_c, r_c, p_c, q_c, beta_c, rho_c, stop_c));
+        swap(prev_rho_c, rho_c);
+        swap(prev_rho_storage, rho_storage);
+    }
+}
+
+
+template <typename ValueType>
+void Cg<ValueType>::apply_block_impl(const matrix::Dense<ValueType>* dense_b,
+                                     matrix::Dense<ValueType>* dense_x) const
+{
+    using std::swap;
+    using LocalVector = matrix::Dense<ValueType>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(z, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+    GKO_SOLVER_VECTOR(q, dense_b);
+
+    GKO_SOLVER_SCALAR(prev_rho, dense_b);
+    GKO_SOLVER_SCALAR(rho, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    exec->run(cg::make_initialize(dense_b, r, z, p, q, prev_rho, rho,
+                                  &stop_status));
+
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+
+    // The block vectors only contain the active columns, see
+    // apply_compact_impl.
+    const auto num_rows = dense_b->get_size()[0];
+    auto num_active = dense_b->get_size()[1];
+    std::vector<size_type> host_active_columns(num_active);
+    std::iota(host_active_columns.begin(), host_active_columns.end(),
+              size_type{});
+    array<size_type> active_columns{exec};
+    auto r_c = r;
+    auto z_c = z;
+    auto p_c = p;
+    auto q_c = q;
+    auto x_c = dense_x;
+    auto rho_c = rho;
+    std::unique_ptr<LocalVector> r_storage;
+    std::unique_ptr<LocalVector> z_storage;
+    std::unique_ptr<LocalVector> p_storage;
+    std::unique_ptr<LocalVector> q_storage;
+    std::unique_ptr<LocalVector> x_storage;
+    std::unique_ptr<LocalVector> rho_storage;
+    // block coefficients of size num_active x num_active
+    auto rz = LocalVector::create(exec, dim<2>{num_active, num_active});
+    auto prev_rz = LocalVector::create(exec, dim<2>{num_active, num_active});
+    auto pq = LocalVector::create(exec, dim<2>{num_active, num_active});
+    auto coeffs = LocalVector::create(exec, dim<2>{num_active, num_active});
+    bool restart = true;
+
+    int iter = -1;
+    while (true) {
+        // Z = preconditioner * R
+        this->get_preconditioner()->apply(r_c, z_c);
+        // rho = diag(R^H Z)
+        r_c->compute_conj_dot(z_c, rho_c, reduction_tmp);
+        if (r_c != r) {
+            exec->run(cg::make_scatter_columns(active_columns, r_c, r));
+            exec->run(cg::make_scatter_columns(active_columns, rho_c, rho));
+        }
+
+        ++iter;
+        bool all_stopped =
+            stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .implicit_sq_residual_norm(rho)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed);
+        this->template log<log::Logger::iteration_complete>(
+            this, dense_b, dense_x, iter, r, nullptr, rho, &stop_status,
+            all_stopped);
+        if (all_stopped) {
+            if (x_c != dense_x) {
+                exec->run(
+                    cg::make_scatter_columns(active_columns, x_c, dense_x));
+            }
+            break;
+        }
+
+        // the stopping criteria also report columns that stopped earlier
+        const auto host_positions =
+            one_changed
+                ? remove_stopped_columns(stop_status, host_active_columns)
+                : std::vector<size_type>{};
+        if (one_changed && host_positions.size() < num_active) {
+            // deflate the stopped columns and restart the search directions
+            if (x_c != dense_x) {
+                exec->run(
+                    cg::make_scatter_columns(active_columns, x_c, dense_x));
+            }
+            const array<size_type> positions{exec, host_positions.begin(),
+                                             host_positions.end()};
+            active_columns =
+                array<size_type>{exec, host_active_columns.begin(),
+                                 host_active_columns.end()};
+            num_active = host_positions.size();
+            const auto compact = [&](LocalVector*& vec,
+                                     std::unique_ptr<LocalVector>& storage) {
+                storage = gather_columns(positions, vec);
+                vec = storage.get();
+            };
+            compact(r_c, r_storage);
+            compact(z_c, z_storage);
+            compact(x_c, x_storage);
+            compact(rho_c, rho_storage);
+            p_storage = LocalVector::create(exec, dim<2>{num_rows, num_active});
+            p_c = p_storage.get();
+            q_storage = LocalVector::create(exec, dim<2>{num_rows, num_active});
+            q_c = q_storage.get();
+            rz = LocalVector::create(exec, dim<2>{num_active, num_active});
+            prev_rz = LocalVector::create(exec, dim<2>{num_active, num_active});
+            pq = LocalVector::create(exec, dim<2>{num_active, num_active});
+            coeffs = LocalVector::create(exec, dim<2>{num_active, num_active});
+            restart = true;
+        }
+
+        // rz = R^H Z
+        exec->run(cg::make_block_conj_dot(r_c, z_c, rz.get(), reduction_tmp));
+        if (restart) {
+            // P = Z
+            p_c->copy_from(z_c);
+            restart = false;
+        } else {
+            // beta = prev_rz^-1 rz
+            // P = Z + P beta
+            solve_small_system(prev_rz.get(), rz.get(), coeffs.get());
+            q_c->copy_from(z_c);
+            p_c->apply(one_op, coeffs, one_op, q_c);
+            swap(p_c, q_c);
+            swap(p_storage, q_storage);
+        }
+        // Q = A * P
+        this->get_system_matrix()->apply(p_c, q_c);
+        // pq = P^H Q
+        exec->run(cg::make_block_conj_dot(p_c, q_c, pq.get(), reduction_tmp));
+        // alpha = pq^-1 rz
+        // X = X + P alpha
+        // R = R - Q alpha
+        solve_small_system(pq.get(), rz.get(), coeffs.get());
+        p_c->apply(one_op, coeffs, one_op, x_c);
+        q_c->apply(neg_one_op, coeffs, one_op, r_c);
+        swap(prev_rz, rz);
+    }
+}
+
+
 template <typename ValueType>
 void Cg<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
                                const LinOp* beta, LinOp* x) const
@@ -178,7 +659,7 @@ void Cg<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
     experimental::precision_dispatch_real_complex_distributed<ValueType>(
         [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
             auto x_clone = dense_x->clone();
-            this->apply_dense_impl(dense_b, x_clone.get());
+            this->apply_multi_rhs_impl(dense_b, x_clone.get());
             dense_x->scale(dense_beta);
             dense_x->add_scaled(dense_alpha, x_clone);
         },
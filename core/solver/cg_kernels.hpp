@@ -50,13 +50,40 @@ namespace cg {
                 const array<stopping_status>* stop_status)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES             \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_INITIALIZE_KERNEL(ValueType); \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_STEP_1_KERNEL(ValueType);     \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_STEP_2_KERNEL(ValueType)
+#define GKO_DECLARE_CG_GATHER_COLUMNS_KERNEL(_type)                  \
+    void gather_columns(std::shared_ptr<const DefaultExecutor> exec, \
+                        const array<size_type>& columns,             \
+                        const matrix::Dense<_type>* orig,            \
+                        matrix::Dense<_type>* gathered)
+
+
+#define GKO_DECLARE_CG_SCATTER_COLUMNS_KERNEL(_type)                  \
+    void scatter_columns(std::shared_ptr<const DefaultExecutor> exec, \
+                         const array<size_type>& columns,             \
+                         const matrix::Dense<_type>* gathered,        \
+                         matrix::Dense<_type>* orig)
+
+
+#define GKO_DECLARE_CG_BLOCK_CONJ_DOT_KERNEL(_type)                  \
+    void block_conj_dot(std::shared_ptr<const DefaultExecutor> exec, \
+                        const matrix::Dense<_type>* x,               \
+                        const matrix::Dense<_type>* y,               \
+                        matrix::Dense<_type>* result, array<char>& tmp)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                  \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_INITIALIZE_KERNEL(ValueType);      \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_STEP_1_KERNEL(ValueType);          \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_STEP_2_KERNEL(ValueType);          \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_GATHER_COLUMNS_KERNEL(ValueType);  \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_SCATTER_COLUMNS_KERNEL(ValueType); \
+    template <typename ValueType>                     \
+    GKO_DECLARE_CG_BLOCK_CONJ_DOT_KERNEL(ValueType)
 
 
 }  // namespace cg
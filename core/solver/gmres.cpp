@@ -34,6 +34,8 @@ GKO_REGISTER_OPERATION(restart, gmres::restart);
 GKO_REGISTER_OPERATION(hessenberg_qr, common_gmres::hessenberg_qr);
 GKO_REGISTER_OPERATION(solve_krylov, common_gmres::solve_krylov);
 GKO_REGISTER_OPERATION(multi_axpy, gmres::multi_axpy);
+GKO_REGISTER_OPERATION(multi_dot, gmres::multi_dot);
+GKO_REGISTER_OPERATION(multi_sub, gmres::multi_sub);
 
 
 }  // anonymous namespace
@@ -49,6 +51,7 @@ std::unique_ptr<LinOp> Gmres<ValueType>::transpose() const
         .with_criteria(this->get_stop_criterion_factory())
         .with_krylov_dim(this->get_krylov_dim())
         .with_flexible(this->get_parameters().flexible)
+        .with_ortho_method(this->get_parameters().ortho_method)
         .on(this->get_executor())
         ->generate(
             share(as<Transposable>(this->get_system_matrix())->transpose()));
@@ -64,6 +67,7 @@ std::unique_ptr<LinOp> Gmres<ValueType>::conj_transpose() const
         .with_criteria(this->get_stop_criterion_factory())
         .with_krylov_dim(this->get_krylov_dim())
         .with_flexible(this->get_parameters().flexible)
+        .with_ortho_method(this->get_parameters().ortho_method)
         .on(this->get_executor())
         ->generate(share(
             as<Transposable>(this->get_system_matrix())->conj_transpose()));
@@ -127,6 +131,7 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
     auto exec = this->get_executor();
     this->setup_workspace();
     const auto is_flexible = this->get_parameters().flexible;
+    const auto ortho_method = this->get_parameters().ortho_method;
     const auto num_rows = this->get_size()[0];
     const auto local_num_rows =
         ::gko::detail::get_local(dense_b)->get_size()[0];
@@ -164,6 +169,12 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
     auto next_krylov_norm_tmp = this->template create_workspace_op<NormVector>(
         ws::next_krylov_norm_tmp,
         dim<2>{1, is_complex_s<ValueType>::value ? num_rhs : 0});
+    // hessenberg_aux is only required for the block orthogonalization, whose
+    // reduction results need to be stored contiguously
+    auto hessenberg_aux = this->template create_workspace_op<LocalVector>(
+        ws::hessenberg_aux,
+        dim<2>{ortho_method == gmres::ortho_method::mgs ? 0 : krylov_dim + 1,
+               num_rhs});
 
     GKO_SOLVER_VECTOR(before_preconditioner, dense_x);
     GKO_SOLVER_VECTOR(after_preconditioner, dense_x);
@@ -212,6 +223,12 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
      *       1x axpys          3(k+1)n in iteration k (0-based)
      *       1x norm2               n
      *       1x scal               2n
+     * CGS (CGS2 twice for the block operations):
+     *                    (d+7)n = sum k=0 to d-1 of (2k+8)n/d
+     *       1x block dot       (k+2)n in iteration k (0-based)
+     *       1x block axpy      (k+3)n in iteration k (0-based)
+     *       1x norm2               n
+     *       1x scal               2n
      * Restart:         (1+14/d)n  (every dth iteration)
      *       1x gemv           (d+1)n
      *       1x Preconditioner     2n * values + storage
@@ -307,19 +324,56 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
         this->get_system_matrix()->apply(preconditioned_krylov_vector,
                                          next_krylov);
 
-        for (size_type i = 0; i <= restart_iter; i++) {
-            // orthogonalize against krylov_bases(:, i):
-            // hessenberg(i, restart_iter) = next_krylov' * krylov_bases(:, i)
-            // next_krylov -= hessenberg(i, restart_iter) * krylov_bases(:, i)
-            auto hessenberg_entry = hessenberg_iter->create_submatrix(
-                span{i, i + 1}, span{0, num_rhs});
-            auto krylov_basis = ::gko::detail::create_submatrix_helper(
+        if (ortho_method == gmres::ortho_method::mgs) {
+            for (size_type i = 0; i <= restart_iter; i++) {
+                // orthogonalize against krylov_bases(:, i):
+                // hessenberg(i, restart_iter) =
+                //     next_krylov' * krylov_bases(:, i)
+                // next_krylov -=
+                //     hessenberg(i, restart_iter) * krylov_bases(:, i)
+                auto hessenberg_entry = hessenberg_iter->create_submatrix(
+                    span{i, i + 1}, span{0, num_rhs});
+                auto krylov_basis = ::gko::detail::create_submatrix_helper(
+                    krylov_bases, dim<2>{num_rows, num_rhs},
+                    span{local_num_rows * i, local_num_rows * (i + 1)},
+                    span{0, num_rhs});
+                next_krylov->compute_conj_dot(krylov_basis, hessenberg_entry,
+                                              reduction_tmp);
+                next_krylov->sub_scaled(hessenberg_entry, krylov_basis);
+            }
+        } else {
+            // orthogonalize against krylov_bases(:, 0:restart_iter) at once,
+            // twice for cgs2:
+            // hessenberg_aux = krylov_bases(:, 0:restart_iter)' * next_krylov
+            // next_krylov -= krylov_bases(:, 0:restart_iter) * hessenberg_aux
+            // hessenberg(0:restart_iter, restart_iter) += hessenberg_aux
+            auto krylov_bases_small = ::gko::detail::create_submatrix_helper(
                 krylov_bases, dim<2>{num_rows, num_rhs},
-                span{local_num_rows * i, local_num_rows * (i + 1)},
+                span{0, local_num_rows * (restart_iter + 1)},
                 span{0, num_rhs});
-            next_krylov->compute_conj_dot(krylov_basis, hessenberg_entry,
-                                          reduction_tmp);
-            next_krylov->sub_scaled(hessenberg_entry, krylov_basis);
+            auto hessenberg_aux_iter = hessenberg_aux->create_submatrix(
+                span{0, restart_iter + 1}, span{0, num_rhs});
+            auto hessenberg_proj = hessenberg_iter->create_submatrix(
+                span{0, restart_iter + 1}, span{0, num_rhs});
+            const int num_passes =
+                ortho_method == gmres::ortho_method::cgs2 ? 2 : 1;
+            for (int pass = 0; pass < num_passes; pass++) {
+                exec->run(gmres::make_multi_dot(
+                    gko::detail::get_local(krylov_bases_small.get()),
+                    gko::detail::get_local(next_krylov.get()),
+                    hessenberg_aux_iter.get(), reduction_tmp));
+                gko::detail::all_reduce_sum(dense_b,
+                                            hessenberg_aux_iter.get());
+                exec->run(gmres::make_multi_sub(
+                    gko::detail::get_local(krylov_bases_small.get()),
+                    hessenberg_aux_iter.get(),
+                    gko::detail::get_local(next_krylov.get())));
+                if (pass == 0) {
+                    hessenberg_proj->copy_from(hessenberg_aux_iter);
+                } else {
+                    hessenberg_proj->add_scaled(one_op, hessenberg_aux_iter);
+                }
+            }
         }
         // normalize next_krylov:
         // hessenberg(restart_iter+1, restart_iter) = norm(next_krylov)
@@ -427,7 +481,7 @@ int workspace_traits<Gmres<ValueType>>::num_arrays(const Solver&)
 template <typename ValueType>
 int workspace_traits<Gmres<ValueType>>::num_vectors(const Solver&)
 {
-    return 15;
+    return 16;
 }
 
 
@@ -449,7 +503,8 @@ std::vector<std::string> workspace_traits<Gmres<ValueType>>::op_names(
             "one",
             "minus_one",
             "next_krylov_norm_tmp",
-            "preconditioned_krylov_bases"};
+            "preconditioned_krylov_bases",
+            "hessenberg_aux"};
 }
 
 
@@ -464,10 +519,10 @@ std::vector<std::string> workspace_traits<Gmres<ValueType>>::array_names(
 template <typename ValueType>
 std::vector<int> workspace_traits<Gmres<ValueType>>::scalars(const Solver&)
 {
-    return {hessenberg,          givens_sin,
-            givens_cos,          residual_norm_collection,
-            residual_norm,       y,
-            next_krylov_norm_tmp};
+    return {hessenberg,           givens_sin,
+            givens_cos,           residual_norm_collection,
+            residual_norm,        y,
+            next_krylov_norm_tmp, hessenberg_aux};
 }
 
 
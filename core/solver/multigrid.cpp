@@ -15,6 +15,9 @@
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/base/utils_helper.hpp>
+#include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/preconditioner/schwarz.hpp>
+#include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/factorization/lu.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/preconditioner/jacobi.hpp>
@@ -27,6 +30,7 @@
 
 #include "core/base/dispatch_helper.hpp"
 #include "core/components/fill_array_kernels.hpp"
+#include "core/distributed/helpers.hpp"
 #include "core/solver/ir_kernels.hpp"
 #include "core/solver/multigrid_kernels.hpp"
 #include "core/solver/solver_base.hpp"
@@ -101,6 +105,96 @@ auto as_real_vec(std::shared_ptr<LinOp> x)
 }
 
 
+#if GINKGO_BUILD_MPI
+
+
+/**
+ * run_distributed_matrix casts the input to a distributed matrix with the given
+ * value type and any of the supported index types and passes it to the given
+ * function.
+ */
+template <typename ValueType, typename Func>
+auto run_distributed_matrix(const LinOp* op, Func&& f)
+{
+    using experimental::distributed::Matrix;
+    return run<const Matrix<ValueType, int32, int32>*,
+               const Matrix<ValueType, int32, int64>*,
+               const Matrix<ValueType, int64, int64>*>(op,
+                                                       std::forward<Func>(f));
+}
+
+
+#endif
+
+
+/**
+ * create_vector creates a dense or distributed vector with nrhs columns, whose
+ * rows are distributed in the same way as the rows of the given operator.
+ */
+template <typename ValueType>
+std::shared_ptr<LinOp> create_vector(std::shared_ptr<const Executor> exec,
+                                     const LinOp* op, size_type nrhs)
+{
+    const auto num_rows = op->get_size()[0];
+#if GINKGO_BUILD_MPI
+    if (gko::detail::is_distributed(op)) {
+        return run_distributed_matrix<ValueType>(
+            op, [&](auto mtx) -> std::shared_ptr<LinOp> {
+                return experimental::distributed::Vector<ValueType>::create(
+                    exec, mtx->get_communicator(), dim<2>{num_rows, nrhs},
+                    dim<2>{mtx->get_local_matrix()->get_size()[0], nrhs});
+            });
+    }
+#endif
+    return matrix::Dense<ValueType>::create(exec, dim<2>{num_rows, nrhs});
+}
+
+
+/**
+ * fill_zero sets all entries of a dense or distributed vector to zero.
+ */
+template <typename ValueType>
+void fill_zero(LinOp* x)
+{
+    gko::detail::vector_dispatch<ValueType>(
+        x, [](auto vec) { vec->fill(zero<ValueType>()); });
+}
+
+
+/**
+ * build_jacobi gives the scalar Jacobi factory for the given matrix. For a
+ * distributed matrix, it is applied to the rank-local blocks by Schwarz.
+ */
+template <typename ValueType>
+std::shared_ptr<const LinOpFactory> build_jacobi(
+    std::shared_ptr<const Executor> exec, const LinOp* op)
+{
+#if GINKGO_BUILD_MPI
+    if (gko::detail::is_distributed(op)) {
+        return run_distributed_matrix<ValueType>(
+            op, [&](auto mtx) -> std::shared_ptr<const LinOpFactory> {
+                using matrix_type = std::decay_t<decltype(*mtx)>;
+                using local_index_type =
+                    typename matrix_type::local_index_type;
+                using global_index_type =
+                    typename matrix_type::global_index_type;
+                return experimental::distributed::preconditioner::Schwarz<
+                           ValueType, local_index_type, global_index_type>::
+                    build()
+                        .with_local_solver(
+                            preconditioner::Jacobi<ValueType,
+                                                   local_index_type>::build()
+                                .with_max_block_size(1u))
+                        .on(exec);
+            });
+    }
+#endif
+    return preconditioner::Jacobi<ValueType>::build()
+        .with_max_block_size(1u)
+        .on(exec);
+}
+
+
 /**
  * handle_list generate the smoother for each MultigridLevel
  *
@@ -116,9 +210,7 @@ void handle_list(
     auto list_size = smoother_list.size();
     auto gen_default_smoother = [&] {
         auto exec = matrix->get_executor();
-        return share(build_smoother(preconditioner::Jacobi<ValueType>::build()
-                                        .with_max_block_size(1u)
-                                        .on(exec),
+        return share(build_smoother(build_jacobi<ValueType>(exec, matrix.get()),
                                     iteration,
                                     casting<ValueType>(relaxation_factor))
                          ->generate(matrix));
@@ -216,12 +308,12 @@ struct MultigridState {
      *
      * @param level  the current level index
      * @param cycle  the multigrid cycle
-     * @param current_nrows  the number of rows of current fine matrix
-     * @param next_nrows  the number of rows of next coarse matrix
+     * @param fine_op  the fine matrix of the current level
+     * @param coarse_op  the coarse matrix of the current level
      */
     template <typename ValueType>
     void allocate_memory(int level, multigrid::cycle cycle,
-                         size_type current_nrows, size_type next_nrows);
+                         const LinOp* fine_op, const LinOp* coarse_op);
 
     /**
      * run the cycle of the level
@@ -271,7 +363,6 @@ void MultigridState::generate(const LinOp* system_matrix_in,
     system_matrix = system_matrix_in;
     multigrid = multigrid_in;
     nrhs = nrhs_in;
-    auto current_nrows = system_matrix->get_size()[0];
     auto mg_level_list = multigrid->get_mg_level_list();
     auto list_size = mg_level_list.size();
     auto cycle = multigrid->get_cycle();
@@ -283,50 +374,44 @@ void MultigridState::generate(const LinOp* system_matrix_in,
     clear_and_reserve(neg_one_list, list_size);
     // Allocate memory first such that reusing allocation in each iter.
     for (int i = 0; i < mg_level_list.size(); i++) {
-        auto next_nrows = mg_level_list.at(i)->get_coarse_op()->get_size()[0];
         auto mg_level = mg_level_list.at(i);
 
         run<gko::multigrid::EnableMultigridLevel, float, double,
             std::complex<float>, std::complex<double>>(
             mg_level,
-            [&, this](auto mg_level, auto i, auto cycle, auto current_nrows,
-                      auto next_nrows) {
+            [&, this](auto mg_level, auto i, auto cycle) {
                 using value_type =
                     typename std::decay_t<decltype(*mg_level)>::value_type;
-                using vec = matrix::Dense<value_type>;
-                this->allocate_memory<value_type>(i, cycle, current_nrows,
-                                                  next_nrows);
-                auto exec = as<LinOp>(multigrid->get_mg_level_list().at(i))
-                                ->get_executor();
+                this->allocate_memory<value_type>(
+                    i, cycle, mg_level->get_fine_op().get(),
+                    mg_level->get_coarse_op().get());
             },
-            i, cycle, current_nrows, next_nrows);
-
-        current_nrows = next_nrows;
+            i, cycle);
     }
 }
 
 
 template <typename ValueType>
 void MultigridState::allocate_memory(int level, multigrid::cycle cycle,
-                                     size_type current_nrows,
-                                     size_type next_nrows)
+                                     const LinOp* fine_op,
+                                     const LinOp* coarse_op)
 {
     using vec = matrix::Dense<ValueType>;
     using norm_vec = matrix::Dense<remove_complex<ValueType>>;
 
     auto exec =
         as<LinOp>(multigrid->get_mg_level_list().at(level))->get_executor();
-    r_list.emplace_back(vec::create(exec, dim<2>{current_nrows, nrhs}));
+    r_list.emplace_back(create_vector<ValueType>(exec, fine_op, nrhs));
     if (level != 0) {
         // allocate the previous level
-        g_list.emplace_back(vec::create(exec, dim<2>{current_nrows, nrhs}));
-        e_list.emplace_back(vec::create(exec, dim<2>{current_nrows, nrhs}));
+        g_list.emplace_back(create_vector<ValueType>(exec, fine_op, nrhs));
+        e_list.emplace_back(create_vector<ValueType>(exec, fine_op, nrhs));
         next_one_list.emplace_back(initialize<vec>({one<ValueType>()}, exec));
     }
     if (level + 1 == multigrid->get_mg_level_list().size()) {
         // the last level allocate the g, e for coarsest solver
-        g_list.emplace_back(vec::create(exec, dim<2>{next_nrows, nrhs}));
-        e_list.emplace_back(vec::create(exec, dim<2>{next_nrows, nrhs}));
+        g_list.emplace_back(create_vector<ValueType>(exec, coarse_op, nrhs));
+        e_list.emplace_back(create_vector<ValueType>(exec, coarse_op, nrhs));
         next_one_list.emplace_back(initialize<vec>({one<ValueType>()}, exec));
     }
     one_list.emplace_back(initialize<vec>({one<ValueType>()}, exec));
@@ -392,8 +477,7 @@ void MultigridState::run_cycle(multigrid::cycle cycle, size_type level,
             } else {
                 // x in first level is already filled by zero outside.
                 if (level != 0) {
-                    dynamic_cast<matrix::Dense<ValueType>*>(x)->fill(
-                        zero<ValueType>());
+                    fill_zero<ValueType>(x);
                 }
                 pre_smoother->apply(b, x);
             }
@@ -414,7 +498,7 @@ void MultigridState::run_cycle(multigrid::cycle cycle, size_type level,
     // next level
     if (level + 1 == total_level) {
         // the coarsest solver use the last level valuetype
-        as_vec<ValueType>(e)->fill(zero<ValueType>());
+        fill_zero<ValueType>(e.get());
     }
     auto next_level_matrix =
         (level + 1 < total_level)
@@ -537,7 +621,9 @@ void Multigrid::generate()
             // TODO: maybe remove fixed index type
             auto gen_default_solver = [&]() -> std::unique_ptr<LinOp> {
                 // TODO: unify when dpcpp supports direct solver
-                if (dynamic_cast<const DpcppExecutor*>(exec.get())) {
+                // the direct solver does not support distributed matrices
+                if (dynamic_cast<const DpcppExecutor*>(exec.get()) ||
+                    gko::detail::is_distributed(matrix.get())) {
                     using absolute_value_type = remove_complex<value_type>;
                     return solver::Gmres<value_type>::build()
                         .with_criteria(
@@ -551,8 +637,7 @@ void Multigrid::generate()
                         .with_krylov_dim(
                             std::min(size_type(100), matrix->get_size()[0]))
                         .with_preconditioner(
-                            preconditioner::Jacobi<value_type>::build()
-                                .with_max_block_size(1u))
+                            build_jacobi<value_type>(exec, matrix.get()))
                         .on(exec)
                         ->generate(matrix);
                 } else {
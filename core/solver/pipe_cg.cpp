@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/pipe_cg.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/distributed/helpers.hpp"
+#include "core/solver/pipe_cg_kernels.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace pipe_cg {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, pipe_cg::initialize);
+GKO_REGISTER_OPERATION(compute_dots, pipe_cg::compute_dots);
+GKO_REGISTER_OPERATION(step, pipe_cg::step);
+
+
+}  // anonymous namespace
+}  // namespace pipe_cg
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeCg<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeCg<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void PipeCg<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                         VectorType* dense_x) const
+{
+    using std::swap;
+    using LocalVector = matrix::Dense<ValueType>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    const auto num_rhs = dense_b->get_size()[1];
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(z, dense_b);
+    GKO_SOLVER_VECTOR(w, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+    GKO_SOLVER_VECTOR(s, dense_b);
+
+    // rho and delta are stored back-to-back, so a single reduction computes
+    // both of them
+    auto rho_delta = this->template create_workspace_scalar<ValueType>(
+        GKO_SOLVER_TRAITS::rho_delta, 2 * num_rhs);
+    auto prev_rho_delta = this->template create_workspace_scalar<ValueType>(
+        GKO_SOLVER_TRAITS::prev_rho_delta, 2 * num_rhs);
+    GKO_SOLVER_SCALAR(alpha, dense_b);
+    GKO_SOLVER_SCALAR(prev_alpha, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    // views on the rho part of rho_delta for the stopping criterion
+    auto create_rho_view = [&](LocalVector* values) {
+        return LocalVector::create(
+            exec, dim<2>{1, num_rhs},
+            make_array_view(exec, num_rhs, values->get_values()), num_rhs);
+    };
+    auto rho = create_rho_view(rho_delta);
+    auto prev_rho = create_rho_view(prev_rho_delta);
+
+    // r = dense_b
+    // prev_rho = 1.0
+    // prev_alpha = 0.0
+    // z = w = p = s = 0
+    exec->run(pipe_cg::make_initialize(
+        gko::detail::get_local(dense_b), gko::detail::get_local(r),
+        gko::detail::get_local(z), gko::detail::get_local(w),
+        gko::detail::get_local(p), gko::detail::get_local(s), prev_rho_delta,
+        prev_alpha, &stop_status));
+
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+
+    int iter = -1;
+    /* Memory movement summary:
+     * 17n * values + matrix/preconditioner storage
+     * 1x SpMV:           2n * values + storage
+     * 1x Preconditioner: 2n * values + storage
+     * 1x fused dots      3n
+     * 1x step (axpys)   10n
+     */
+    while (true) {
+        // z = preconditioner * r
+        this->get_preconditioner()->apply(r, z);
+        // w = A * z
+        this->get_system_matrix()->apply(z, w);
+        // rho = dot(r, z)
+        // delta = dot(z, w)
+        exec->run(pipe_cg::make_compute_dots(
+            gko::detail::get_local(r), gko::detail::get_local(z),
+            gko::detail::get_local(w), rho_delta, reduction_tmp));
+        gko::detail::all_reduce_sum(dense_b, rho_delta);
+
+        ++iter;
+        bool all_stopped =
+            stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .implicit_sq_residual_norm(rho.get())
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed);
+        this->template log<log::Logger::iteration_complete>(
+            this, dense_b, dense_x, iter, r, nullptr, rho.get(), &stop_status,
+            all_stopped);
+        if (all_stopped) {
+            break;
+        }
+
+        // beta = rho / prev_rho
+        // alpha = rho / (delta - beta * rho / prev_alpha)
+        // p = z + beta * p
+        // s = w + beta * s
+        // x = x + alpha * p
+        // r = r - alpha * s
+        exec->run(pipe_cg::make_step(
+            gko::detail::get_local(dense_x), gko::detail::get_local(r),
+            gko::detail::get_local(p), gko::detail::get_local(s),
+            gko::detail::get_local(z), gko::detail::get_local(w), rho_delta,
+            prev_rho_delta, prev_alpha, alpha, &stop_status));
+        swap(prev_rho_delta, rho_delta);
+        swap(prev_rho, rho);
+        swap(prev_alpha, alpha);
+    }
+}
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                   const LinOp* beta, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeCg<ValueType>>::num_arrays(const Solver&)
+{
+    return 2;
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeCg<ValueType>>::num_vectors(const Solver&)
+{
+    return 11;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeCg<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "r",     "z",          "w",   "p",         "s",         "rho_delta",
+        "prev_rho_delta",      "alpha",            "prev_alpha",
+        "one",   "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeCg<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop", "tmp"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeCg<ValueType>>::scalars(const Solver&)
+{
+    return {rho_delta, prev_rho_delta, alpha, prev_alpha};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeCg<ValueType>>::vectors(const Solver&)
+{
+    return {r, z, w, p, s};
+}
+
+
+#define GKO_DECLARE_PIPE_CG(_type) class PipeCg<_type>
+#define GKO_DECLARE_PIPE_CG_TRAITS(_type) \
+    struct workspace_traits<PipeCg<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
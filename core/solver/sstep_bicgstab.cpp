@@ -0,0 +1,295 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/sstep_bicgstab.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/distributed/helpers.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+#include "core/solver/sstep_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace sstep {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, sstep::initialize);
+GKO_REGISTER_OPERATION(compute_gram, sstep::compute_gram);
+GKO_REGISTER_OPERATION(bicgstab_coefficients, sstep::bicgstab_coefficients);
+GKO_REGISTER_OPERATION(combine_basis, sstep::combine_basis);
+
+
+}  // anonymous namespace
+}  // namespace sstep
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> SstepBicgstab<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_steps(this->get_steps())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> SstepBicgstab<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_steps(this->get_steps())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void SstepBicgstab<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void SstepBicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                                VectorType* dense_x) const
+{
+    using LocalVector = matrix::Dense<ValueType>;
+    using ws = workspace_traits<SstepBicgstab>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    const auto steps = this->get_steps();
+    // the basis consists of the search direction part p, ..., K^(2s) p and
+    // the residual part r, ..., K^(2s-1) r
+    const auto num_vectors = 4 * steps + 1;
+    const auto residual_begin = 2 * steps + 1;
+    const auto num_rows = this->get_size()[0];
+    const auto local_num_rows =
+        ::gko::detail::get_local(dense_b)->get_size()[0];
+    const auto num_rhs = dense_b->get_size()[1];
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+    // the shadow residual is stored after the basis vectors, so the inner
+    // products with it are computed by the same reduction
+    auto basis = this->create_workspace_op_with_type_of(
+        ws::basis, dense_b, dim<2>{num_rows * (num_vectors + 1), num_rhs},
+        dim<2>{local_num_rows * (num_vectors + 1), num_rhs});
+    auto preconditioned_basis = this->create_workspace_op_with_type_of(
+        ws::preconditioned_basis, dense_b,
+        dim<2>{num_rows * num_vectors, num_rhs},
+        dim<2>{local_num_rows * num_vectors, num_rhs});
+    auto gram = this->template create_workspace_op<LocalVector>(
+        ws::gram, dim<2>{(num_vectors + 1) * num_vectors, num_rhs});
+    // coefficients of x, p, r, A M p and A M s in the basis, stored
+    // back-to-back
+    auto coeffs = this->template create_workspace_op<LocalVector>(
+        ws::coeffs, dim<2>{5 * num_vectors, num_rhs});
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    auto create_basis_view = [&](VectorType* vectors, size_type begin,
+                                 size_type end) {
+        return ::gko::detail::create_submatrix_helper(
+            vectors, dim<2>{num_rows * (end - begin), num_rhs},
+            span{local_num_rows * begin, local_num_rows * end},
+            span{0, num_rhs});
+    };
+    std::vector<std::unique_ptr<VectorType>> basis_vectors;
+    std::vector<std::unique_ptr<VectorType>> preconditioned_vectors;
+    for (size_type i = 0; i < num_vectors; i++) {
+        basis_vectors.emplace_back(create_basis_view(basis, i, i + 1));
+        preconditioned_vectors.emplace_back(
+            create_basis_view(preconditioned_basis, i, i + 1));
+    }
+    auto shadow_r = create_basis_view(basis, num_vectors, num_vectors + 1);
+    auto basis_without_shadow_r = create_basis_view(basis, 0, num_vectors);
+    auto create_coeffs_view = [&](size_type i) {
+        return coeffs->create_submatrix(
+            span{i * num_vectors, (i + 1) * num_vectors}, span{0, num_rhs});
+    };
+    auto x_coeffs = create_coeffs_view(0);
+    auto p_coeffs = create_coeffs_view(1);
+
+    // r = dense_b
+    exec->run(sstep::make_initialize(gko::detail::get_local(dense_b),
+                                     gko::detail::get_local(r), &stop_status));
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    // p = shadow_r = r
+    p->copy_from(r);
+    shadow_r->copy_from(r);
+    // the last vectors of both parts are never needed in preconditioned form,
+    // their coefficients in the solution update are always zero
+    preconditioned_vectors[residual_begin - 1]->fill(zero<ValueType>());
+    preconditioned_vectors[num_vectors - 1]->fill(zero<ValueType>());
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+
+    int iter = 0;
+    while (true) {
+        // matrix powers kernel:
+        // basis = [p, A M p, ..., r, A M r, ...]
+        // preconditioned_basis = preconditioner * basis
+        basis_vectors[0]->copy_from(p);
+        basis_vectors[residual_begin]->copy_from(r);
+        for (size_type i = 0; i + 1 < num_vectors; i++) {
+            if (i + 1 != residual_begin) {
+                this->get_preconditioner()->apply(basis_vectors[i],
+                                                  preconditioned_vectors[i]);
+                this->get_system_matrix()->apply(preconditioned_vectors[i],
+                                                 basis_vectors[i + 1]);
+            }
+        }
+        // gram = [basis, shadow_r]^H * basis in a single reduction
+        exec->run(sstep::make_compute_gram(
+            local_num_rows, gko::detail::get_local(basis),
+            gko::detail::get_local(basis_without_shadow_r.get()), gram,
+            reduction_tmp));
+        gko::detail::all_reduce_sum(dense_b, gram);
+
+        bool all_stopped =
+            stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed);
+        this->template log<log::Logger::iteration_complete>(
+            this, dense_b, dense_x, iter, r, nullptr, nullptr, &stop_status,
+            all_stopped);
+        if (all_stopped) {
+            break;
+        }
+
+        // run s BiCGSTAB iterations on the coordinates in the basis
+        exec->run(sstep::make_bicgstab_coefficients(steps, gram, coeffs));
+        // x = x + preconditioned_basis * x_coeffs
+        // p = basis * p_coeffs
+        exec->run(sstep::make_combine_basis(
+            local_num_rows, gko::detail::get_local(preconditioned_basis),
+            x_coeffs.get(), gko::detail::get_local(dense_x), true,
+            &stop_status));
+        exec->run(sstep::make_combine_basis(
+            local_num_rows,
+            gko::detail::get_local(basis_without_shadow_r.get()),
+            p_coeffs.get(), gko::detail::get_local(p), false, &stop_status));
+        // r = b - A x, replacing the recursively updated residual avoids
+        // the growing gap between computed and true residual caused by the
+        // monomial basis at the cost of one SpMV per s iterations
+        r->copy_from(dense_b);
+        this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+        iter += steps;
+    }
+}
+
+
+template <typename ValueType>
+void SstepBicgstab<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                          const LinOp* beta, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<SstepBicgstab<ValueType>>::num_arrays(const Solver&)
+{
+    return 2;
+}
+
+
+template <typename ValueType>
+int workspace_traits<SstepBicgstab<ValueType>>::num_vectors(const Solver&)
+{
+    return 8;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<SstepBicgstab<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "r",      "p",   "basis",     "preconditioned_basis", "gram",
+        "coeffs", "one", "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string>
+workspace_traits<SstepBicgstab<ValueType>>::array_names(const Solver&)
+{
+    return {"stop", "tmp"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<SstepBicgstab<ValueType>>::scalars(
+    const Solver&)
+{
+    return {gram, coeffs};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<SstepBicgstab<ValueType>>::vectors(
+    const Solver&)
+{
+    return {r, p, basis, preconditioned_basis};
+}
+
+
+#define GKO_DECLARE_SSTEP_BICGSTAB(_type) class SstepBicgstab<_type>
+#define GKO_DECLARE_SSTEP_BICGSTAB_TRAITS(_type) \
+    struct workspace_traits<SstepBicgstab<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_BICGSTAB);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_BICGSTAB_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
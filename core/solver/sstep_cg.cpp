@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/sstep_cg.hpp>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+
+#include "core/distributed/helpers.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+#include "core/solver/sstep_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace sstep {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, sstep::initialize);
+GKO_REGISTER_OPERATION(compute_gram, sstep::compute_gram);
+GKO_REGISTER_OPERATION(cg_coefficients, sstep::cg_coefficients);
+GKO_REGISTER_OPERATION(combine_basis, sstep::combine_basis);
+
+
+}  // anonymous namespace
+}  // namespace sstep
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> SstepCg<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_steps(this->get_steps())
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> SstepCg<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_steps(this->get_steps())
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void SstepCg<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void SstepCg<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                          VectorType* dense_x) const
+{
+    using LocalVector = matrix::Dense<ValueType>;
+    using ws = workspace_traits<SstepCg>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    const auto steps = this->get_steps();
+    const auto num_vectors = 2 * steps + 1;
+    const auto num_rows = this->get_size()[0];
+    const auto local_num_rows =
+        ::gko::detail::get_local(dense_b)->get_size()[0];
+    const auto num_rhs = dense_b->get_size()[1];
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+    GKO_SOLVER_VECTOR(q, dense_b);
+    auto basis = this->create_workspace_op_with_type_of(
+        ws::basis, dense_b, dim<2>{num_rows * num_vectors, num_rhs},
+        dim<2>{local_num_rows * num_vectors, num_rhs});
+    auto preconditioned_basis = this->create_workspace_op_with_type_of(
+        ws::preconditioned_basis, dense_b,
+        dim<2>{num_rows * num_vectors, num_rhs},
+        dim<2>{local_num_rows * num_vectors, num_rhs});
+    auto gram = this->template create_workspace_op<LocalVector>(
+        ws::gram, dim<2>{num_vectors * num_vectors, num_rhs});
+    // coefficients of x, p, r and A p in the basis, stored back-to-back
+    auto coeffs = this->template create_workspace_op<LocalVector>(
+        ws::coeffs, dim<2>{4 * num_vectors, num_rhs});
+    GKO_SOLVER_SCALAR(rho, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    std::vector<std::unique_ptr<VectorType>> basis_vectors;
+    std::vector<std::unique_ptr<VectorType>> preconditioned_vectors;
+    for (size_type i = 0; i < num_vectors; i++) {
+        const span rows{local_num_rows * i, local_num_rows * (i + 1)};
+        basis_vectors.emplace_back(::gko::detail::create_submatrix_helper(
+            basis, dim<2>{num_rows, num_rhs}, rows, span{0, num_rhs}));
+        preconditioned_vectors.emplace_back(
+            ::gko::detail::create_submatrix_helper(
+                preconditioned_basis, dim<2>{num_rows, num_rhs}, rows,
+                span{0, num_rhs}));
+    }
+    auto create_coeffs_view = [&](size_type i) {
+        return coeffs->create_submatrix(
+            span{i * num_vectors, (i + 1) * num_vectors}, span{0, num_rhs});
+    };
+    auto x_coeffs = create_coeffs_view(0);
+    auto p_coeffs = create_coeffs_view(1);
+
+    // r = dense_b
+    exec->run(sstep::make_initialize(gko::detail::get_local(dense_b),
+                                     gko::detail::get_local(r), &stop_status));
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    // q = r
+    // p = preconditioner * r
+    q->copy_from(r);
+    this->get_preconditioner()->apply(r, p);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+
+    int iter = 0;
+    while (true) {
+        // matrix powers kernel:
+        // basis = [q, A p, ..., r, A z, ...]
+        // preconditioned_basis = preconditioner * basis = [p, ..., z, ...]
+        basis_vectors[0]->copy_from(q);
+        preconditioned_vectors[0]->copy_from(p);
+        basis_vectors[steps + 1]->copy_from(r);
+        for (size_type i = 1; i < num_vectors; i++) {
+            if (i != steps + 1) {
+                this->get_system_matrix()->apply(preconditioned_vectors[i - 1],
+                                                 basis_vectors[i]);
+            }
+            this->get_preconditioner()->apply(basis_vectors[i],
+                                              preconditioned_vectors[i]);
+        }
+        // gram = preconditioned_basis^H * basis in a single reduction
+        exec->run(sstep::make_compute_gram(
+            local_num_rows, gko::detail::get_local(preconditioned_basis),
+            gko::detail::get_local(basis), gram, reduction_tmp));
+        gko::detail::all_reduce_sum(dense_b, gram);
+        // rho = dot(r, z)
+        // run s CG iterations on the coordinates in the basis
+        exec->run(sstep::make_cg_coefficients(steps, gram, coeffs, rho));
+
+        bool all_stopped =
+            stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .implicit_sq_residual_norm(rho)
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed);
+        this->template log<log::Logger::iteration_complete>(
+            this, dense_b, dense_x, iter, r, nullptr, rho, &stop_status,
+            all_stopped);
+        if (all_stopped) {
+            break;
+        }
+
+        // x = x + preconditioned_basis * x_coeffs
+        // p = preconditioned_basis * p_coeffs
+        // q = basis * p_coeffs
+        exec->run(sstep::make_combine_basis(
+            local_num_rows, gko::detail::get_local(preconditioned_basis),
+            x_coeffs.get(), gko::detail::get_local(dense_x), true,
+            &stop_status));
+        exec->run(sstep::make_combine_basis(
+            local_num_rows, gko::detail::get_local(preconditioned_basis),
+            p_coeffs.get(), gko::detail::get_local(p), false, &stop_status));
+        exec->run(sstep::make_combine_basis(
+            local_num_rows, gko::detail::get_local(basis), p_coeffs.get(),
+            gko::detail::get_local(q), false, &stop_status));
+        // r = b - A x, replacing the recursively updated residual avoids
+        // the growing gap between computed and true residual caused by the
+        // monomial basis at the cost of one SpMV per s iterations
+        r->copy_from(dense_b);
+        this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+        iter += steps;
+    }
+}
+
+
+template <typename ValueType>
+void SstepCg<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                    const LinOp* beta, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<SstepCg<ValueType>>::num_arrays(const Solver&)
+{
+    return 2;
+}
+
+
+template <typename ValueType>
+int workspace_traits<SstepCg<ValueType>>::num_vectors(const Solver&)
+{
+    return 10;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<SstepCg<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "r",    "p",      "q",   "basis", "preconditioned_basis",
+        "gram", "coeffs", "rho", "one",   "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<SstepCg<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop", "tmp"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<SstepCg<ValueType>>::scalars(const Solver&)
+{
+    return {gram, coeffs, rho};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<SstepCg<ValueType>>::vectors(const Solver&)
+{
+    return {r, p, q, basis, preconditioned_basis};
+}
+
+
+#define GKO_DECLARE_SSTEP_CG(_type) class SstepCg<_type>
+#define GKO_DECLARE_SSTEP_CG_TRAITS(_type) \
+    struct workspace_traits<SstepCg<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_CG);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_CG_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
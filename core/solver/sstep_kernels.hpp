@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_SOLVER_SSTEP_KERNELS_HPP_
+#define GKO_CORE_SOLVER_SSTEP_KERNELS_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/stopping_status.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace sstep {
+
+
+#define GKO_DECLARE_SSTEP_INITIALIZE_KERNEL(_type)                          \
+    void initialize(std::shared_ptr<const DefaultExecutor> exec,            \
+                    const matrix::Dense<_type>* b, matrix::Dense<_type>* r, \
+                    array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_SSTEP_COMPUTE_GRAM_KERNEL(_type)                        \
+    void compute_gram(std::shared_ptr<const DefaultExecutor> exec,          \
+                      size_type num_rows, const matrix::Dense<_type>* left, \
+                      const matrix::Dense<_type>* right,                    \
+                      matrix::Dense<_type>* gram, array<char>& tmp)
+
+
+#define GKO_DECLARE_SSTEP_CG_COEFFICIENTS_KERNEL(_type)                     \
+    void cg_coefficients(std::shared_ptr<const DefaultExecutor> exec,       \
+                         size_type steps, const matrix::Dense<_type>* gram, \
+                         matrix::Dense<_type>* coeffs,                      \
+                         matrix::Dense<_type>* rho)
+
+
+#define GKO_DECLARE_SSTEP_BICGSTAB_COEFFICIENTS_KERNEL(_type)               \
+    void bicgstab_coefficients(std::shared_ptr<const DefaultExecutor> exec, \
+                               size_type steps,                             \
+                               const matrix::Dense<_type>* gram,            \
+                               matrix::Dense<_type>* coeffs)
+
+
+#define GKO_DECLARE_SSTEP_COMBINE_BASIS_KERNEL(_type)                         \
+    void combine_basis(std::shared_ptr<const DefaultExecutor> exec,           \
+                       size_type num_rows, const matrix::Dense<_type>* basis, \
+                       const matrix::Dense<_type>* coeffs,                    \
+                       matrix::Dense<_type>* result, bool accumulate,         \
+                       const array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                           \
+    template <typename ValueType>                              \
+    GKO_DECLARE_SSTEP_INITIALIZE_KERNEL(ValueType);            \
+    template <typename ValueType>                              \
+    GKO_DECLARE_SSTEP_COMPUTE_GRAM_KERNEL(ValueType);          \
+    template <typename ValueType>                              \
+    GKO_DECLARE_SSTEP_CG_COEFFICIENTS_KERNEL(ValueType);       \
+    template <typename ValueType>                              \
+    GKO_DECLARE_SSTEP_BICGSTAB_COEFFICIENTS_KERNEL(ValueType); \
+    template <typename ValueType>                              \
+    GKO_DECLARE_SSTEP_COMBINE_BASIS_KERNEL(ValueType)
+
+
+}  // namespace sstep
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(sstep, GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_SSTEP_KERNELS_HPP_
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/base/concurrent_matrix_assembly_data.hpp>
+
+
+#include <thread>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/matrix_assembly_data.hpp>
+
+
+namespace {
+
+
+TEST(ConcurrentMatrixAssemblyData, InitializesWithZeros)
+{
+    gko::concurrent_matrix_assembly_data<double, int> m(gko::dim<2>{3, 5});
+
+    ASSERT_EQ(m.get_size(), gko::dim<2>(3, 5));
+    ASSERT_GT(m.get_num_shards(), 0);
+    ASSERT_EQ(m.get_num_stored_elements(), 0);
+    ASSERT_EQ(m.get_value(0, 0), 0.0);
+    ASSERT_FALSE(m.contains(0, 0));
+}
+
+
+TEST(ConcurrentMatrixAssemblyData, InsertsValuesWithAdding)
+{
+    gko::concurrent_matrix_assembly_data<double, int> m(gko::dim<2>{3, 5}, 2);
+
+    m.add_value(0, 0, 1.3);
+    m.add_value(2, 3, 2.2);
+    m.add_value(1, 4, 1.1);
+    m.add_value(1, 2, 3.6);
+    m.add_value(1, 4, 9.1);
+    m.add_value(2, 3, 1.3);
+
+    ASSERT_EQ(m.get_num_shards(), 2);
+    ASSERT_EQ(m.get_num_stored_elements(), 4);
+    ASSERT_EQ(m.get_value(0, 0), 1.3);
+    ASSERT_EQ(m.get_value(2, 3), 3.5);
+    ASSERT_EQ(m.get_value(1, 4), 10.2);
+    ASSERT_EQ(m.get_value(1, 2), 3.6);
+    ASSERT_TRUE(m.contains(1, 2));
+    ASSERT_FALSE(m.contains(1, 3));
+}
+
+
+TEST(ConcurrentMatrixAssemblyData, OverwritesValuesWhenNotAdding)
+{
+    gko::concurrent_matrix_assembly_data<double, int> m(gko::dim<2>{3, 5}, 2);
+
+    m.set_value(0, 0, 1.3);
+    m.set_value(2, 3, 2.2);
+    m.set_value(1, 4, 1.1);
+    m.set_value(1, 2, 3.6);
+    m.set_value(1, 4, 9.1);
+    m.set_value(2, 3, 1.4);
+
+    ASSERT_EQ(m.get_num_stored_elements(), 4);
+    ASSERT_EQ(m.get_value(0, 0), 1.3);
+    ASSERT_EQ(m.get_value(2, 3), 1.4);
+    ASSERT_EQ(m.get_value(1, 4), 9.1);
+    ASSERT_EQ(m.get_value(1, 2), 3.6);
+}
+
+
+TEST(ConcurrentMatrixAssemblyData, GetsSortedData)
+{
+    gko::concurrent_matrix_assembly_data<double, int> m(gko::dim<2>{3, 5}, 2);
+    std::vector<gko::matrix_data<double, int>::nonzero_type> reference{
+        {0, 0, 1.3}, {1, 2, 3.6}, {1, 4, 1.1}, {2, 3, 2.2}};
+    m.set_value(0, 0, 1.3);
+    m.set_value(2, 3, 2.2);
+    m.set_value(1, 4, 1.1);
+    m.set_value(1, 2, 3.6);
+
+    auto sorted = m.get_ordered_data();
+
+    ASSERT_EQ(sorted.size, m.get_size());
+    ASSERT_EQ(sorted.nonzeros, reference);
+}
+
+
+TEST(ConcurrentMatrixAssemblyData, KeepsValuesWhenGrowing)
+{
+    gko::concurrent_matrix_assembly_data<double, int> m(
+        gko::dim<2>{100, 100}, 3);
+    gko::matrix_assembly_data<double, int> reference(gko::dim<2>{100, 100});
+    m.reserve(10);
+
+    for (int i = 0; i < 5000; i++) {
+        const auto row = (i * 7) % 100;
+        const auto col = (i * 13) % 97;
+        m.add_value(row, col, i);
+        reference.add_value(row, col, i);
+    }
+
+    ASSERT_EQ(m.get_num_stored_elements(),
+              reference.get_num_stored_elements());
+    ASSERT_EQ(m.get_ordered_data().nonzeros,
+              reference.get_ordered_data().nonzeros);
+}
+
+
+TEST(ConcurrentMatrixAssemblyData, AddsValuesConcurrently)
+{
+    const int num_threads = 8;
+    const int num_rows = 200;
+    gko::concurrent_matrix_assembly_data<double, int> m(
+        gko::dim<2>{num_rows, num_rows}, 4);
+    gko::matrix_assembly_data<double, int> reference(
+        gko::dim<2>{num_rows, num_rows});
+    // every thread adds the same tridiagonal element contributions, so all
+    // entries are contended
+    const auto assemble = [num_rows](auto& data) {
+        for (int row = 0; row < num_rows - 1; row++) {
+            data.add_value(row, row, 1.0);
+            data.add_value(row, row + 1, -1.0);
+            data.add_value(row + 1, row, -1.0);
+            data.add_value(row + 1, row + 1, 1.0);
+        }
+    };
+    for (int i = 0; i < num_threads; i++) {
+        assemble(reference);
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; i++) {
+        threads.emplace_back([&] { assemble(m); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // all values are small integers, so the result is exact
+    ASSERT_EQ(m.get_ordered_data().nonzeros,
+              reference.get_ordered_data().nonzeros);
+}
+
+
+}  // namespace
@@ -5,7 +5,10 @@
 #include <ginkgo/core/base/mtx_io.hpp>
 
 
+#include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <limits>
 #include <sstream>
 
 
@@ -15,10 +18,12 @@
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
 
 #include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
 
 
 namespace {
@@ -1157,6 +1162,205 @@ TYPED_TEST(DenseTest, WritesToStreamDefault)
 }
 
 
+template <typename ValueIndexType>
+class BinaryCsr : public ::testing::Test {
+protected:
+    using value_type = typename std::tuple_element<0, ValueIndexType>::type;
+    using index_type = typename std::tuple_element<1, ValueIndexType>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    BinaryCsr()
+        : ref(gko::ReferenceExecutor::create()),
+          // 3 rows and 5 nonzeros, so the arrays need padding
+          mtx(gko::initialize<Csr>({{1.0, 0.0, 2.0, 0.0},
+                                    {0.0, 0.0, 0.0, 0.0},
+                                    {3.0, 4.0, 0.0, -5.0}},
+                                   ref)),
+          filename("binary_csr_" + std::to_string(sizeof(value_type)) +
+                   (gko::is_complex<value_type>() ? "c_" : "r_") +
+                   std::to_string(sizeof(index_type)) + ".bin")
+    {}
+
+    ~BinaryCsr() { std::remove(filename.c_str()); }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::unique_ptr<Csr> mtx;
+    std::string filename;
+};
+
+TYPED_TEST_SUITE(BinaryCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(BinaryCsr, WritesAlignedArrays)
+{
+    using index_type = typename TestFixture::index_type;
+    std::ostringstream oss{};
+
+    gko::write_binary_csr(oss, this->mtx.get());
+
+    const auto str = oss.str();
+    const auto col_idxs_offset =
+        32 + (4 * sizeof(index_type) + 15) / 16 * 16;
+    const auto values_offset =
+        col_idxs_offset + (5 * sizeof(index_type) + 15) / 16 * 16;
+    ASSERT_EQ(str.substr(0, 6), "GKOCSR");
+    ASSERT_EQ(str.size(),
+              values_offset + 5 * sizeof(typename TestFixture::value_type));
+    ASSERT_EQ(std::memcmp(str.data() + 32, this->mtx->get_const_row_ptrs(),
+                          4 * sizeof(index_type)),
+              0);
+    ASSERT_EQ(std::memcmp(str.data() + col_idxs_offset,
+                          this->mtx->get_const_col_idxs(),
+                          5 * sizeof(index_type)),
+              0);
+    ASSERT_EQ(std::memcmp(str.data() + values_offset,
+                          this->mtx->get_const_values(),
+                          5 * sizeof(typename TestFixture::value_type)),
+              0);
+}
+
+
+TYPED_TEST(BinaryCsr, WritesAndReadsFromStream)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::ostringstream oss{};
+
+    gko::write_binary_csr(oss, this->mtx.get());
+    std::istringstream iss{oss.str()};
+    auto result = gko::read_binary_csr<value_type, index_type>(this->ref, iss);
+
+    GKO_ASSERT_MTX_NEAR(result, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryCsr, WritesAndReadsFromFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    {
+        std::ofstream ofs{this->filename, std::ios::binary};
+        gko::write_binary_csr(ofs, this->mtx.get());
+    }
+
+    auto result =
+        gko::read_binary_csr<value_type, index_type>(this->ref, this->filename);
+
+    GKO_ASSERT_MTX_NEAR(result, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(BinaryCsr, ReadFromFileIsModifiable)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    {
+        std::ofstream ofs{this->filename, std::ios::binary};
+        gko::write_binary_csr(ofs, this->mtx.get());
+    }
+    auto result =
+        gko::read_binary_csr<value_type, index_type>(this->ref, this->filename);
+
+    result->scale(gko::initialize<gko::matrix::Dense<value_type>>(
+        {value_type{2.0}}, this->ref));
+
+    // the file itself is not modified
+    auto result2 =
+        gko::read_binary_csr<value_type, index_type>(this->ref, this->filename);
+    GKO_ASSERT_MTX_NEAR(result2, this->mtx, 0.0);
+    GKO_ASSERT_MTX_NEAR(result,
+                        l<value_type>({{2.0, 0.0, 4.0, 0.0},
+                                       {0.0, 0.0, 0.0, 0.0},
+                                       {6.0, 8.0, 0.0, -10.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(BinaryCsr, FailsReadingMatrixDataBinary)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::ostringstream oss{};
+    gko::write_binary(oss, this->mtx);
+    std::istringstream iss{oss.str()};
+
+    ASSERT_THROW((gko::read_binary_csr<value_type, index_type>(this->ref, iss)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryCsr, FailsReadingDecreasingRowPtrs)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::ostringstream oss{};
+    gko::write_binary_csr(oss, this->mtx.get());
+    auto str = oss.str();
+    // row_ptrs = {0, 2, 2, 5} becomes {0, 4, 2, 5}
+    const index_type row_ptr{4};
+    std::memcpy(&str[32 + sizeof(index_type)], &row_ptr, sizeof(index_type));
+    std::istringstream iss{str};
+
+    ASSERT_THROW((gko::read_binary_csr<value_type, index_type>(this->ref, iss)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryCsr, FailsReadingOutOfBoundsColumn)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    const auto col_idxs_offset = 32 + (4 * sizeof(index_type) + 15) / 16 * 16;
+    for (index_type col : {-1, 4}) {
+        SCOPED_TRACE(col);
+        std::ostringstream oss{};
+        gko::write_binary_csr(oss, this->mtx.get());
+        auto str = oss.str();
+        std::memcpy(&str[col_idxs_offset + 2 * sizeof(index_type)], &col,
+                    sizeof(index_type));
+        std::istringstream iss{str};
+
+        ASSERT_THROW(
+            (gko::read_binary_csr<value_type, index_type>(this->ref, iss)),
+            gko::StreamError);
+    }
+}
+
+
+TYPED_TEST(BinaryCsr, FailsReadingOversizedFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    std::ostringstream oss{};
+    gko::write_binary_csr(oss, this->mtx.get());
+    auto str = oss.str();
+    // the number of entries is the largest allowed value, so the layout
+    // overflows or exceeds the file size
+    const gko::uint64 num_entries = std::numeric_limits<index_type>::max();
+    std::memcpy(&str[24], &num_entries, sizeof(num_entries));
+    {
+        std::ofstream ofs{this->filename, std::ios::binary};
+        ofs << str;
+    }
+
+    ASSERT_THROW((gko::read_binary_csr<value_type, index_type>(
+                     this->ref, this->filename)),
+                 gko::StreamError);
+}
+
+
+TYPED_TEST(BinaryCsr, FailsReadingMissingFile)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+
+    ASSERT_THROW((gko::read_binary_csr<value_type, index_type>(
+                     this->ref, "this_file_does_not_exist.bin")),
+                 gko::StreamError);
+}
+
+
 template <typename ValueIndexType>
 class ComplexDummyLinOpTest : public ::testing::Test {
 protected:
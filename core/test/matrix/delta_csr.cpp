@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class DeltaCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    DeltaCsr()
+        : exec(gko::ReferenceExecutor::create()), mtx(Mtx::create(exec))
+    {
+        mtx->read(mat_data{gko::dim<2>{2, 400},
+                           {{0, 0, 1.0},
+                            {0, 1, 3.0},
+                            {0, 2, 2.0},
+                            {1, 1, 5.0},
+                            {1, 399, 4.0}}});
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+
+    void assert_equal_to_original_mtx(gko::ptr_param<const Mtx> m)
+    {
+        auto v = m->get_const_values();
+        auto r = m->get_const_row_ptrs();
+        auto b = m->get_const_row_bases();
+        auto p = m->get_const_compressed_idx_ptrs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(2, 400));
+        ASSERT_EQ(m->get_num_stored_elements(), 5);
+        ASSERT_EQ(m->get_num_compressed_idx_bytes(), 7);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 3);
+        EXPECT_EQ(r[2], 5);
+        EXPECT_EQ(b[0], 0);
+        EXPECT_EQ(b[1], 1);
+        EXPECT_EQ(p[0], 0);
+        EXPECT_EQ(p[1], 3);
+        EXPECT_EQ(p[2], 7);
+        EXPECT_EQ(v[0], value_type{1.0});
+        EXPECT_EQ(v[1], value_type{3.0});
+        EXPECT_EQ(v[2], value_type{2.0});
+        EXPECT_EQ(v[3], value_type{5.0});
+        EXPECT_EQ(v[4], value_type{4.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_num_compressed_idx_bytes(), 0);
+        ASSERT_EQ(m->get_const_values(), nullptr);
+        ASSERT_EQ(m->get_const_compressed_idxs(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        ASSERT_NE(m->get_const_compressed_idx_ptrs(), nullptr);
+    }
+};
+
+TYPED_TEST_SUITE(DeltaCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(DeltaCsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(2, 400));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 5);
+}
+
+
+TYPED_TEST(DeltaCsr, ContainsCorrectData)
+{
+    this->assert_equal_to_original_mtx(this->mtx);
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->move_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(copy);
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCloned)
+{
+    auto clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(this->mtx);
+    this->assert_equal_to_original_mtx(clone);
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(DeltaCsr, CanBeWritten)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using tpl = typename gko::matrix_data<value_type, index_type>::nonzero_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 400));
+    ASSERT_EQ(data.nonzeros.size(), 5);
+    EXPECT_EQ(data.nonzeros[0], tpl(0, 0, value_type{1.0}));
+    EXPECT_EQ(data.nonzeros[1], tpl(0, 1, value_type{3.0}));
+    EXPECT_EQ(data.nonzeros[2], tpl(0, 2, value_type{2.0}));
+    EXPECT_EQ(data.nonzeros[3], tpl(1, 1, value_type{5.0}));
+    EXPECT_EQ(data.nonzeros[4], tpl(1, 399, value_type{4.0}));
+}
+
+
+}  // namespace
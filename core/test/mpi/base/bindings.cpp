@@ -2,7 +2,9 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 
 #include <gtest/gtest.h>
@@ -1422,6 +1424,73 @@ TYPED_TEST(MpiBindings, NonBlockingAllToAllVWorksCorrectly)
 }
 
 
+TYPED_TEST(MpiBindings, NonBlockingNeighborAllToAllVWorksCorrectly)
+{
+    auto comm = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
+    auto my_rank = comm.rank();
+    auto num_ranks = comm.size();
+    // ring: receive from the previous rank, send to the next rank
+    int source = (my_rank + num_ranks - 1) % num_ranks;
+    int destination = (my_rank + 1) % num_ranks;
+    auto graph_comm =
+        comm.create_dist_graph_adjacent(1, &source, 1, &destination);
+    auto send_array = gko::array<TypeParam>{
+        this->ref, std::initializer_list<TypeParam>{
+                       static_cast<TypeParam>(my_rank),
+                       static_cast<TypeParam>(my_rank + 1)}};
+    auto recv_array = gko::array<TypeParam>{this->ref, {0, 0, 0}};
+    auto ref_array = gko::array<TypeParam>{
+        this->ref, std::initializer_list<TypeParam>{
+                       0, static_cast<TypeParam>(source),
+                       static_cast<TypeParam>(source + 1)}};
+    int count = 2;
+    int send_offset = 0;
+    int recv_offset = 1;
+
+    auto req = graph_comm.i_neighbor_all_to_all_v(
+        this->ref, send_array.get_data(), &count, &send_offset,
+        recv_array.get_data(), &count, &recv_offset);
+
+    req.wait();
+    GKO_ASSERT_ARRAY_EQ(recv_array, ref_array);
+}
+
+
+TYPED_TEST(MpiBindings, WaitAnyReturnsEveryRequestOnce)
+{
+    auto comm = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
+    auto my_rank = comm.rank();
+    auto num_ranks = comm.size();
+    auto recv_array = gko::array<TypeParam>{this->ref,
+                                            static_cast<gko::size_type>(
+                                                num_ranks)};
+    auto send_value = static_cast<TypeParam>(my_rank + 1);
+    std::vector<gko::experimental::mpi::request> recv_reqs;
+    std::vector<gko::experimental::mpi::request> send_reqs;
+    for (int rank = 0; rank < num_ranks; ++rank) {
+        recv_reqs.push_back(comm.i_recv(
+            this->ref, recv_array.get_data() + rank, 1, rank, 0));
+    }
+    for (int rank = 0; rank < num_ranks; ++rank) {
+        send_reqs.push_back(comm.i_send(this->ref, &send_value, 1, rank, 0));
+    }
+
+    std::vector<int> completed;
+    for (int i = 0; i < num_ranks; ++i) {
+        completed.push_back(gko::experimental::mpi::wait_any(recv_reqs));
+    }
+    gko::experimental::mpi::wait_all(send_reqs);
+
+    std::sort(completed.begin(), completed.end());
+    for (int rank = 0; rank < num_ranks; ++rank) {
+        ASSERT_EQ(completed[rank], rank);
+        ASSERT_EQ(recv_array.get_data()[rank],
+                  static_cast<TypeParam>(rank + 1));
+    }
+    ASSERT_EQ(gko::experimental::mpi::wait_any(recv_reqs), MPI_UNDEFINED);
+}
+
+
 TYPED_TEST(MpiBindings, CanScanValues)
 {
     auto comm = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
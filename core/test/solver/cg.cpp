@@ -273,4 +273,31 @@ TYPED_TEST(Cg, PassExplicitFactory)
 }
 
 
+TYPED_TEST(Cg, DefaultsToIndependentMultiRhsMethod)
+{
+    ASSERT_EQ(this->cg_factory->get_parameters().multi_rhs_method,
+              gko::solver::cg::multi_rhs_method::independent);
+}
+
+
+TYPED_TEST(Cg, TransposeKeepsMultiRhsMethod)
+{
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_multi_rhs_method(gko::solver::cg::multi_rhs_method::compact)
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto transposed = gko::as<Solver>(solver->transpose());
+    auto conj_transposed = gko::as<Solver>(solver->conj_transpose());
+
+    ASSERT_EQ(transposed->get_parameters().multi_rhs_method,
+              gko::solver::cg::multi_rhs_method::compact);
+    ASSERT_EQ(conj_transposed->get_parameters().multi_rhs_method,
+              gko::solver::cg::multi_rhs_method::compact);
+}
+
+
 }  // namespace
@@ -233,6 +233,36 @@ TYPED_TEST(Gmres, CanSetKrylovDimAgain)
 }
 
 
+TYPED_TEST(Gmres, DefaultsToModifiedGramSchmidt)
+{
+    using Solver = typename TestFixture::Solver;
+
+    auto gmres_factory = Solver::build().on(this->exec);
+
+    ASSERT_EQ(gmres_factory->get_parameters().ortho_method,
+              gko::solver::gmres::ortho_method::mgs);
+}
+
+
+TYPED_TEST(Gmres, CanSetOrthoMethod)
+{
+    using Solver = typename TestFixture::Solver;
+    auto gmres_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(4u))
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .on(this->exec);
+    auto solver = gmres_factory->generate(this->mtx);
+
+    auto transposed = gko::as<Solver>(solver->transpose());
+
+    ASSERT_EQ(solver->get_parameters().ortho_method,
+              gko::solver::gmres::ortho_method::cgs2);
+    ASSERT_EQ(transposed->get_parameters().ortho_method,
+              gko::solver::gmres::ortho_method::cgs2);
+}
+
+
 TYPED_TEST(Gmres, CanSetPreconditionerInFactory)
 {
     using Solver = typename TestFixture::Solver;
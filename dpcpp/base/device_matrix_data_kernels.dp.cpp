@@ -122,6 +122,27 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void sort_and_sum_duplicates(std::shared_ptr<const DefaultExecutor> exec,
+                             size_type num_rows, array<ValueType>& values,
+                             array<IndexType>& row_idxs,
+                             array<IndexType>& col_idxs)
+{
+    auto policy = onedpl_policy(exec);
+    auto input_it = oneapi::dpl::make_zip_iterator(
+        row_idxs.get_data(), col_idxs.get_data(), values.get_data());
+    std::stable_sort(policy, input_it, input_it + values.get_size(),
+                     [](auto a, auto b) {
+                         return std::tie(std::get<0>(a), std::get<1>(a)) <
+                                std::tie(std::get<0>(b), std::get<1>(b));
+                     });
+    sum_duplicates(exec, num_rows, values, row_idxs, col_idxs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_AND_SUM_DUPLICATES_KERNEL);
+
+
 }  // namespace components
 }  // namespace dpcpp
 }  // namespace kernels
@@ -0,0 +1,326 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_BASE_CONCURRENT_MATRIX_ASSEMBLY_DATA_HPP_
+#define GKO_PUBLIC_CORE_BASE_CONCURRENT_MATRIX_ASSEMBLY_DATA_HPP_
+
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace detail {
+
+
+/**
+ * A hash table with open addressing and linear probing storing the nonzeros
+ * of a subset of the rows of a matrix being assembled. All entries are stored
+ * in contiguous arrays that only grow, so adding a value never allocates
+ * individual nodes. All accesses are protected by a mutex.
+ *
+ * @tparam ValueType  type of matrix values stored in the structure
+ * @tparam IndexType  type of matrix indexes stored in the structure
+ */
+template <typename ValueType, typename IndexType>
+class assembly_shard {
+public:
+    void add_value(IndexType row, IndexType col, ValueType val)
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        values_[find_or_insert(row, col)] += val;
+    }
+
+    void set_value(IndexType row, IndexType col, ValueType val)
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        values_[find_or_insert(row, col)] = val;
+    }
+
+    ValueType get_value(IndexType row, IndexType col) const
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        if (rows_.empty()) {
+            return zero<ValueType>();
+        }
+        const auto slot = find(row, col);
+        return rows_[slot] == invalid_index<IndexType>() ? zero<ValueType>()
+                                                         : values_[slot];
+    }
+
+    bool contains(IndexType row, IndexType col) const
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        return !rows_.empty() &&
+               rows_[find(row, col)] != invalid_index<IndexType>();
+    }
+
+    size_type get_num_stored_elements() const
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        return num_entries_;
+    }
+
+    void reserve(size_type num_entries)
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        auto capacity = std::max(rows_.size(), size_type{min_capacity});
+        while (capacity < 2 * num_entries) {
+            capacity *= 2;
+        }
+        if (capacity > rows_.size()) {
+            rehash(capacity);
+        }
+    }
+
+    void append_to(std::vector<matrix_data_entry<ValueType, IndexType>>&
+                       nonzeros) const
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        for (size_type slot = 0; slot < rows_.size(); slot++) {
+            if (rows_[slot] != invalid_index<IndexType>()) {
+                nonzeros.emplace_back(rows_[slot], cols_[slot],
+                                      values_[slot]);
+            }
+        }
+    }
+
+private:
+    static constexpr size_type min_capacity = 16;
+
+    size_type hash(IndexType row, IndexType col) const noexcept
+    {
+        auto key = static_cast<uint64>(row) * 0x9e3779b97f4a7c15ull +
+                   static_cast<uint64>(col);
+        key ^= key >> 29;
+        key *= 0xbf58476d1ce4e5b9ull;
+        key ^= key >> 32;
+        return static_cast<size_type>(key) & (rows_.size() - 1);
+    }
+
+    // returns the slot containing (row, col) or the empty slot where it would
+    // be inserted. The table must not be empty.
+    size_type find(IndexType row, IndexType col) const noexcept
+    {
+        auto slot = hash(row, col);
+        while (rows_[slot] != invalid_index<IndexType>() &&
+               (rows_[slot] != row || cols_[slot] != col)) {
+            slot = (slot + 1) & (rows_.size() - 1);
+        }
+        return slot;
+    }
+
+    size_type find_or_insert(IndexType row, IndexType col)
+    {
+        // keep the load factor at most 1/2
+        if (2 * (num_entries_ + 1) > rows_.size()) {
+            rehash(std::max(2 * rows_.size(), size_type{min_capacity}));
+        }
+        const auto slot = find(row, col);
+        if (rows_[slot] == invalid_index<IndexType>()) {
+            rows_[slot] = row;
+            cols_[slot] = col;
+            values_[slot] = zero<ValueType>();
+            num_entries_++;
+        }
+        return slot;
+    }
+
+    void rehash(size_type capacity)
+    {
+        std::vector<IndexType> old_rows(capacity, invalid_index<IndexType>());
+        std::vector<IndexType> old_cols(capacity);
+        std::vector<ValueType> old_values(capacity);
+        std::swap(old_rows, rows_);
+        std::swap(old_cols, cols_);
+        std::swap(old_values, values_);
+        for (size_type old_slot = 0; old_slot < old_rows.size(); old_slot++) {
+            const auto row = old_rows[old_slot];
+            if (row != invalid_index<IndexType>()) {
+                const auto slot = find(row, old_cols[old_slot]);
+                rows_[slot] = row;
+                cols_[slot] = old_cols[old_slot];
+                values_[slot] = old_values[old_slot];
+            }
+        }
+    }
+
+    mutable std::mutex mutex_;
+    size_type num_entries_{};
+    std::vector<IndexType> rows_;
+    std::vector<IndexType> cols_;
+    std::vector<ValueType> values_;
+};
+
+
+}  // namespace detail
+
+
+/**
+ * This structure is used as an intermediate type to assemble a sparse matrix
+ * from multiple threads at the same time, e.g. inside an OpenMP-parallel
+ * finite element loop.
+ *
+ * It provides the same interface as matrix_assembly_data, but the nonzeros are
+ * distributed row-wise over a number of independent shards. Every shard is an
+ * open addressing hash table with its own lock, so threads adding values to
+ * different rows rarely have to wait for each other. The shards are only
+ * combined into a single sorted matrix_data object by get_ordered_data().
+ *
+ * All member functions can be called concurrently.
+ *
+ * @tparam ValueType  type of matrix values stored in the structure
+ * @tparam IndexType  type of matrix indexes stored in the structure
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class concurrent_matrix_assembly_data {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * Creates an empty assembly structure.
+     *
+     * @param size  the dimensions of the matrix being assembled
+     * @param num_shards  the number of independently locked shards the rows
+     *                    are distributed over. If it is 0, a multiple of the
+     *                    number of hardware threads is used.
+     */
+    explicit concurrent_matrix_assembly_data(dim<2> size,
+                                             size_type num_shards = 0)
+        : size_{size}
+    {
+        if (num_shards == 0) {
+            num_shards = std::max<size_type>(
+                4 * std::thread::hardware_concurrency(), 1);
+        }
+        shards_.reserve(num_shards);
+        for (size_type i = 0; i < num_shards; i++) {
+            shards_.emplace_back(std::make_unique<shard_type>());
+        }
+    }
+
+    /**
+     * Sets the matrix value at (row, col).
+     * If there is an existing value, it will be set to the sum of the
+     * existing and new value, otherwise the value will be inserted.
+     *
+     * @param row  the row where the value should be added
+     * @param col  the column where the value should be added
+     * @param val  the value to be added to (row, col)
+     */
+    void add_value(index_type row, index_type col, value_type val)
+    {
+        get_shard(row).add_value(row, col, val);
+    }
+
+    /**
+     * Sets the matrix value at (row, col).
+     * If there is an existing value, it will be overwritten by the new value.
+     *
+     * @param row  the row index
+     * @param col  the column index
+     * @param val  the value to be written to (row, col)
+     */
+    void set_value(index_type row, index_type col, value_type val)
+    {
+        get_shard(row).set_value(row, col, val);
+    }
+
+    /**
+     * Gets the matrix value at (row, col).
+     *
+     * @param row  the row index
+     * @param col  the column index
+     * @return the value at (row, col) or 0 if it doesn't exist.
+     */
+    value_type get_value(index_type row, index_type col) const
+    {
+        return get_shard(row).get_value(row, col);
+    }
+
+    /**
+     * Returns true iff the matrix contains an entry at (row, col).
+     *
+     * @param row  the row index
+     * @param col  the column index
+     * @return true if the value at (row, col) exists, false otherwise
+     */
+    bool contains(index_type row, index_type col) const
+    {
+        return get_shard(row).contains(row, col);
+    }
+
+    /**
+     * Preallocates storage for the given number of nonzeros, so that adding
+     * up to this many distinct entries does not need to grow the shards if
+     * the rows are evenly distributed.
+     *
+     * @param num_entries  the expected number of nonzeros
+     */
+    void reserve(size_type num_entries)
+    {
+        const auto per_shard = ceildiv(num_entries, shards_.size());
+        for (auto& shard : shards_) {
+            shard->reserve(per_shard);
+        }
+    }
+
+    /** @return the dimensions of the matrix being assembled */
+    dim<2> get_size() const noexcept { return size_; }
+
+    /** @return the number of shards the rows are distributed over */
+    size_type get_num_shards() const noexcept { return shards_.size(); }
+
+    /** @return the number of non-zeros in the (partially) assembled matrix */
+    size_type get_num_stored_elements() const
+    {
+        size_type result{};
+        for (const auto& shard : shards_) {
+            result += shard->get_num_stored_elements();
+        }
+        return result;
+    }
+
+    /**
+     * @return a matrix_data instance containing the assembled non-zeros in
+     * row-major order to be used by all matrix formats.
+     */
+    matrix_data<ValueType, IndexType> get_ordered_data() const
+    {
+        matrix_data<ValueType, IndexType> data{size_};
+        data.nonzeros.reserve(this->get_num_stored_elements());
+        for (const auto& shard : shards_) {
+            shard->append_to(data.nonzeros);
+        }
+        data.sort_row_major();
+        return data;
+    }
+
+private:
+    using shard_type = detail::assembly_shard<ValueType, IndexType>;
+
+    shard_type& get_shard(index_type row) const
+    {
+        return *shards_[static_cast<size_type>(row) % shards_.size()];
+    }
+
+    dim<2> size_;
+    std::vector<std::unique_ptr<shard_type>> shards_;
+};
+
+
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_BASE_CONCURRENT_MATRIX_ASSEMBLY_DATA_HPP_
@@ -392,6 +392,33 @@ inline std::vector<status> wait_all(std::vector<request>& req)
 }
 
 
+/**
+ * Allows a rank to wait until any of multiple request handles has completed.
+ * The completed request is reset to a null request, so repeated calls return
+ * the remaining requests in the order of their completion.
+ *
+ * @param req  The vector of request handles to be waited on.
+ *
+ * @return  the index of the completed request, or MPI_UNDEFINED if all
+ *          requests are null requests.
+ */
+inline int wait_any(std::vector<request>& req)
+{
+    std::vector<MPI_Request> handles(req.size());
+    for (std::size_t i = 0; i < req.size(); ++i) {
+        handles[i] = *req[i].get();
+    }
+    int index{};
+    GKO_ASSERT_NO_MPI_ERRORS(MPI_Waitany(static_cast<int>(handles.size()),
+                                         handles.data(), &index,
+                                         MPI_STATUS_IGNORE));
+    if (index != MPI_UNDEFINED) {
+        *req[index].get() = handles[index];
+    }
+    return index;
+}
+
+
 /**
  * A thin wrapper of MPI_Comm that supports most MPI calls.
  *
@@ -455,6 +482,36 @@ public:
         this->comm_.reset(new MPI_Comm(comm_out), comm_deleter{});
     }
 
+    /**
+     * Create a distributed graph communicator from this communicator, where
+     * each rank specifies the ranks it receives data from and sends data to
+     * (MPI_Dist_graph_create_adjacent). Neighborhood collectives like
+     * neighbor_all_to_all_v on the resulting communicator only involve these
+     * neighbors. See MPI documentation for more details.
+     *
+     * @param num_sources  the number of ranks this rank receives data from
+     * @param sources  the ranks this rank receives data from
+     * @param num_destinations  the number of ranks this rank sends data to
+     * @param destinations  the ranks this rank sends data to
+     *
+     * @return  the distributed graph communicator, which keeps the host buffer
+     *          setting of this communicator
+     */
+    communicator create_dist_graph_adjacent(int num_sources,
+                                            const int* sources,
+                                            int num_destinations,
+                                            const int* destinations) const
+    {
+        MPI_Comm comm_out;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Dist_graph_create_adjacent(
+            this->get(), num_sources, sources, MPI_UNWEIGHTED,
+            num_destinations, destinations, MPI_UNWEIGHTED, MPI_INFO_NULL,
+            false, &comm_out));
+        communicator result{comm_out, force_host_buffer_};
+        result.comm_.reset(new MPI_Comm(comm_out), comm_deleter{});
+        return result;
+    }
+
     /**
      * Return the underlying MPI_Comm object.
      *
@@ -1388,6 +1445,108 @@ public:
             recv_offsets, type_impl<RecvType>::get_type());
     }
 
+    /**
+     * Communicate data from this rank to its neighbors in a distributed graph
+     * communicator with offsets (MPI_Neighbor_alltoallv). The counts and
+     * offsets are given per neighbor, in the order of the sources and
+     * destinations passed to create_dist_graph_adjacent. See MPI
+     * documentation for more details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param send_type  the MPI_Datatype for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     * @param recv_type  the MPI_Datatype for the recv buffer
+     */
+    void neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                               const void* send_buffer, const int* send_counts,
+                               const int* send_offsets, MPI_Datatype send_type,
+                               void* recv_buffer, const int* recv_counts,
+                               const int* recv_offsets,
+                               MPI_Datatype recv_type) const
+    {
+        auto guard = exec->get_scoped_device_id_guard();
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Neighbor_alltoallv(
+            send_buffer, send_counts, send_offsets, send_type, recv_buffer,
+            recv_counts, recv_offsets, recv_type, this->get()));
+    }
+
+    /**
+     * Communicate data from this rank to its neighbors in a distributed graph
+     * communicator with offsets (MPI_Ineighbor_alltoallv). The counts and
+     * offsets are given per neighbor, in the order of the sources and
+     * destinations passed to create_dist_graph_adjacent. See MPI
+     * documentation for more details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param send_type  the MPI_Datatype for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     * @param recv_type  the MPI_Datatype for the recv buffer
+     *
+     * @return  the request handle for the call
+     */
+    request i_neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                                    const void* send_buffer,
+                                    const int* send_counts,
+                                    const int* send_offsets,
+                                    MPI_Datatype send_type, void* recv_buffer,
+                                    const int* recv_counts,
+                                    const int* recv_offsets,
+                                    MPI_Datatype recv_type) const
+    {
+        auto guard = exec->get_scoped_device_id_guard();
+        request req;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Ineighbor_alltoallv(
+            send_buffer, send_counts, send_offsets, send_type, recv_buffer,
+            recv_counts, recv_offsets, recv_type, this->get(), req.get()));
+        return req;
+    }
+
+    /**
+     * Communicate data from this rank to its neighbors in a distributed graph
+     * communicator with offsets (MPI_Ineighbor_alltoallv). See MPI
+     * documentation for more details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     *
+     * @tparam SendType  the type of the data to send. Has to be a type which
+     *                   has a specialization of type_impl that defines its
+     *                   MPI_Datatype.
+     * @tparam RecvType  the type of the data to receive. The same restrictions
+     *                   as for SendType apply.
+     *
+     * @return  the request handle for the call
+     */
+    template <typename SendType, typename RecvType>
+    request i_neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                                    const SendType* send_buffer,
+                                    const int* send_counts,
+                                    const int* send_offsets,
+                                    RecvType* recv_buffer,
+                                    const int* recv_counts,
+                                    const int* recv_offsets) const
+    {
+        return this->i_neighbor_all_to_all_v(
+            std::move(exec), send_buffer, send_counts, send_offsets,
+            type_impl<SendType>::get_type(), recv_buffer, recv_counts,
+            recv_offsets, type_impl<RecvType>::get_type());
+    }
+
     /**
      * Does a scan operation with the given operator.
      * (MPI_Scan). See MPI documentation for more details.
@@ -7,6 +7,8 @@
 
 
 #include <istream>
+#include <memory>
+#include <string>
 
 
 #include <ginkgo/core/base/matrix_data.hpp>
@@ -15,6 +17,19 @@
 namespace gko {
 
 
+class Executor;
+
+
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+}  // namespace matrix
+
+
 /**
  * Reads a matrix stored in matrix market format from an input stream.
  *
@@ -142,6 +157,83 @@ void write_binary_raw(std::ostream& os,
                       const matrix_data<ValueType, IndexType>& data);
 
 
+/**
+ * Writes a CSR matrix to a stream in Ginkgo's binary CSR container format.
+ * Note that this format depends on the processor's endianness,
+ * so files from a big endian processor can't be read from a little endian
+ * processor and vice-versa.
+ *
+ * The binary CSR format has the following structure (in system endianness):
+ * 1. A 32 byte header consisting of 4 uint64_t values:
+ *    magic = GKOCSR__: The highest two bytes stand for value and index type,
+ *                      encoded like in the format of read_binary_raw.
+ *    num_rows: Number of rows
+ *    num_cols: Number of columns
+ *    num_entries: Number of stored nonzeros
+ * 2. The num_rows + 1 row pointers stored as IndexType,
+ * 3. the num_entries column indices stored as IndexType and
+ * 4. the num_entries values stored as ValueType.
+ * Each of the three arrays starts at an offset that is a multiple of 16 bytes,
+ * the gaps in between are filled with zeros. This allows the arrays to be
+ * used in-place when the file is mapped into memory.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param os  output stream where the data is to be written
+ * @param mtx  the matrix to write
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* mtx);
+
+
+/**
+ * Reads a CSR matrix stored in Ginkgo's binary CSR container format
+ * (see write_binary_csr) from an input stream.
+ *
+ * In contrast to read_binary, the arrays are read directly into the storage
+ * of the resulting matrix, without an intermediate matrix_data stage.
+ * The value and index type stored in the file need to match ValueType and
+ * IndexType.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor on which the matrix should be created
+ * @param is  input stream from which to read the data
+ *
+ * @return the CSR matrix stored in the stream
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, std::istream& is);
+
+
+/**
+ * Reads a CSR matrix stored in Ginkgo's binary CSR container format
+ * (see write_binary_csr) from a file.
+ *
+ * Where supported by the operating system, the file is mapped into memory
+ * instead of being read. If `exec` is a host executor, the resulting matrix
+ * uses the mapped arrays in-place, so no copy of the data is made, and the
+ * pages are only loaded on first access. The mapping is private, so
+ * modifications of the matrix are never written back to the file.
+ * For device executors, the mapped arrays are copied to the device directly.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor on which the matrix should be created
+ * @param filename  path to the file from which to read the data
+ *
+ * @return the CSR matrix stored in the file
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, const std::string& filename);
+
+
 /**
  * Reads a matrix stored in matrix market format from an input stream.
  *
@@ -127,6 +127,41 @@ template <typename ValueType>
 class Vector;
 
 
+/**
+ * Selects how a distributed Matrix exchanges the non-local vector entries
+ * (the halo) during an SpMV.
+ */
+enum class communication_mode {
+    /**
+     * Uses a (non-blocking) all-to-all collective over the whole communicator.
+     * Every rank takes part in the exchange, even if it does not share any
+     * data with most of the other ranks.
+     */
+    all_to_all,
+    /**
+     * Uses a (non-blocking) neighborhood collective over a distributed graph
+     * communicator, which only connects each rank with the ranks it actually
+     * exchanges data with. The graph communicator is created collectively on
+     * the first apply after reading the matrix. This usually scales better
+     * than all_to_all if each rank only has a few neighbors.
+     */
+    neighborhood,
+    /**
+     * Uses non-blocking point-to-point messages with each neighbor and applies
+     * the non-local matrix piece by piece as soon as the data of a neighbor
+     * has arrived, instead of waiting for the whole halo. For this purpose,
+     * the non-local matrix is split on the first apply into one block per
+     * neighbor, which only contains the boundary rows, i.e. the rows with
+     * non-local entries. Their contributions are accumulated separately and
+     * added to the interior result at the end, so a slow neighbor only delays
+     * the work that depends on its data. The split requires the non-local
+     * matrix to be stored as Csr; for other formats, all messages are waited
+     * for before applying the non-local matrix.
+     */
+    pipelined
+};
+
+
 /**
  * The Matrix class defines a (MPI-)distributed matrix.
  *
@@ -336,6 +371,24 @@ public:
         ptr_param<const Partition<local_index_type, global_index_type>>
             col_partition);
 
+    /**
+     * Sets the communication mode used to exchange the non-local vector
+     * entries in apply.
+     *
+     * @note All ranks of the communicator need to use the same mode.
+     *
+     * @param mode  the new communication mode
+     */
+    void set_communication_mode(communication_mode mode);
+
+    /**
+     * Returns the communication mode used to exchange the non-local vector
+     * entries in apply.
+     *
+     * @return  the communication mode
+     */
+    communication_mode get_communication_mode() const { return comm_mode_; }
+
     /**
      * Get read access to the stored local matrix.
      *
@@ -353,6 +406,71 @@ public:
         return non_local_mtx_;
     }
 
+    /**
+     * Get read access to the local row indices of the vector entries that are
+     * sent to other ranks, ordered by the destination rank.
+     *
+     * @return  the local indices of the sent vector entries
+     */
+    const array<local_index_type>& get_gather_idxs() const
+    {
+        return gather_idxs_;
+    }
+
+    /**
+     * Get read access to the global column index of every column of the
+     * non-local matrix.
+     *
+     * @return  the global indices of the non-local columns
+     */
+    const array<global_index_type>& get_non_local_to_global() const
+    {
+        return non_local_to_global_;
+    }
+
+    /**
+     * Returns the number of vector entries sent to each rank.
+     *
+     * @return  the send sizes, one per rank
+     */
+    const std::vector<comm_index_type>& get_send_sizes() const
+    {
+        return send_sizes_;
+    }
+
+    /**
+     * Returns the offsets of the vector entries sent to each rank into
+     * get_gather_idxs().
+     *
+     * @return  the send offsets, one per rank and the total number at the end
+     */
+    const std::vector<comm_index_type>& get_send_offsets() const
+    {
+        return send_offsets_;
+    }
+
+    /**
+     * Returns the number of vector entries received from each rank.
+     *
+     * @return  the receive sizes, one per rank
+     */
+    const std::vector<comm_index_type>& get_recv_sizes() const
+    {
+        return recv_sizes_;
+    }
+
+    /**
+     * Returns the offsets of the vector entries received from each rank into
+     * the columns of the non-local matrix.
+     *
+     * @return  the receive offsets, one per rank and the total number at the
+     *          end
+     */
+    const std::vector<comm_index_type>& get_recv_offsets() const
+    {
+        return recv_offsets_;
+    }
+
     /**
      * Copy constructs a Matrix.
      *
@@ -535,6 +653,58 @@ protected:
      */
     mpi::request communicate(const local_vector_type* local_b) const;
 
+    /**
+     * Computes the ranks this rank receives from and sends to, together with
+     * the compacted send and receive sizes and offsets of these neighbors.
+     */
+    void build_neighbor_lists();
+
+    /**
+     * Creates the distributed graph communicator used by
+     * communication_mode::neighborhood.
+     */
+    void build_neighborhood() const;
+
+    /**
+     * Starts non-blocking receives from and sends to every neighbor of the
+     * values of b that are shared with other processors, as used by
+     * communication_mode::pipelined.
+     *
+     * @param local_b  The full local vector to be communicated. The subset of
+     *                 shared values is automatically extracted.
+     * @param recv_reqs  the receive requests, one per rank that sends data to
+     *                   this rank, in increasing rank order
+     * @param send_reqs  the send requests
+     */
+    void communicate_pipelined(const local_vector_type* local_b,
+                               std::vector<mpi::request>& recv_reqs,
+                               std::vector<mpi::request>& send_reqs) const;
+
+    /**
+     * Adds the product of the non-local matrix with the received values,
+     * scaled by alpha, to local_x. The received values of every neighbor are
+     * processed in the order in which they arrive.
+     *
+     * @param alpha  the scaling factor for the non-local product
+     * @param recv_reqs  the receive requests from communicate_pipelined
+     * @param send_reqs  the send requests from communicate_pipelined
+     * @param local_x  the local part of the result vector
+     */
+    void apply_non_local_pipelined(const local_vector_type* alpha,
+                                   std::vector<mpi::request>& recv_reqs,
+                                   std::vector<mpi::request>& send_reqs,
+                                   local_vector_type* local_x) const;
+
+    /**
+     * Splits the non-local matrix into the per-neighbor boundary blocks and
+     * creates the matrix that scatters their results to the local rows, as
+     * used by communication_mode::pipelined.
+     *
+     * @param non_local  the non-local matrix
+     */
+    void build_boundary_blocks(
+        const gko::matrix::Csr<value_type, local_index_type>* non_local) const;
+
     void apply_impl(const LinOp* b, LinOp* x) const override;
 
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
@@ -547,11 +717,22 @@ private:
     std::vector<comm_index_type> recv_sizes_;
     array<local_index_type> gather_idxs_;
     array<global_index_type> non_local_to_global_;
+    communication_mode comm_mode_;
+    std::vector<comm_index_type> neighbor_sources_;
+    std::vector<comm_index_type> neighbor_destinations_;
+    std::vector<comm_index_type> neighbor_send_offsets_;
+    std::vector<comm_index_type> neighbor_send_sizes_;
+    std::vector<comm_index_type> neighbor_recv_offsets_;
+    std::vector<comm_index_type> neighbor_recv_sizes_;
+    mutable std::shared_ptr<mpi::communicator> neighbor_comm_;
+    mutable std::vector<std::shared_ptr<LinOp>> boundary_blocks_;
+    mutable std::shared_ptr<LinOp> boundary_scatter_;
     gko::detail::DenseCache<value_type> one_scalar_;
     gko::detail::DenseCache<value_type> host_send_buffer_;
     gko::detail::DenseCache<value_type> host_recv_buffer_;
     gko::detail::DenseCache<value_type> send_buffer_;
     gko::detail::DenseCache<value_type> recv_buffer_;
+    gko::detail::DenseCache<value_type> boundary_buffer_;
     std::shared_ptr<LinOp> local_mtx_;
     std::shared_ptr<LinOp> non_local_mtx_;
 };
@@ -2,6 +2,10 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#ifndef GKO_PUBLIC_CORE_FACTORIZATION_LU_HPP_
+#define GKO_PUBLIC_CORE_FACTORIZATION_LU_HPP_
+
+
 #include <memory>
 
 
@@ -37,6 +41,28 @@ enum class symbolic_type {
 };
 
 
+/**
+ * A helper for algorithm selection in the numerical LU factorization.
+ * It currently only matters for the OpenMP executor, the other executors always
+ * use their default algorithm.
+ */
+enum class numeric_type {
+    /**
+     * An LU factorization algorithm that groups the rows into levels of rows
+     * only depending on rows from previous levels, and factorizes all rows of
+     * a level in parallel.
+     */
+    level_scheduled,
+    /**
+     * An LU factorization algorithm that factorizes the rows one after the
+     * other. This avoids the cost of computing the level schedule, which can
+     * be beneficial if the dependencies between rows expose little
+     * parallelism.
+     */
+    sequential
+};
+
+
 /**
  * Computes an LU factorization of a sparse matrix. This LinOpFactory returns a
  * Factorization storing the L and U factors for the provided system matrix in
@@ -85,6 +111,13 @@ public:
         symbolic_type GKO_FACTORY_PARAMETER_SCALAR(symbolic_algorithm,
                                                    symbolic_type::general);
 
+        /**
+         * This parameter controls which algorithm will be used to compute the
+         * numerical factorization.
+         */
+        numeric_type GKO_FACTORY_PARAMETER_SCALAR(
+            numeric_algorithm, numeric_type::level_scheduled);
+
         /**
          * The `system_matrix`, which will be given to this factory, must be
          * sorted (first by row, then by column) in order for the algorithm
@@ -133,3 +166,6 @@ private:
 }  // namespace factorization
 }  // namespace experimental
 }  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_FACTORIZATION_LU_HPP_
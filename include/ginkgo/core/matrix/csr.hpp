@@ -6,6 +6,10 @@
 #define GKO_PUBLIC_CORE_MATRIX_CSR_HPP_
 
 
+#include <memory>
+#include <utility>
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/index_set.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
@@ -45,6 +49,9 @@ class Csr;
 template <typename ValueType, typename IndexType>
 class Fbcsr;
 
+template <typename ValueType, typename IndexType>
+class DeltaCsr;
+
 template <typename ValueType, typename IndexType>
 class CsrBuilder;
 
@@ -107,6 +114,7 @@ class Csr : public EnableLinOp<Csr<ValueType, IndexType>>,
             public ConvertibleTo<Hybrid<ValueType, IndexType>>,
             public ConvertibleTo<Sellp<ValueType, IndexType>>,
             public ConvertibleTo<SparsityCsr<ValueType, IndexType>>,
+            public ConvertibleTo<DeltaCsr<ValueType, IndexType>>,
             public DiagonalExtractable<ValueType>,
             public ReadableFromMatrixData<ValueType, IndexType>,
             public WritableToMatrixData<ValueType, IndexType>,
@@ -124,6 +132,7 @@ class Csr : public EnableLinOp<Csr<ValueType, IndexType>>,
     friend class Sellp<ValueType, IndexType>;
     friend class SparsityCsr<ValueType, IndexType>;
     friend class Fbcsr<ValueType, IndexType>;
+    friend class DeltaCsr<ValueType, IndexType>;
     friend class CsrBuilder<ValueType, IndexType>;
     friend class Csr<to_complex<ValueType>, IndexType>;
 
@@ -146,6 +155,8 @@ public:
     using ConvertibleTo<Sellp<ValueType, IndexType>>::move_to;
     using ConvertibleTo<SparsityCsr<ValueType, IndexType>>::convert_to;
     using ConvertibleTo<SparsityCsr<ValueType, IndexType>>::move_to;
+    using ConvertibleTo<DeltaCsr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<DeltaCsr<ValueType, IndexType>>::move_to;
     using ReadableFromMatrixData<ValueType, IndexType>::read;
 
     using value_type = ValueType;
@@ -723,6 +734,10 @@ public:
 
     void move_to(SparsityCsr<ValueType, IndexType>* result) override;
 
+    void convert_to(DeltaCsr<ValueType, IndexType>* result) const override;
+
+    void move_to(DeltaCsr<ValueType, IndexType>* result) override;
+
     void read(const mat_data& data) override;
 
     void read(const device_mat_data& data) override;
@@ -803,6 +818,68 @@ public:
             column_permutation,
         bool invert = false) const;
 
+    /**
+     * Stores the lookup structure for the sparsity pattern of a sparse
+     * matrix-matrix product computed by multiply_reuse. It allows recomputing
+     * the values of the product for input matrices with unchanged sparsity
+     * patterns, without recomputing the sparsity pattern of the output.
+     */
+    class multiply_reuse_info {
+        friend class Csr;
+
+    public:
+        /** Creates an empty reuse info that can't be used to update values. */
+        explicit multiply_reuse_info();
+
+        ~multiply_reuse_info();
+
+        multiply_reuse_info(const multiply_reuse_info&) = delete;
+
+        multiply_reuse_info(multiply_reuse_info&&) noexcept;
+
+        multiply_reuse_info& operator=(const multiply_reuse_info&) = delete;
+
+        multiply_reuse_info& operator=(multiply_reuse_info&&) noexcept;
+
+        /**
+         * Recomputes the sparse matrix-matrix product `out = mtx1 * mtx2` in
+         * place, where only the values of mtx1 and mtx2 changed since the
+         * call to multiply_reuse that created this object.
+         *
+         * @param mtx1  the first factor, with the same sparsity pattern as the
+         *              matrix multiply_reuse was called on
+         * @param mtx2  the second factor, with the same sparsity pattern as the
+         *              parameter of multiply_reuse
+         * @param out  the output matrix returned by multiply_reuse
+         *
+         * @throws ValueMismatch  if the sparsity patterns of mtx1 and mtx2
+         *                        produce entries outside the sparsity pattern
+         *                        of out. These entries are skipped, so the
+         *                        values of out are invalid afterwards.
+         */
+        void update_values(ptr_param<const Csr> mtx1,
+                           ptr_param<const Csr> mtx2,
+                           ptr_param<Csr> out) const;
+
+    private:
+        struct lookup_data;
+
+        explicit multiply_reuse_info(std::unique_ptr<lookup_data> data);
+
+        std::unique_ptr<lookup_data> internal_;
+    };
+
+    /**
+     * Computes the sparse matrix-matrix product `this * other`, and stores the
+     * information necessary to recompute the product for new values of both
+     * factors with multiply_reuse_info::update_values.
+     *
+     * @param other  the second factor
+     * @return  the product and the reuse information
+     */
+    std::pair<std::unique_ptr<Csr>, multiply_reuse_info> multiply_reuse(
+        ptr_param<const Csr> other) const;
+
     std::unique_ptr<LinOp> permute(
         const array<IndexType>* permutation_indices) const override;
 
@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+template <typename ValueType>
+class Dense;
+
+
+/**
+ * DeltaCsr is a compressed sparse row matrix format that stores the column
+ * indices of every row as small offsets (deltas) relative to a per-row base
+ * column, which is decompressed on the fly during the SpMV. This reduces the
+ * memory traffic of the SpMV for matrices whose rows only span a limited
+ * range of columns, like banded or blocked matrices.
+ *
+ * The values and row pointers are stored like in Csr. Additionally, the
+ * smallest column index of every row is stored as its base, and the
+ * differences between the column indices and the base are stored in a byte
+ * array. Every row uses the smallest possible width for its deltas, i.e.
+ * 1 byte if all deltas fit into 8 bits, 2 bytes if they fit into 16 bits,
+ * and sizeof(IndexType) bytes otherwise. The compressed index pointers store
+ * the offset of every row's deltas in the byte array, so the width of a row's
+ * deltas is given by the number of bytes divided by the number of nonzeros.
+ *
+ * DeltaCsr matrices are created by converting from Csr or by reading matrix
+ * data, and can be converted back to Csr to access the uncompressed column
+ * indices.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class DeltaCsr : public EnableLinOp<DeltaCsr<ValueType, IndexType>>,
+                 public ConvertibleTo<Csr<ValueType, IndexType>>,
+                 public ReadableFromMatrixData<ValueType, IndexType>,
+                 public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<DeltaCsr, LinOp>;
+    friend class Csr<ValueType, IndexType>;
+
+public:
+    using EnableLinOp<DeltaCsr>::convert_to;
+    using EnableLinOp<DeltaCsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* result) const override;
+
+    void move_to(Csr<ValueType, IndexType>* result) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Returns the values of the matrix.
+     *
+     * @return the values of the matrix.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc DeltaCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the matrix.
+     *
+     * @return the row pointers of the matrix.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the base column index of every row, i.e. the smallest column
+     * index in the row.
+     *
+     * @return the base column indices of the matrix.
+     */
+    const index_type* get_const_row_bases() const noexcept
+    {
+        return row_bases_.get_const_data();
+    }
+
+    /**
+     * Returns the offsets of every row's column deltas in the compressed
+     * index array.
+     *
+     * @return the compressed index pointers of the matrix.
+     */
+    const int64* get_const_compressed_idx_ptrs() const noexcept
+    {
+        return compressed_idx_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the compressed column deltas of the matrix.
+     *
+     * @return the compressed column deltas of the matrix.
+     */
+    const uint8* get_const_compressed_idxs() const noexcept
+    {
+        return compressed_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size();
+    }
+
+    /**
+     * Returns the number of bytes used to store the compressed column indices.
+     *
+     * @return the number of bytes used to store the compressed column indices
+     */
+    size_type get_num_compressed_idx_bytes() const noexcept
+    {
+        return compressed_idxs_.get_size();
+    }
+
+    /**
+     * Creates an empty DeltaCsr matrix of the specified size.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param size  size of the matrix
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<DeltaCsr> create(
+        std::shared_ptr<const Executor> exec, const dim<2>& size = dim<2>{});
+
+    /**
+     * Copy-assigns a DeltaCsr matrix. Preserves executor, copies everything
+     * else.
+     */
+    DeltaCsr& operator=(const DeltaCsr&);
+
+    /**
+     * Move-assigns a DeltaCsr matrix. Preserves executor, moves the data and
+     * leaves the moved-from object in an empty state (0x0 LinOp with unchanged
+     * executor, no nonzeros and valid row pointers).
+     */
+    DeltaCsr& operator=(DeltaCsr&&);
+
+    /**
+     * Copy-constructs a DeltaCsr matrix. Inherits executor and data.
+     */
+    DeltaCsr(const DeltaCsr&);
+
+    /**
+     * Move-constructs a DeltaCsr matrix. Inherits executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor, no nonzeros and valid row pointers).
+     */
+    DeltaCsr(DeltaCsr&&);
+
+protected:
+    DeltaCsr(std::shared_ptr<const Executor> exec,
+             const dim<2>& size = dim<2>{});
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    array<value_type> values_;
+    array<index_type> row_ptrs_;
+    array<index_type> row_bases_;
+    array<int64> compressed_idx_ptrs_;
+    array<uint8> compressed_idxs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_DELTA_CSR_HPP_
@@ -9,6 +9,7 @@
 #include <vector>
 
 
+#include <ginkgo/config.hpp>
 #include <ginkgo/core/base/composition.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
@@ -18,6 +19,18 @@
 #include <ginkgo/core/multigrid/multigrid_level.hpp>
 
 namespace gko {
+#if GINKGO_BUILD_MPI
+namespace experimental {
+namespace distributed {
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+class Matrix;
+
+
+}  // namespace distributed
+}  // namespace experimental
+#endif
 namespace multigrid {
 
 
@@ -36,6 +49,20 @@ namespace multigrid {
  * un-aggregated elements are assigned to an aggregated group
  * or are left alone.
  *
+ * If the system matrix is an experimental::distributed::Matrix with local index
+ * type IndexType, the aggregation is first computed on the rank-local block of
+ * the matrix. Afterwards, the aggregates at the rank boundaries are paired
+ * with the same handshaking across the ranks: an aggregate prefers its
+ * strongest neighbor on another rank if it is at least as strong as its
+ * strongest neighbor on its own rank, and two aggregates that prefer each
+ * other are merged into an aggregate owned by the rank of the smaller global
+ * index. The coarse matrix, the prolongation and the restriction are
+ * experimental::distributed::Matrix objects again, and the coarse matrix
+ * contains the couplings between aggregates on different ranks. Thus, a
+ * Multigrid built on these levels provides a global coarse correction. If the
+ * coarse matrix becomes small, it can be agglomerated onto fewer ranks, see
+ * min_rows_per_rank.
+ *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  precision of matrix indexes
  *
@@ -69,6 +96,9 @@ public:
      * Aggregate group whose size is same as the number of rows. Stores the
      * mapping information from row index to coarse row index.
      * i.e., agg[row_idx] = coarse_row_idx.
+     * For a distributed system matrix, it only contains the rank-local rows
+     * and the rank-local aggregates before aggregates on different ranks are
+     * merged.
      *
      * @return the aggregate group.
      */
@@ -123,6 +153,15 @@ public:
          * incorrect.
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * The minimal average number of coarse rows per rank for a distributed
+         * system matrix. If the coarse matrix has fewer rows, it is
+         * agglomerated onto fewer ranks, so that each of them owns about
+         * min_rows_per_rank rows. The other ranks keep empty local blocks. The
+         * default value 0 keeps the coarse rows on all ranks.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(min_rows_per_rank, 0u);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Pgm, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -161,6 +200,20 @@ protected:
 
     void generate();
 
+#if GINKGO_BUILD_MPI
+    /**
+     * Generates the distributed coarse level of a distributed system matrix.
+     *
+     * @tparam GlobalIndexType  the global index type of the matrix
+     *
+     * @param matrix  the distributed system matrix
+     */
+    template <typename GlobalIndexType>
+    void generate_distributed(
+        const experimental::distributed::Matrix<ValueType, IndexType,
+                                                GlobalIndexType>* matrix);
+#endif
+
 private:
     std::shared_ptr<const LinOp> system_matrix_{};
     array<IndexType> agg_;
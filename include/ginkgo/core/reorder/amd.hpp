@@ -26,6 +26,26 @@ namespace experimental {
 namespace reorder {
 
 
+/**
+ * The algorithm used to compute an AMD reordering.
+ */
+enum class amd_algorithm {
+    /**
+     * The sequential AMD implementation from SuiteSparse, which always runs on
+     * the host.
+     */
+    sequential,
+    /**
+     * An approximate minimum degree ordering that eliminates an independent
+     * set of nodes with close to minimum degree at once ("multiple
+     * elimination"). It runs on the host executor and is parallelized on the
+     * OpenMP executor. Its orderings usually have slightly more fill-in than
+     * the sequential algorithm.
+     */
+    multiple_elimination
+};
+
+
 /**
  * Computes a Approximate Minimum Degree (AMD) reordering of an input
  * matrix.
@@ -58,6 +78,12 @@ public:
          * symmetrization or AMD reordering may fail silently or crash.
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * The algorithm used to compute the reordering.
+         */
+        amd_algorithm GKO_FACTORY_PARAMETER_SCALAR(algorithm,
+                                                   amd_algorithm::sequential);
     };
 
     /**
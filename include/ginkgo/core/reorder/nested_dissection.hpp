@@ -9,9 +9,6 @@
 #include <ginkgo/config.hpp>
 
 
-#if GKO_HAVE_METIS
-
-
 #include <memory>
 #include <unordered_map>
 
@@ -36,9 +33,29 @@ namespace experimental {
 namespace reorder {
 
 
+/**
+ * The algorithm used to compute a nested dissection reordering.
+ */
+enum class nested_dissection_algorithm {
+    /**
+     * Uses METIS_NodeND from the METIS library, which is only available if
+     * Ginkgo was built with METIS support.
+     */
+    metis,
+    /**
+     * Uses a built-in multilevel graph bisection based on heavy-edge matching
+     * coarsening, graph growing and greedy refinement. Small subgraphs are
+     * ordered using AMD. Independent subgraphs are ordered in parallel on the
+     * OpenMP executor. The ordering is a postorder of the separator tree,
+     * every separator is ordered after the two parts it separates.
+     */
+    native
+};
+
+
 /**
  * Computes a Nested Dissection (ND) reordering of an input matrix using the
- * METIS library.
+ * METIS library or a built-in multilevel graph bisection.
  *
  * @tparam ValueType  the type used to store values of the system matrix
  * @tparam IndexType  the type used to store sparsity pattern indices of the
@@ -65,9 +82,18 @@ public:
     struct parameters_type
         : public enable_parameters_type<
               parameters_type, NestedDissection<ValueType, IndexType>> {
+        /**
+         * The algorithm used to compute the reordering. By default, METIS is
+         * used if it is available.
+         */
+        nested_dissection_algorithm GKO_FACTORY_PARAMETER_SCALAR(
+            algorithm, GKO_HAVE_METIS ? nested_dissection_algorithm::metis
+                                      : nested_dissection_algorithm::native);
+
         /**
          * The options to be passed on to METIS, stored as key-value pairs.
          * Any options that are not set here use their default value.
+         * They are ignored by the native algorithm.
          */
         std::unordered_map<int, int> options;
 
@@ -119,7 +145,4 @@ private:
 }  // namespace gko
 
 
-#endif  // GKO_HAVE_METIS
-
-
 #endif  // GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
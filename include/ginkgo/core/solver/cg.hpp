@@ -24,6 +24,34 @@
 
 namespace gko {
 namespace solver {
+namespace cg {
+
+
+/**
+ * Describes how CG treats a right-hand side with multiple columns.
+ *
+ * - independent: Solves all systems in lockstep with one Krylov space per
+ *                column. Columns that have converged stay part of every
+ *                operation, their updates are only masked out.
+ * - compact: Solves all systems independently, but removes columns that have
+ *            converged from the working vectors, so the cost of every
+ *            iteration is proportional to the number of unconverged columns.
+ *            The solution columns are only written back whenever the set of
+ *            active columns changes, and when the solver terminates.
+ * - block: Block CG, which solves all systems using a single shared Krylov
+ *          space. This usually requires fewer iterations than independent
+ *          solves, at the cost of small dense systems of the size of the
+ *          number of columns that are solved on the host in every iteration.
+ *          Converged columns are deflated from the block, which restarts the
+ *          search directions.
+ *
+ * All methods are equivalent for a single right-hand side. Distributed vectors
+ * always use the independent method.
+ */
+enum class multi_rhs_method { independent, compact, block };
+
+
+}  // namespace cg
 
 
 /**
@@ -35,7 +63,8 @@ namespace solver {
  *
  * The implementation in Ginkgo makes use of the merged kernel to make the best
  * use of data locality. The inner operations in one iteration of CG are merged
- * into 2 separate steps.
+ * into 2 separate steps. Multiple right-hand sides can be solved with
+ * different strategies, see the multi_rhs_method parameter.
  *
  * @tparam ValueType  precision of matrix elements
  *
@@ -68,7 +97,11 @@ public:
 
     struct parameters_type
         : enable_preconditioned_iterative_solver_factory_parameters<
-              parameters_type, Factory> {};
+              parameters_type, Factory> {
+        /** Strategy for right-hand sides with multiple columns */
+        cg::multi_rhs_method GKO_FACTORY_PARAMETER_SCALAR(
+            multi_rhs_method, cg::multi_rhs_method::independent);
+    };
 
     GKO_ENABLE_LIN_OP_FACTORY(Cg, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -79,6 +112,21 @@ protected:
     template <typename VectorType>
     void apply_dense_impl(const VectorType* b, VectorType* x) const;
 
+    void apply_multi_rhs_impl(const matrix::Dense<ValueType>* b,
+                              matrix::Dense<ValueType>* x) const;
+
+    template <typename VectorType>
+    void apply_multi_rhs_impl(const VectorType* b, VectorType* x) const
+    {
+        this->apply_dense_impl(b, x);
+    }
+
+    void apply_compact_impl(const matrix::Dense<ValueType>* b,
+                            matrix::Dense<ValueType>* x) const;
+
+    void apply_block_impl(const matrix::Dense<ValueType>* b,
+                          matrix::Dense<ValueType>* x) const;
+
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
                     LinOp* x) const override;
 
@@ -31,13 +31,39 @@ namespace solver {
 constexpr size_type gmres_default_krylov_dim = 100u;
 
 
+namespace gmres {
+
+
+/**
+ * Describes the orthogonalization method that is used in GMRES to
+ * orthogonalize a new Krylov vector against the existing Krylov basis.
+ *
+ * - mgs: Modified Gram-Schmidt. Orthogonalizes against one basis vector at a
+ *        time, which requires one global reduction per basis vector.
+ * - cgs: Classical Gram-Schmidt. Computes all inner products with the basis
+ *        at once and subtracts all projections in a single pass, which
+ *        requires only one global reduction per iteration (in addition to the
+ *        normalization), but is numerically less stable than mgs.
+ * - cgs2: Classical Gram-Schmidt with reorthogonalization. Applies cgs twice,
+ *         which results in an orthogonality comparable to mgs while requiring
+ *         two global reductions per iteration (in addition to the
+ *         normalization).
+ */
+enum class ortho_method { mgs, cgs, cgs2 };
+
+
+}  // namespace gmres
+
+
 /**
  * GMRES or the generalized minimal residual method is an iterative type Krylov
  * subspace method which is suitable for nonsymmetric linear systems.
  *
  * The implementation in Ginkgo makes use of the merged kernel to make the best
  * use of data locality. The inner operations in one iteration of GMRES are
- * merged into 2 separate steps. Modified Gram-Schmidt is used.
+ * merged into 2 separate steps. By default, modified Gram-Schmidt is used,
+ * the orthogonalization method can be changed via the ortho_method
+ * parameter.
  *
  * @tparam ValueType  precision of matrix elements
  *
@@ -92,6 +118,10 @@ public:
 
         /** Flexible GMRES */
         bool GKO_FACTORY_PARAMETER_SCALAR(flexible, false);
+
+        /** Orthogonalization method */
+        gmres::ortho_method GKO_FACTORY_PARAMETER_SCALAR(
+            ortho_method, gmres::ortho_method::mgs);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Gmres, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -170,6 +200,8 @@ struct workspace_traits<Gmres<ValueType>> {
     constexpr static int next_krylov_norm_tmp = 13;
     // preconditioned krylov basis multivector
     constexpr static int preconditioned_krylov_bases = 14;
+    // contiguous hessenberg column for the block orthogonalization
+    constexpr static int hessenberg_aux = 15;
 
     // stopping status array
     constexpr static int stop = 0;
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_PIPE_CG_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_PIPE_CG_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * PIPE_CG or the pipelined conjugate gradient method is a reformulation of CG
+ * (following Chronopoulos and Gear) which is suitable for symmetric positive
+ * definite methods.
+ *
+ * Compared to Cg, the search direction of the residual is updated by a
+ * recurrence instead of an explicit SpMV, so both inner products of an
+ * iteration only depend on vectors that are available at the same time. This
+ * allows computing them in a single fused reduction, which reduces the number
+ * of passes over the vectors and, for distributed vectors, the number of
+ * global reductions per iteration from two to one. The price is an additional
+ * workspace vector and slightly different rounding behavior.
+ *
+ * The implementation in Ginkgo merges the inner operations in one iteration of
+ * PIPE_CG into one reduction kernel and one update kernel.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class PipeCg
+    : public EnableLinOp<PipeCg<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType, PipeCg<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<PipeCg>;
+    friend class EnablePolymorphicObject<PipeCg, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = PipeCg<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    class Factory;
+
+    struct parameters_type
+        : enable_preconditioned_iterative_solver_factory_parameters<
+              parameters_type, Factory> {};
+
+    GKO_ENABLE_LIN_OP_FACTORY(PipeCg, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    explicit PipeCg(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<PipeCg>(std::move(exec))
+    {}
+
+    explicit PipeCg(const Factory* factory,
+                    std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<PipeCg>(factory->get_executor(),
+                              gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType, PipeCg<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {}
+};
+
+
+template <typename ValueType>
+struct workspace_traits<PipeCg<ValueType>> {
+    using Solver = PipeCg<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int r = 0;
+    // preconditioned residual vector
+    constexpr static int z = 1;
+    // A times preconditioned residual vector
+    constexpr static int w = 2;
+    // p vector
+    constexpr static int p = 3;
+    // s vector (A times p)
+    constexpr static int s = 4;
+    // current rho and delta scalars, stored back-to-back
+    constexpr static int rho_delta = 5;
+    // previous rho and delta scalars, stored back-to-back
+    constexpr static int prev_rho_delta = 6;
+    // current alpha scalar
+    constexpr static int alpha = 7;
+    // previous alpha scalar
+    constexpr static int prev_alpha = 8;
+    // constant 1.0 scalar
+    constexpr static int one = 9;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 10;
+
+    // stopping status array
+    constexpr static int stop = 0;
+    // reduction tmp array
+    constexpr static int tmp = 1;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_PIPE_CG_HPP_
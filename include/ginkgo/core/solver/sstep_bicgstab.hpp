@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_SSTEP_BICGSTAB_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_SSTEP_BICGSTAB_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+constexpr size_type sstep_bicgstab_default_steps = 4u;
+
+
+/**
+ * S-step BiCGSTAB is a communication-avoiding reformulation of the
+ * Bi-Conjugate Gradient-Stabilized method which is suitable for general
+ * matrices.
+ *
+ * Every outer iteration performs s iterations of right-preconditioned
+ * BiCGSTAB at once: It first builds a basis of the Krylov subspaces of the
+ * preconditioned system matrix spanned by the search direction (2s + 1
+ * vectors) and the residual (2s vectors) with a sequence of SpMVs and
+ * preconditioner applications (matrix powers kernel), then computes all inner
+ * products between the basis vectors and with the shadow residual in a single
+ * fused reduction. The s BiCGSTAB iterations are carried out on the
+ * coordinates of the vectors in this basis, which only requires the small
+ * matrix of inner products, before the solution, residual and search
+ * direction are updated. For distributed vectors, this reduces the number of
+ * global reductions from three per iteration to one per s iterations, at the
+ * cost of 4s instead of 2s SpMVs and 4s - 1 instead of 2s preconditioner
+ * applications.
+ *
+ * The basis is built from monomials of degree up to 2s, so large values of s
+ * lead to an ill-conditioned basis and loss of accuracy. To keep rounding
+ * errors from accumulating, the residual is recomputed explicitly after every
+ * outer iteration, and the inner iterations restart from the residual once
+ * its norm can no longer be resolved in the basis. The stopping criteria
+ * are only checked once per outer iteration, so the solver may perform up to
+ * s - 1 more iterations than required by an iteration-based stopping
+ * criterion.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class SstepBicgstab
+    : public EnableLinOp<SstepBicgstab<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType,
+                                                 SstepBicgstab<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<SstepBicgstab>;
+    friend class EnablePolymorphicObject<SstepBicgstab, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = SstepBicgstab<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    /**
+     * Gets the number of iterations performed per global reduction
+     *
+     * @return the number of steps s
+     */
+    size_type get_steps() const { return parameters_.steps; }
+
+    /**
+     * Sets the number of iterations performed per global reduction
+     *
+     * @param other  the new number of steps s
+     */
+    void set_steps(size_type other) { parameters_.steps = other; }
+
+    class Factory;
+
+    struct parameters_type
+        : enable_preconditioned_iterative_solver_factory_parameters<
+              parameters_type, Factory> {
+        /** Number of iterations per basis construction and reduction. */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(steps, 0u);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(SstepBicgstab, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    explicit SstepBicgstab(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<SstepBicgstab>(std::move(exec))
+    {}
+
+    explicit SstepBicgstab(const Factory* factory,
+                           std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<SstepBicgstab>(factory->get_executor(),
+                                     gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType,
+                                              SstepBicgstab<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {
+        if (!parameters_.steps) {
+            parameters_.steps = sstep_bicgstab_default_steps;
+        }
+    }
+};
+
+
+template <typename ValueType>
+struct workspace_traits<SstepBicgstab<ValueType>> {
+    using Solver = SstepBicgstab<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int r = 0;
+    // search direction vector
+    constexpr static int p = 1;
+    // stacked basis vectors p, K p, ..., K^(2s) p, r, K r, ..., K^(2s-1) r
+    // with K = A M, followed by the shadow residual
+    constexpr static int basis = 2;
+    // stacked preconditioned basis vectors, i.e. M applied to basis
+    constexpr static int preconditioned_basis = 3;
+    // inner products between the basis vectors and the shadow residual
+    constexpr static int gram = 4;
+    // coefficients of the updates in the basis
+    constexpr static int coeffs = 5;
+    // constant 1.0 scalar
+    constexpr static int one = 6;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 7;
+
+    // stopping status array
+    constexpr static int stop = 0;
+    // reduction tmp array
+    constexpr static int tmp = 1;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_SSTEP_BICGSTAB_HPP_
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_SSTEP_CG_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_SSTEP_CG_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+constexpr size_type sstep_cg_default_steps = 4u;
+
+
+/**
+ * S-step CG is a communication-avoiding reformulation of the conjugate
+ * gradient method (following Chronopoulos and Gear) which is suitable for
+ * symmetric positive definite matrices.
+ *
+ * Every outer iteration performs s iterations of CG at once: It first builds
+ * a basis of the Krylov subspaces spanned by the search direction and the
+ * residual with a sequence of s SpMVs and preconditioner applications each
+ * (matrix powers kernel), then computes all inner products between the basis
+ * vectors in a single fused reduction. The s CG iterations are carried out on
+ * the coordinates of the vectors in this basis, which only requires the small
+ * matrix of inner products, before the solution, residual and search
+ * direction are updated. For distributed vectors, this reduces the number of
+ * global reductions from two per iteration to one per s iterations.
+ *
+ * The basis is built from monomials, so large values of s lead to an
+ * ill-conditioned basis and loss of accuracy. Values up to 5 are usually safe.
+ * To keep rounding errors from accumulating, the residual is recomputed
+ * explicitly after every outer iteration at the cost of one additional SpMV,
+ * and the inner iterations restart from the residual once its norm can no
+ * longer be resolved in the basis. The stopping criteria are only checked once per outer iteration, so the
+ * solver may perform up to s - 1 more iterations than required by an
+ * iteration-based stopping criterion.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class SstepCg
+    : public EnableLinOp<SstepCg<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType, SstepCg<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<SstepCg>;
+    friend class EnablePolymorphicObject<SstepCg, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = SstepCg<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    /**
+     * Gets the number of iterations performed per global reduction
+     *
+     * @return the number of steps s
+     */
+    size_type get_steps() const { return parameters_.steps; }
+
+    /**
+     * Sets the number of iterations performed per global reduction
+     *
+     * @param other  the new number of steps s
+     */
+    void set_steps(size_type other) { parameters_.steps = other; }
+
+    class Factory;
+
+    struct parameters_type
+        : enable_preconditioned_iterative_solver_factory_parameters<
+              parameters_type, Factory> {
+        /** Number of iterations per basis construction and reduction. */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(steps, 0u);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(SstepCg, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    explicit SstepCg(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<SstepCg>(std::move(exec))
+    {}
+
+    explicit SstepCg(const Factory* factory,
+                     std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<SstepCg>(factory->get_executor(),
+                               gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType, SstepCg<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {
+        if (!parameters_.steps) {
+            parameters_.steps = sstep_cg_default_steps;
+        }
+    }
+};
+
+
+template <typename ValueType>
+struct workspace_traits<SstepCg<ValueType>> {
+    using Solver = SstepCg<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int r = 0;
+    // search direction vector
+    constexpr static int p = 1;
+    // unpreconditioned search direction vector (p = M q)
+    constexpr static int q = 2;
+    // stacked basis vectors q, A p, ..., A T^(s-1) p, r, A z, ..., A T^(s-2) z
+    // with T = M A and z = M r
+    constexpr static int basis = 3;
+    // stacked preconditioned basis vectors p, T p, ..., T^s p, z, ...,
+    // T^(s-1) z, i.e. M applied to basis
+    constexpr static int preconditioned_basis = 4;
+    // inner products between the basis vectors
+    constexpr static int gram = 5;
+    // coefficients of the updates in the basis
+    constexpr static int coeffs = 6;
+    // rho scalar
+    constexpr static int rho = 7;
+    // constant 1.0 scalar
+    constexpr static int one = 8;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 9;
+
+    // stopping status array
+    constexpr static int stop = 0;
+    // reduction tmp array
+    constexpr static int tmp = 1;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_SSTEP_CG_HPP_
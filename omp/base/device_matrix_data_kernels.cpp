@@ -6,14 +6,18 @@
 
 
 #include <algorithm>
+#include <tuple>
 
 
 #include <omp.h>
 
 
 #include "core/base/allocator.hpp"
+#include "core/base/iterator_factory.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "omp/components/atomic.hpp"
+#include "omp/components/sorting.hpp"
 
 
 namespace gko {
@@ -134,15 +138,133 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SUM_DUPLICATES_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void sort_and_sum_duplicates(std::shared_ptr<const DefaultExecutor> exec,
+                             size_type num_rows, array<ValueType>& values,
+                             array<IndexType>& row_idxs,
+                             array<IndexType>& col_idxs)
+{
+    const auto size = values.get_size();
+    const auto in_rows = row_idxs.get_const_data();
+    const auto in_cols = col_idxs.get_const_data();
+    const auto in_vals = values.get_const_data();
+    // count the entries of every row
+    array<int64> row_ptrs_array{exec, num_rows + 1};
+    const auto row_ptrs = row_ptrs_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row <= num_rows; row++) {
+        row_ptrs[row] = 0;
+    }
+#pragma omp parallel for
+    for (size_type i = 0; i < size; i++) {
+        atomic_add(row_ptrs[in_rows[i]], int64{1});
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+    // scatter the column and entry indices and the values into their rows.
+    // The order within a row depends on the thread schedule, but is made
+    // deterministic by sorting by the entry index afterwards.
+    array<int64> row_fill_array{exec, num_rows};
+    array<IndexType> scattered_cols_array{exec, size};
+    array<int64> scattered_idxs_array{exec, size};
+    array<ValueType> scattered_vals_array{exec, size};
+    const auto row_fill = row_fill_array.get_data();
+    const auto scattered_cols = scattered_cols_array.get_data();
+    const auto scattered_idxs = scattered_idxs_array.get_data();
+    const auto scattered_vals = scattered_vals_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        row_fill[row] = row_ptrs[row];
+    }
+#pragma omp parallel for
+    for (size_type i = 0; i < size; i++) {
+        int64 out_i{};
+#pragma omp atomic capture
+        out_i = row_fill[in_rows[i]]++;
+        scattered_cols[out_i] = in_cols[i];
+        scattered_idxs[out_i] = static_cast<int64>(i);
+        scattered_vals[out_i] = in_vals[i];
+    }
+    // sort every row by column index and count its unique columns
+    array<int64> out_row_ptrs_array{exec, num_rows + 1};
+    const auto out_row_ptrs = out_row_ptrs_array.get_data();
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto begin = row_ptrs[row];
+        const auto end = row_ptrs[row + 1];
+        auto it = detail::make_zip_iterator(scattered_cols + begin,
+                                            scattered_idxs + begin,
+                                            scattered_vals + begin);
+        std::sort(it, it + (end - begin), [](auto a, auto b) {
+            return std::tie(std::get<0>(a), std::get<1>(a)) <
+                   std::tie(std::get<0>(b), std::get<1>(b));
+        });
+        int64 count_unique{};
+        auto col = invalid_index<IndexType>();
+        for (auto i = begin; i < end; i++) {
+            if (col != scattered_cols[i]) {
+                col = scattered_cols[i];
+                count_unique++;
+            }
+        }
+        out_row_ptrs[row] = count_unique;
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_rows + 1);
+    const auto out_size = static_cast<size_type>(out_row_ptrs[num_rows]);
+    // the input arrays are no longer read, so without duplicates the result
+    // can be written to the existing allocations
+    const bool reallocate = out_size < size;
+    array<ValueType> new_values{exec, reallocate ? out_size : 0};
+    array<IndexType> new_row_idxs{exec, reallocate ? out_size : 0};
+    array<IndexType> new_col_idxs{exec, reallocate ? out_size : 0};
+    const auto out_vals =
+        reallocate ? new_values.get_data() : values.get_data();
+    const auto out_rows =
+        reallocate ? new_row_idxs.get_data() : row_idxs.get_data();
+    const auto out_cols =
+        reallocate ? new_col_idxs.get_data() : col_idxs.get_data();
+    // reduce the duplicates of every row in their original order
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; row++) {
+        auto out_i = out_row_ptrs[row] - 1;
+        auto col = invalid_index<IndexType>();
+        for (auto i = row_ptrs[row]; i < row_ptrs[row + 1]; i++) {
+            if (col != scattered_cols[i]) {
+                col = scattered_cols[i];
+                out_i++;
+                out_rows[out_i] = static_cast<IndexType>(row);
+                out_cols[out_i] = col;
+                out_vals[out_i] = zero<ValueType>();
+            }
+            out_vals[out_i] += scattered_vals[i];
+        }
+    }
+    if (reallocate) {
+        values = std::move(new_values);
+        row_idxs = std::move(new_row_idxs);
+        col_idxs = std::move(new_col_idxs);
+    }
+}
+
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_AND_SUM_DUPLICATES_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void sort_row_major(std::shared_ptr<const DefaultExecutor> exec,
                     device_matrix_data<ValueType, IndexType>& data)
 {
-    array<matrix_data_entry<ValueType, IndexType>> tmp{
-        exec, data.get_num_stored_elements()};
-    soa_to_aos(exec, data, tmp);
-    std::sort(tmp.get_data(), tmp.get_data() + tmp.get_size());
-    aos_to_soa(exec, tmp, data);
+    const auto size = data.get_num_stored_elements();
+    array<int64> permutation{exec, size};
+    compute_row_major_permutation(exec, data.get_const_row_idxs(),
+                                  data.get_const_col_idxs(), size,
+                                  permutation.get_data());
+    apply_permutation(exec, permutation.get_const_data(), size,
+                      data.get_row_idxs());
+    apply_permutation(exec, permutation.get_const_data(), size,
+                      data.get_col_idxs());
+    apply_permutation(exec, permutation.get_const_data(), size,
+                      data.get_values());
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
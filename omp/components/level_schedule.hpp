@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_COMPONENTS_LEVEL_SCHEDULE_HPP_
+#define GKO_OMP_COMPONENTS_LEVEL_SCHEDULE_HPP_
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+
+
+/**
+ * Groups the indices 0, ..., size - 1 by their level using a stable counting
+ * sort. Afterwards, level `l` consists of the indices
+ * `level_idxs[level_ptrs[l]]` to `level_idxs[level_ptrs[l + 1] - 1]` in
+ * ascending order.
+ *
+ * @param levels  the level of each index, in the range [0, num_levels)
+ * @param size  the number of indices
+ * @param num_levels  the number of levels
+ * @param level_ptrs  the output array of size num_levels + 1 containing the
+ *                    beginning of each level in level_idxs
+ * @param level_idxs  the output array of size `size` containing the indices
+ *                    grouped by level
+ */
+template <typename IndexType>
+void group_by_level(const IndexType* levels, IndexType size,
+                    IndexType num_levels, IndexType* level_ptrs,
+                    IndexType* level_idxs)
+{
+    std::fill_n(level_ptrs, num_levels + 1, IndexType{});
+    for (IndexType i = 0; i < size; i++) {
+        level_ptrs[levels[i] + 1]++;
+    }
+    std::partial_sum(level_ptrs, level_ptrs + num_levels + 1, level_ptrs);
+    for (IndexType i = 0; i < size; i++) {
+        level_idxs[level_ptrs[levels[i]]++] = i;
+    }
+    // the scatter shifted each pointer to the beginning of the next level
+    std::copy_backward(level_ptrs, level_ptrs + num_levels,
+                       level_ptrs + num_levels + 1);
+    level_ptrs[0] = 0;
+}
+
+
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_COMPONENTS_LEVEL_SCHEDULE_HPP_
@@ -0,0 +1,391 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_COMPONENTS_SORTING_HPP_
+#define GKO_OMP_COMPONENTS_SORTING_HPP_
+
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/base/iterator_factory.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+namespace sorting {
+
+
+/** Inputs smaller than this are sorted sequentially. */
+constexpr size_type parallel_sort_threshold = 1 << 14;
+
+/** Number of bits of the key that are processed by a single radix pass. */
+constexpr int radix_bits = 8;
+
+constexpr int radix_size = 1 << radix_bits;
+
+
+/**
+ * Returns the offset of key from min_key as an unsigned 64 bit integer, which
+ * preserves the ordering of the keys no matter if they are signed or not.
+ */
+template <typename KeyType>
+inline uint64 radix_offset(KeyType key, KeyType min_key)
+{
+    using unsigned_type = std::make_unsigned_t<KeyType>;
+    return static_cast<uint64>(static_cast<unsigned_type>(
+        static_cast<unsigned_type>(key) - static_cast<unsigned_type>(min_key)));
+}
+
+
+/**
+ * Computes the number of elements from a that precede the first diagonal
+ * elements of the stable merge of a and b, i.e. the merge-path split point.
+ */
+template <typename ValueType, typename Comparator>
+size_type merge_path_split(const ValueType* a, size_type a_size,
+                           const ValueType* b, size_type b_size,
+                           size_type diagonal, Comparator comp)
+{
+    auto lo = diagonal > b_size ? diagonal - b_size : size_type{};
+    auto hi = std::min(diagonal, a_size);
+    while (lo < hi) {
+        const auto a_idx = lo + (hi - lo) / 2;
+        const auto b_idx = diagonal - a_idx;
+        // ties are resolved in favor of a to keep the merge stable
+        if (b_idx > 0 && !comp(b[b_idx - 1], a[a_idx])) {
+            lo = a_idx + 1;
+        } else {
+            hi = a_idx;
+        }
+    }
+    return lo;
+}
+
+
+/**
+ * Implements radix_sort_by_key. If values is nullptr, only the keys are
+ * sorted.
+ */
+template <typename KeyType, typename ValueType>
+void radix_sort_impl(std::shared_ptr<const OmpExecutor> exec, KeyType* keys,
+                     ValueType* values, size_type size)
+{
+    static_assert(std::is_integral<KeyType>::value,
+                  "radix sort requires integer keys");
+    if (size < parallel_sort_threshold) {
+        if (values) {
+            auto it = gko::detail::make_zip_iterator(keys, values);
+            std::stable_sort(it, it + size, [](auto a, auto b) {
+                return std::get<0>(a) < std::get<0>(b);
+            });
+        } else {
+            std::sort(keys, keys + size);
+        }
+        return;
+    }
+    auto min_key = keys[0];
+    auto max_key = keys[0];
+#pragma omp parallel for reduction(min : min_key) reduction(max : max_key)
+    for (size_type i = 0; i < size; i++) {
+        min_key = std::min(min_key, keys[i]);
+        max_key = std::max(max_key, keys[i]);
+    }
+    // only the bits that differ between the smallest and largest key matter
+    const auto range = radix_offset(max_key, min_key);
+    int num_bits{};
+    while (num_bits < 64 && (range >> num_bits) != 0) {
+        num_bits++;
+    }
+    const auto num_chunks = static_cast<size_type>(omp_get_max_threads());
+    const auto per_chunk = static_cast<size_type>(ceildiv(size, num_chunks));
+    vector<KeyType> tmp_keys(size, {exec});
+    vector<ValueType> tmp_values(values ? size : 0, {exec});
+    vector<size_type> offsets(num_chunks * radix_size, {exec});
+    auto in_keys = keys;
+    auto out_keys = tmp_keys.data();
+    auto in_values = values;
+    auto out_values = tmp_values.data();
+    for (int shift = 0; shift < num_bits; shift += radix_bits) {
+        const auto digit = [&](KeyType key) {
+            return static_cast<int>((radix_offset(key, min_key) >> shift) &
+                                    (radix_size - 1));
+        };
+        // count the digits of every chunk
+#pragma omp parallel for
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            const auto begin = std::min(size, chunk * per_chunk);
+            const auto end = std::min(size, begin + per_chunk);
+            const auto local_offsets = offsets.data() + chunk * radix_size;
+            std::fill_n(local_offsets, radix_size, size_type{});
+            for (auto i = begin; i < end; i++) {
+                local_offsets[digit(in_keys[i])]++;
+            }
+        }
+        // if all keys share the same digit, this pass is a no-op
+        bool trivial_pass{};
+        for (int d = 0; d < radix_size; d++) {
+            size_type count{};
+            for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+                count += offsets[chunk * radix_size + d];
+            }
+            trivial_pass = trivial_pass || count == size;
+        }
+        if (trivial_pass) {
+            continue;
+        }
+        // the output positions are ordered by digit first and chunk second,
+        // which keeps the sort stable
+        size_type sum{};
+        for (int d = 0; d < radix_size; d++) {
+            for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+                const auto count = offsets[chunk * radix_size + d];
+                offsets[chunk * radix_size + d] = sum;
+                sum += count;
+            }
+        }
+#pragma omp parallel for
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            const auto begin = std::min(size, chunk * per_chunk);
+            const auto end = std::min(size, begin + per_chunk);
+            const auto local_offsets = offsets.data() + chunk * radix_size;
+            for (auto i = begin; i < end; i++) {
+                const auto out_i = local_offsets[digit(in_keys[i])]++;
+                out_keys[out_i] = in_keys[i];
+                if (values) {
+                    out_values[out_i] = in_values[i];
+                }
+            }
+        }
+        std::swap(in_keys, out_keys);
+        std::swap(in_values, out_values);
+    }
+    if (in_keys != keys) {
+#pragma omp parallel for
+        for (size_type i = 0; i < size; i++) {
+            keys[i] = in_keys[i];
+            if (values) {
+                values[i] = in_values[i];
+            }
+        }
+    }
+}
+
+
+}  // namespace sorting
+
+
+/**
+ * Sorts the integer keys in ascending order using a parallel LSD radix sort.
+ * Only the bits in which the smallest and largest key differ are processed,
+ * so small key ranges need fewer passes.
+ *
+ * @param exec  the executor used to allocate temporary storage
+ * @param keys  the keys to sort
+ * @param size  the number of keys
+ */
+template <typename KeyType>
+void radix_sort(std::shared_ptr<const OmpExecutor> exec, KeyType* keys,
+                size_type size)
+{
+    sorting::radix_sort_impl(std::move(exec), keys,
+                            static_cast<KeyType*>(nullptr), size);
+}
+
+
+/**
+ * Sorts the integer keys in ascending order using a parallel LSD radix sort
+ * and applies the same permutation to the values. The sort is stable, i.e.
+ * values with equal keys keep their relative order.
+ *
+ * @param exec  the executor used to allocate temporary storage
+ * @param keys  the keys to sort
+ * @param values  the values to permute alongside the keys
+ * @param size  the number of keys and values
+ */
+template <typename KeyType, typename ValueType>
+void radix_sort_by_key(std::shared_ptr<const OmpExecutor> exec, KeyType* keys,
+                       ValueType* values, size_type size)
+{
+    sorting::radix_sort_impl(std::move(exec), keys, values, size);
+}
+
+
+/**
+ * Sorts the elements such that comp(data[i + 1], data[i]) is false for all i
+ * using a parallel merge sort. The data is split into one contiguous chunk per
+ * available thread and every chunk is sorted, then the sorted chunks are merged
+ * pairwise, where every merge is split among the chunks along its merge path.
+ * The sort is stable.
+ *
+ * @param exec  the executor used to allocate temporary storage
+ * @param data  the elements to sort
+ * @param size  the number of elements
+ * @param comp  the strict weak ordering to sort by
+ */
+template <typename ValueType, typename Comparator>
+void parallel_stable_sort(std::shared_ptr<const OmpExecutor> exec,
+                          ValueType* data, size_type size, Comparator comp)
+{
+    const auto num_chunks = static_cast<size_type>(omp_get_max_threads());
+    if (size < sorting::parallel_sort_threshold || num_chunks == 1) {
+        std::stable_sort(data, data + size, comp);
+        return;
+    }
+    const auto per_chunk = static_cast<size_type>(ceildiv(size, num_chunks));
+#pragma omp parallel for
+    for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+        const auto begin = std::min(size, chunk * per_chunk);
+        const auto end = std::min(size, begin + per_chunk);
+        std::stable_sort(data + begin, data + end, comp);
+    }
+    vector<ValueType> tmp(size, {exec});
+    auto in = data;
+    auto out = tmp.data();
+    for (auto width = per_chunk; width < size; width *= 2) {
+        // every chunk is an equally sized part of the output, which
+        // may be covered by several merges of width-sized runs
+#pragma omp parallel for
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            const auto out_begin = std::min(size, chunk * per_chunk);
+            const auto out_end = std::min(size, out_begin + per_chunk);
+            auto merge_begin = out_begin / (2 * width) * (2 * width);
+            for (; merge_begin < out_end; merge_begin += 2 * width) {
+                const auto a = in + merge_begin;
+                const auto a_size = std::min(width, size - merge_begin);
+                const auto b = a + a_size;
+                const auto b_size =
+                    std::min(width, size - merge_begin - a_size);
+                const auto merge_size = a_size + b_size;
+                const auto local_begin =
+                    std::max(out_begin, merge_begin) - merge_begin;
+                const auto local_end =
+                    std::min(out_end, merge_begin + merge_size) - merge_begin;
+                const auto a_begin = sorting::merge_path_split(
+                    a, a_size, b, b_size, local_begin, comp);
+                const auto a_end = sorting::merge_path_split(
+                    a, a_size, b, b_size, local_end, comp);
+                std::merge(a + a_begin, a + a_end, b + (local_begin - a_begin),
+                           b + (local_end - a_end),
+                           out + merge_begin + local_begin, comp);
+            }
+        }
+        std::swap(in, out);
+    }
+    if (in != data) {
+#pragma omp parallel for
+        for (size_type i = 0; i < size; i++) {
+            data[i] = in[i];
+        }
+    }
+}
+
+
+/**
+ * Computes the permutation that sorts the given (row, column) index pairs in
+ * row-major order, i.e. lexicographically by row first and column second.
+ * Pairs that compare equal keep their relative order.
+ *
+ * @param exec  the executor used to allocate temporary storage
+ * @param row_idxs  the row indices
+ * @param col_idxs  the column indices
+ * @param size  the number of index pairs
+ * @param permutation  the output permutation, such that
+ *                     (row_idxs[permutation[i]], col_idxs[permutation[i]])
+ *                     is sorted.
+ */
+template <typename IndexType, typename PermutationType>
+void compute_row_major_permutation(std::shared_ptr<const OmpExecutor> exec,
+                                   const IndexType* row_idxs,
+                                   const IndexType* col_idxs, size_type size,
+                                   PermutationType* permutation)
+{
+#pragma omp parallel for
+    for (size_type i = 0; i < size; i++) {
+        permutation[i] = static_cast<PermutationType>(i);
+    }
+    if (size == 0) {
+        return;
+    }
+    auto min_row = row_idxs[0];
+    auto max_row = row_idxs[0];
+    auto min_col = col_idxs[0];
+    auto max_col = col_idxs[0];
+#pragma omp parallel for reduction(min : min_row, min_col) \
+    reduction(max : max_row, max_col)
+    for (size_type i = 0; i < size; i++) {
+        min_row = std::min(min_row, row_idxs[i]);
+        max_row = std::max(max_row, row_idxs[i]);
+        min_col = std::min(min_col, col_idxs[i]);
+        max_col = std::max(max_col, col_idxs[i]);
+    }
+    const auto row_range = sorting::radix_offset(max_row, min_row);
+    const auto col_range = sorting::radix_offset(max_col, min_col);
+    vector<uint64> keys(size, {exec});
+    if (col_range < std::numeric_limits<uint64>::max() &&
+        row_range < std::numeric_limits<uint64>::max() / (col_range + 1)) {
+        // the linearized index fits into a single key
+#pragma omp parallel for
+        for (size_type i = 0; i < size; i++) {
+            keys[i] = sorting::radix_offset(row_idxs[i], min_row) *
+                          (col_range + 1) +
+                      sorting::radix_offset(col_idxs[i], min_col);
+        }
+        radix_sort_by_key(exec, keys.data(), permutation, size);
+    } else {
+        // sort by column first, then stably by row
+#pragma omp parallel for
+        for (size_type i = 0; i < size; i++) {
+            keys[i] = sorting::radix_offset(col_idxs[i], min_col);
+        }
+        radix_sort_by_key(exec, keys.data(), permutation, size);
+#pragma omp parallel for
+        for (size_type i = 0; i < size; i++) {
+            keys[i] = sorting::radix_offset(row_idxs[permutation[i]], min_row);
+        }
+        radix_sort_by_key(exec, keys.data(), permutation, size);
+    }
+}
+
+
+/**
+ * Permutes the array in-place, such that data[i] = old_data[permutation[i]].
+ *
+ * @param exec  the executor used to allocate temporary storage
+ * @param permutation  the permutation to apply
+ * @param size  the size of the permutation and data
+ * @param data  the array to permute
+ */
+template <typename PermutationType, typename ValueType>
+void apply_permutation(std::shared_ptr<const OmpExecutor> exec,
+                       const PermutationType* permutation, size_type size,
+                       ValueType* data)
+{
+    vector<ValueType> tmp(data, data + size, {exec});
+#pragma omp parallel for
+    for (size_type i = 0; i < size; i++) {
+        data[i] = tmp[permutation[i]];
+    }
+}
+
+
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_COMPONENTS_SORTING_HPP_
@@ -12,12 +12,13 @@
 #include <ginkgo/core/matrix/csr.hpp>
 
 
-#include "core/base/iterator_factory.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/factorization/elimination_forest.hpp"
 #include "core/factorization/lu_kernels.hpp"
 #include "core/matrix/csr_lookup.hpp"
+#include "omp/components/level_schedule.hpp"
+#include "omp/components/sorting.hpp"
 
 
 namespace gko {
@@ -165,9 +166,8 @@ void forest_from_factor(
     array<IndexType> parents_copy{exec, static_cast<size_type>(num_rows)};
     exec->copy(num_rows, parents, parents_copy.get_data());
     components::fill_seq_array(exec, children, num_rows);
-    const auto it =
-        detail::make_zip_iterator(parents_copy.get_data(), children);
-    std::stable_sort(it, it + num_rows);
+    radix_sort_by_key(exec, parents_copy.get_data(), children,
+                      static_cast<size_type>(num_rows));
     components::convert_idxs_to_ptrs(exec, parents_copy.get_const_data(),
                                      num_rows, num_rows + 1, child_ptrs);
 }
@@ -195,13 +195,9 @@ void initialize(std::shared_ptr<const DefaultExecutor> exec,
     const auto col_idxs = factors->get_const_col_idxs();
     components::convert_ptrs_to_idxs(exec, factors->get_const_row_ptrs(),
                                      factors->get_size()[0], row_idxs);
-    components::fill_seq_array(exec, transpose_idxs, nnz);
     // compute nonzero permutation for sparse transpose
-    std::sort(transpose_idxs, transpose_idxs + nnz,
-              [&](IndexType i, IndexType j) {
-                  return std::tie(col_idxs[i], row_idxs[i]) <
-                         std::tie(col_idxs[j], row_idxs[j]);
-              });
+    compute_row_major_permutation(exec, col_idxs, row_idxs, nnz,
+                                  transpose_idxs);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CHOLESKY_INITIALIZE);
@@ -216,38 +212,70 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
                matrix::Csr<ValueType, IndexType>* factors,
                array<int>& tmp_storage)
 {
-    const auto num_rows = factors->get_size()[0];
+    const auto num_rows = static_cast<IndexType>(factors->get_size()[0]);
     const auto row_ptrs = factors->get_const_row_ptrs();
     const auto cols = factors->get_const_col_idxs();
     const auto vals = factors->get_values();
-    for (size_type row = 0; row < num_rows; row++) {
-        const auto row_begin = row_ptrs[row];
-        const auto row_diag = diag_idxs[row];
-        matrix::csr::device_sparsity_lookup<IndexType> lookup{
-            row_ptrs, cols, lookup_offsets, lookup_storage, lookup_descs, row};
-        for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
-            const auto dep = cols[lower_nz];
-            const auto dep_diag_idx = diag_idxs[dep];
-            const auto dep_diag = vals[dep_diag_idx];
-            const auto dep_end = row_ptrs[dep + 1];
-            const auto scale = vals[lower_nz] / dep_diag;
-            vals[lower_nz] = scale;
-            for (auto dep_nz = dep_diag_idx + 1; dep_nz < dep_end; dep_nz++) {
-                const auto col = cols[dep_nz];
-                if (col < row) {
-                    const auto val = vals[dep_nz];
-                    const auto nz = row_begin + lookup.lookup_unsafe(col);
-                    vals[nz] -= scale * val;
+    const auto parents = forest.parents.get_const_data();
+    // Each row only depends on the rows in its subtree of the elimination
+    // forest, so rows of the same height in the forest can be factorized
+    // independently. We group the rows by their height to process the forest
+    // bottom-up, one level at a time.
+    array<IndexType> height_array{exec, static_cast<size_type>(num_rows)};
+    array<IndexType> level_row_array{exec, static_cast<size_type>(num_rows)};
+    array<IndexType> level_ptr_array{exec,
+                                     static_cast<size_type>(num_rows + 1)};
+    const auto heights = height_array.get_data();
+    const auto level_rows = level_row_array.get_data();
+    const auto level_ptrs = level_ptr_array.get_data();
+    std::fill_n(heights, num_rows, IndexType{});
+    IndexType num_levels{};
+    // parents always have a larger index than their children
+    for (IndexType row = 0; row < num_rows; row++) {
+        const auto parent = parents[row];
+        if (parent < num_rows) {
+            heights[parent] = std::max(heights[parent], heights[row] + 1);
+        }
+        num_levels = std::max(num_levels, heights[row] + 1);
+    }
+    group_by_level(heights, num_rows, num_levels, level_ptrs, level_rows);
+#pragma omp parallel
+    for (IndexType level = 0; level < num_levels; level++) {
+        // the work per row varies strongly, and the implicit barrier at the
+        // end of the loop makes sure all dependencies are computed
+#pragma omp for schedule(dynamic)
+        for (IndexType i = level_ptrs[level]; i < level_ptrs[level + 1]; i++) {
+            const auto row = level_rows[i];
+            const auto row_begin = row_ptrs[row];
+            const auto row_diag = diag_idxs[row];
+            matrix::csr::device_sparsity_lookup<IndexType> lookup{
+                row_ptrs,       cols,         lookup_offsets,
+                lookup_storage, lookup_descs, static_cast<size_type>(row)};
+            for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
+                const auto dep = cols[lower_nz];
+                const auto dep_diag_idx = diag_idxs[dep];
+                const auto dep_diag = vals[dep_diag_idx];
+                const auto dep_end = row_ptrs[dep + 1];
+                const auto scale = vals[lower_nz] / dep_diag;
+                vals[lower_nz] = scale;
+                for (auto dep_nz = dep_diag_idx + 1; dep_nz < dep_end;
+                     dep_nz++) {
+                    const auto col = cols[dep_nz];
+                    if (col < row) {
+                        const auto val = vals[dep_nz];
+                        const auto nz = row_begin + lookup.lookup_unsafe(col);
+                        vals[nz] -= scale * val;
+                    }
                 }
             }
+            ValueType diag = vals[row_diag];
+            for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
+                diag -= squared_norm(vals[lower_nz]);
+                // copy the lower triangular entries to the transpose
+                vals[transpose_idxs[lower_nz]] = conj(vals[lower_nz]);
+            }
+            vals[row_diag] = sqrt(diag);
         }
-        ValueType diag = vals[row_diag];
-        for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
-            diag -= squared_norm(vals[lower_nz]);
-            // copy the lower triangular entries to the transpose
-            vals[transpose_idxs[lower_nz]] = conj(vals[lower_nz]);
-        }
-        vals[row_diag] = sqrt(diag);
     }
 }
 
@@ -14,6 +14,7 @@
 
 #include "core/base/allocator.hpp"
 #include "core/matrix/csr_lookup.hpp"
+#include "omp/components/level_schedule.hpp"
 
 
 namespace gko {
@@ -70,18 +71,19 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
                const IndexType* lookup_offsets, const int64* lookup_descs,
                const int32* lookup_storage, const IndexType* diag_idxs,
                matrix::Csr<ValueType, IndexType>* factors,
+               experimental::factorization::numeric_type algorithm,
                array<int>& tmp_storage)
 {
-    const auto num_rows = factors->get_size()[0];
+    const auto num_rows = static_cast<IndexType>(factors->get_size()[0]);
     const auto row_ptrs = factors->get_const_row_ptrs();
     const auto cols = factors->get_const_col_idxs();
     const auto vals = factors->get_values();
-    // TODO parallelize
-    for (size_type row = 0; row < num_rows; row++) {
+    const auto factorize_row = [&](IndexType row) {
         const auto row_begin = row_ptrs[row];
         const auto row_diag = diag_idxs[row];
         matrix::csr::device_sparsity_lookup<IndexType> lookup{
-            row_ptrs, cols, lookup_offsets, lookup_storage, lookup_descs, row};
+            row_ptrs,       cols,         lookup_offsets,
+            lookup_storage, lookup_descs, static_cast<size_type>(row)};
         for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
             const auto dep = cols[lower_nz];
             const auto dep_diag_idx = diag_idxs[dep];
@@ -96,6 +98,41 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
                 vals[nz] -= scale * val;
             }
         }
+    };
+    if (algorithm == experimental::factorization::numeric_type::sequential) {
+        for (IndexType row = 0; row < num_rows; row++) {
+            factorize_row(row);
+        }
+        return;
+    }
+    // A row only depends on the rows referenced by its lower triangular
+    // entries, so its level is one more than the maximum level of these rows.
+    array<IndexType> level_array{exec, static_cast<size_type>(num_rows)};
+    array<IndexType> level_row_array{exec, static_cast<size_type>(num_rows)};
+    array<IndexType> level_ptr_array{exec,
+                                     static_cast<size_type>(num_rows + 1)};
+    const auto levels = level_array.get_data();
+    const auto level_rows = level_row_array.get_data();
+    const auto level_ptrs = level_ptr_array.get_data();
+    IndexType num_levels{};
+    for (IndexType row = 0; row < num_rows; row++) {
+        IndexType level{};
+        for (auto lower_nz = row_ptrs[row]; lower_nz < diag_idxs[row];
+             lower_nz++) {
+            level = std::max(level, levels[cols[lower_nz]] + 1);
+        }
+        levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+    group_by_level(levels, num_rows, num_levels, level_ptrs, level_rows);
+#pragma omp parallel
+    for (IndexType level = 0; level < num_levels; level++) {
+        // the work per row varies strongly, and the implicit barrier at the
+        // end of the loop makes sure all dependencies are computed
+#pragma omp for schedule(dynamic)
+        for (IndexType i = level_ptrs[level]; i < level_ptrs[level + 1]; i++) {
+            factorize_row(level_rows[i]);
+        }
     }
 }
 
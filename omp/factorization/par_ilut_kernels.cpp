@@ -38,24 +38,173 @@ namespace omp {
 namespace par_ilut_factorization {
 
 
+constexpr auto bucket_count = 1 << sampleselect_searchtree_height;
+constexpr auto sample_size = bucket_count * sampleselect_oversampling;
+// below this size, a serial selection is cheaper than another bucketing pass
+constexpr auto select_serial_size = sample_size * sampleselect_oversampling;
+
+
+/**
+ * @internal
+ *
+ * Performs a single sampleselect step on the magnitudes get_abs(i),
+ * 0 <= i < size: The elements are distributed to bucket_count buckets based
+ * on splitters picked from a sorted sample, the bucket containing the
+ * element of rank `rank` is determined and its elements are copied to the
+ * output returned by get_output(bucket_size), preserving their order.
+ * On return, `rank` is relative to the selected bucket.
+ *
+ * @param sample  storage for sample_size magnitudes
+ * @param histograms  storage for (num_threads + 1) * bucket_count + 1 indices
+ *
+ * @return the number of elements in the selected bucket
+ */
+template <typename AbsType, typename IndexType, typename AbsAccessor,
+          typename OutputFactory>
+IndexType sampleselect_bucket(IndexType size, IndexType& rank,
+                              AbsAccessor get_abs, AbsType* sample,
+                              IndexType* histograms,
+                              OutputFactory get_output)
+{
+    // pick and sort sample
+    // assuming rounding towards zero
+    auto stride = double(size) / sample_size;
+    for (IndexType i = 0; i < sample_size; ++i) {
+        sample[i] = get_abs(static_cast<IndexType>(i * stride));
+    }
+    std::sort(sample, sample + sample_size);
+    // pick splitters
+    for (IndexType i = 0; i < bucket_count - 1; ++i) {
+        // shift by one so we get upper bounds for the buckets
+        sample[i] = sample[(i + 1) * sampleselect_oversampling];
+    }
+    auto bucket_of = [&](IndexType i) {
+        // smallest bucket s.t. sample[bucket] > get_abs(i)
+        return static_cast<IndexType>(std::distance(
+            sample,
+            std::upper_bound(sample, sample + bucket_count - 1, get_abs(i))));
+    };
+    auto total_histogram = histograms;
+    auto local_histograms = histograms + bucket_count + 1;
+    const auto max_threads = omp_get_max_threads();
+    std::fill_n(local_histograms, max_threads * bucket_count, IndexType{});
+    IndexType threshold_bucket{};
+    IndexType bucket_size{};
+    AbsType* output{};
+#pragma omp parallel
+    {
+        const auto tid = omp_get_thread_num();
+        const auto num_threads = omp_get_num_threads();
+        auto local_histogram = local_histograms + tid * bucket_count;
+        // count elements per bucket
+#pragma omp for schedule(static)
+        for (IndexType i = 0; i < size; ++i) {
+            local_histogram[bucket_of(i)]++;
+        }
+        // determine the bucket containing the rank:
+        // prefix_sum[bucket] <= rank < prefix_sum[bucket + 1]
+#pragma omp single
+        {
+            IndexType partial_sum{};
+            for (IndexType bucket = 0; bucket < bucket_count; ++bucket) {
+                total_histogram[bucket] = partial_sum;
+                for (int thread = 0; thread < num_threads; ++thread) {
+                    partial_sum +=
+                        local_histograms[thread * bucket_count + bucket];
+                }
+            }
+            total_histogram[bucket_count] = partial_sum;
+            auto it = std::upper_bound(
+                total_histogram, total_histogram + bucket_count + 1, rank);
+            threshold_bucket = static_cast<IndexType>(
+                std::distance(total_histogram + 1, it));
+            bucket_size = total_histogram[threshold_bucket + 1] -
+                          total_histogram[threshold_bucket];
+            output = get_output(bucket_size);
+        }
+        // the loop schedule is the same as above, so each thread knows the
+        // output offset for its elements of the threshold bucket
+        IndexType offset{};
+        for (int thread = 0; thread < tid; ++thread) {
+            offset +=
+                local_histograms[thread * bucket_count + threshold_bucket];
+        }
+#pragma omp for schedule(static)
+        for (IndexType i = 0; i < size; ++i) {
+            if (bucket_of(i) == threshold_bucket) {
+                output[offset] = get_abs(i);
+                ++offset;
+            }
+        }
+    }
+    rank -= total_histogram[threshold_bucket];
+    return bucket_size;
+}
+
+
+/**
+ * @internal
+ *
+ * Selects the `rank`th smallest element (0-based, magnitude-wise)
+ * from the values of `m`. Large inputs are recursively reduced in parallel
+ * to the sampleselect bucket containing the `rank`th element, which is
+ * stored in `tmp2`, until it is small enough for a serial selection.
+ * `tmp` stores the sample and bucket histograms.
+ */
 template <typename ValueType, typename IndexType>
 void threshold_select(std::shared_ptr<const DefaultExecutor> exec,
                       const matrix::Csr<ValueType, IndexType>* m,
                       IndexType rank, array<ValueType>& tmp,
-                      array<remove_complex<ValueType>>&,
+                      array<remove_complex<ValueType>>& tmp2,
                       remove_complex<ValueType>& threshold)
 {
+    using AbsType = remove_complex<ValueType>;
     auto values = m->get_const_values();
     IndexType size = m->get_num_stored_elements();
-    tmp.resize_and_reset(size);
-    std::copy_n(values, size, tmp.get_data());
-
-    auto begin = tmp.get_data();
-    auto target = begin + rank;
-    auto end = begin + size;
-    std::nth_element(begin, target, end,
-                     [](ValueType a, ValueType b) { return abs(a) < abs(b); });
-    threshold = abs(*target);
+    if (size <= select_serial_size) {
+        tmp2.resize_and_reset(size);
+        auto begin = tmp2.get_data();
+        std::transform(values, values + size, begin,
+                       [](ValueType val) { return abs(val); });
+        std::nth_element(begin, begin + rank, begin + size);
+        threshold = begin[rank];
+        return;
+    }
+    auto num_threads = omp_get_max_threads();
+    auto storage_size =
+        ceildiv(sample_size * sizeof(AbsType) +
+                    (bucket_count * (num_threads + 1) + 1) * sizeof(IndexType),
+                sizeof(ValueType));
+    tmp.resize_and_reset(storage_size);
+    auto sample = reinterpret_cast<AbsType*>(tmp.get_data());
+    auto histograms = reinterpret_cast<IndexType*>(sample + sample_size);
+    // the first bucket is stored in the first half of tmp2, the following
+    // (smaller) buckets alternate between the two halves
+    IndexType half_size{};
+    size = sampleselect_bucket(
+        size, rank, [&](IndexType i) { return abs(values[i]); }, sample,
+        histograms, [&](IndexType bucket_size) {
+            half_size = bucket_size;
+            tmp2.resize_and_reset(2 * bucket_size);
+            return tmp2.get_data();
+        });
+    auto input = tmp2.get_data();
+    while (size > select_serial_size) {
+        auto output = input == tmp2.get_data() ? input + half_size
+                                               : tmp2.get_data();
+        auto new_size = sampleselect_bucket(
+            size, rank, [&](IndexType i) { return input[i]; }, sample,
+            histograms, [&](IndexType) { return output; });
+        input = output;
+        if (new_size == size) {
+            // the splitters cannot separate the remaining elements, which
+            // happens for many repeated values
+            break;
+        }
+        size = new_size;
+    }
+    std::nth_element(input, input + rank, input + size);
+    threshold = input[rank];
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -152,10 +301,6 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_KERNEL);
 
 
-constexpr auto bucket_count = 1 << sampleselect_searchtree_height;
-constexpr auto sample_size = bucket_count * sampleselect_oversampling;
-
-
 template <typename ValueType, typename IndexType>
 void threshold_filter_approx(std::shared_ptr<const DefaultExecutor> exec,
                              const matrix::Csr<ValueType, IndexType>* m,
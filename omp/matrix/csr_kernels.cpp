@@ -6,6 +6,7 @@
 
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <numeric>
 #include <utility>
@@ -33,6 +34,7 @@
 #include "core/matrix/csr_accessor_helper.hpp"
 #include "core/matrix/csr_builder.hpp"
 #include "omp/components/csr_spgeam.hpp"
+#include "omp/components/sorting.hpp"
 
 
 namespace gko {
@@ -46,41 +48,303 @@ namespace omp {
 namespace csr {
 
 
-template <typename MatrixValueType, typename InputValueType,
-          typename OutputValueType, typename IndexType>
-void spmv(std::shared_ptr<const OmpExecutor> exec,
-          const matrix::Csr<MatrixValueType, IndexType>* a,
-          const matrix::Dense<InputValueType>* b,
-          matrix::Dense<OutputValueType>* c)
+template <int num_rhs, typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Csr<MatrixValueType, IndexType>* a,
+                    const matrix::Dense<InputValueType>* b,
+                    matrix::Dense<OutputValueType>* c, OutFn out)
 {
+    GKO_ASSERT(b->get_size()[1] == num_rhs);
     using arithmetic_type =
         highest_precision<MatrixValueType, InputValueType, OutputValueType>;
 
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto a_vals =
+        acc::helper::build_const_rrm_accessor<arithmetic_type>(a);
+    const auto b_vals =
+        acc::helper::build_const_rrm_accessor<arithmetic_type>(b);
 
+#pragma omp parallel for
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        std::array<arithmetic_type, num_rhs> partial_sum;
+        partial_sum.fill(zero<arithmetic_type>());
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; k++) {
+            arithmetic_type val = a_vals(k);
+            auto col = col_idxs[k];
+#pragma unroll
+            for (size_type j = 0; j < num_rhs; j++) {
+                partial_sum[j] += val * b_vals(col, j);
+            }
+        }
+#pragma unroll
+        for (size_type j = 0; j < num_rhs; j++) {
+            [&] { c->at(row, j) = out(row, j, partial_sum[j]); }();
+        }
+    }
+}
+
+
+template <int block_size, typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Csr<MatrixValueType, IndexType>* a,
+                  const matrix::Dense<InputValueType>* b,
+                  matrix::Dense<OutputValueType>* c, OutFn out)
+{
+    GKO_ASSERT(b->get_size()[1] > block_size);
+    using arithmetic_type =
+        highest_precision<MatrixValueType, InputValueType, OutputValueType>;
+
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
     const auto a_vals =
         acc::helper::build_const_rrm_accessor<arithmetic_type>(a);
     const auto b_vals =
         acc::helper::build_const_rrm_accessor<arithmetic_type>(b);
-    auto c_vals = acc::helper::build_rrm_accessor<arithmetic_type>(c);
+    const auto num_rhs = b->get_size()[1];
+    const auto rounded_rhs = num_rhs / block_size * block_size;
 
 #pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            auto sum = zero<arithmetic_type>();
-            for (size_type k = row_ptrs[row];
-                 k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
+    for (size_type row = 0; row < a->get_size()[0]; row++) {
+        std::array<arithmetic_type, block_size> partial_sum;
+        for (size_type rhs_base = 0; rhs_base < rounded_rhs;
+             rhs_base += block_size) {
+            partial_sum.fill(zero<arithmetic_type>());
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; k++) {
                 arithmetic_type val = a_vals(k);
                 auto col = col_idxs[k];
+#pragma unroll
+                for (size_type j = 0; j < block_size; j++) {
+                    partial_sum[j] += val * b_vals(col, j + rhs_base);
+                }
+            }
+#pragma unroll
+            for (size_type j = 0; j < block_size; j++) {
+                const auto col = j + rhs_base;
+                [&] { c->at(row, col) = out(row, col, partial_sum[j]); }();
+            }
+        }
+        partial_sum.fill(zero<arithmetic_type>());
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; k++) {
+            arithmetic_type val = a_vals(k);
+            auto col = col_idxs[k];
+            for (size_type j = rounded_rhs; j < num_rhs; j++) {
+                partial_sum[j - rounded_rhs] += val * b_vals(col, j);
+            }
+        }
+        for (size_type j = rounded_rhs; j < num_rhs; j++) {
+            [&] {
+                c->at(row, j) = out(row, j, partial_sum[j - rounded_rhs]);
+            }();
+        }
+    }
+}
+
+
+/**
+ * Computes the SpMV with the kernel matching the number of right-hand sides.
+ * For up to four right-hand sides, each row of the matrix is read once,
+ * otherwise once for every block of up to 16 right-hand sides.
+ */
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_select_rhs(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<MatrixValueType, IndexType>* a,
+                     const matrix::Dense<InputValueType>* b,
+                     matrix::Dense<OutputValueType>* c, OutFn out)
+{
+    const auto num_rhs = b->get_size()[1];
+    if (num_rhs == 0) {
+        return;
+    }
+    if (num_rhs == 1) {
+        spmv_small_rhs<1>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs == 2) {
+        spmv_small_rhs<2>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs == 3) {
+        spmv_small_rhs<3>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs == 4) {
+        spmv_small_rhs<4>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs < 8) {
+        spmv_blocked<4>(exec, a, b, c, out);
+        return;
+    }
+    if (num_rhs < 16) {
+        spmv_blocked<8>(exec, a, b, c, out);
+        return;
+    }
+    spmv_blocked<16>(exec, a, b, c, out);
+}
 
-                sum += val * b_vals(col, j);
+
+/**
+ * Finds the coordinate at which the given diagonal intersects the merge path
+ * of the row end offsets `row_ptrs[1], ..., row_ptrs[num_rows]` and the
+ * nonzero indices `0, ..., nnz - 1`.
+ *
+ * @return the pair (row, nz) of the number of consumed rows and nonzeros,
+ *         with `row + nz == diagonal`
+ */
+template <typename IndexType>
+std::pair<IndexType, IndexType> merge_path_search(const IndexType* row_ptrs,
+                                                  IndexType num_rows,
+                                                  IndexType nnz,
+                                                  int64 diagonal)
+{
+    auto lo = std::max<int64>(diagonal - nnz, 0);
+    auto hi = std::min<int64>(diagonal, num_rows);
+    while (lo < hi) {
+        const auto mid = lo + (hi - lo) / 2;
+        if (row_ptrs[mid + 1] <= diagonal - mid - 1) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return {static_cast<IndexType>(lo), static_cast<IndexType>(diagonal - lo)};
+}
+
+
+/**
+ * Computes the SpMV by splitting the merge path of rows and nonzeros evenly
+ * between the threads, so every thread processes the same number of rows plus
+ * nonzeros independent of the distribution of nonzeros over the rows.
+ * Rows that are split between multiple threads are finished by the thread in
+ * which they end, after the partial sums of the preceding threads are known.
+ */
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_merge_path(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<MatrixValueType, IndexType>* a,
+                     const matrix::Dense<InputValueType>* b,
+                     matrix::Dense<OutputValueType>* c, OutFn out)
+{
+    using arithmetic_type =
+        highest_precision<MatrixValueType, InputValueType, OutputValueType>;
+
+    const auto num_rows = static_cast<IndexType>(a->get_size()[0]);
+    const auto num_rhs = b->get_size()[1];
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto nnz = row_ptrs[num_rows];
+    const auto a_vals =
+        acc::helper::build_const_rrm_accessor<arithmetic_type>(a);
+    const auto b_vals =
+        acc::helper::build_const_rrm_accessor<arithmetic_type>(b);
+    const auto max_threads = static_cast<size_type>(omp_get_max_threads());
+    // the row each thread ends in, and the partial sums of this row
+    vector<IndexType> carry_rows(max_threads, {exec});
+    vector<arithmetic_type> carry_vals(max_threads * num_rhs, {exec});
+    // the partial sums of the row each thread starts in
+    vector<arithmetic_type> head_vals(max_threads * num_rhs, {exec});
+    // sums up the nonzeros in [begin, end) for all right-hand sides at once,
+    // so every nonzero is only loaded once
+    const auto partial_row_sum = [&](IndexType begin, IndexType end,
+                                     arithmetic_type* sums) {
+        std::fill_n(sums, num_rhs, zero<arithmetic_type>());
+        for (auto nz = begin; nz < end; nz++) {
+            const arithmetic_type val = a_vals(nz);
+            const auto col = col_idxs[nz];
+            for (size_type j = 0; j < num_rhs; j++) {
+                sums[j] += val * b_vals(col, j);
+            }
+        }
+    };
+
+#pragma omp parallel
+    {
+        const auto tid = static_cast<size_type>(omp_get_thread_num());
+        const auto num_threads = static_cast<int64>(omp_get_num_threads());
+        const auto total_work = static_cast<int64>(num_rows) + nnz;
+        const auto work_per_thread = ceildiv(total_work, num_threads);
+        const auto begin = merge_path_search(
+            row_ptrs, num_rows, nnz,
+            std::min<int64>(tid * work_per_thread, total_work));
+        const auto end = merge_path_search(
+            row_ptrs, num_rows, nnz,
+            std::min<int64>((tid + 1) * work_per_thread, total_work));
+        const auto begin_row = begin.first;
+        const auto end_row = end.first;
+        // the first row was started by a preceding thread
+        const bool shared_head =
+            begin_row < end_row && begin.second > row_ptrs[begin_row];
+        vector<arithmetic_type> row_sums(num_rhs, {exec});
+        for (auto row = begin_row; row < end_row; row++) {
+            const auto row_begin = std::max(row_ptrs[row], begin.second);
+            if (row == begin_row && shared_head) {
+                partial_row_sum(row_begin, row_ptrs[row + 1],
+                                head_vals.data() + tid * num_rhs);
+            } else {
+                partial_row_sum(row_begin, row_ptrs[row + 1], row_sums.data());
+                for (size_type j = 0; j < num_rhs; j++) {
+                    [&] { c->at(row, j) = out(row, j, row_sums[j]); }();
+                }
+            }
+        }
+        carry_rows[tid] = end_row;
+        if (end_row < num_rows) {
+            const auto row_begin = std::max(row_ptrs[end_row], begin.second);
+            partial_row_sum(row_begin, end.second,
+                            carry_vals.data() + tid * num_rhs);
+        }
+#pragma omp barrier
+        if (shared_head) {
+            for (size_type j = 0; j < num_rhs; j++) {
+                auto sum = head_vals[tid * num_rhs + j];
+                for (auto prev = tid; prev > 0 &&
+                                      carry_rows[prev - 1] == begin_row;
+                     prev--) {
+                    sum += carry_vals[(prev - 1) * num_rhs + j];
+                }
+                [&] { c->at(begin_row, j) = out(begin_row, j, sum); }();
             }
-            c_vals(row, j) = sum;
         }
     }
 }
 
+
+/**
+ * Computes the SpMV with the kernel selected by the strategy of the matrix.
+ * The merge_path and load_balance strategies balance the number of nonzeros
+ * between the threads, all other strategies distribute the rows.
+ */
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutFn>
+void spmv_select_strategy(std::shared_ptr<const OmpExecutor> exec,
+                          const matrix::Csr<MatrixValueType, IndexType>* a,
+                          const matrix::Dense<InputValueType>* b,
+                          matrix::Dense<OutputValueType>* c, OutFn out)
+{
+    const auto strategy_name = a->get_strategy()->get_name();
+    if (strategy_name == "merge_path" || strategy_name == "load_balance") {
+        spmv_merge_path(exec, a, b, c, out);
+    } else {
+        spmv_select_rhs(exec, a, b, c, out);
+    }
+}
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Csr<MatrixValueType, IndexType>* a,
+          const matrix::Dense<InputValueType>* b,
+          matrix::Dense<OutputValueType>* c)
+{
+    auto out = [](auto, auto, auto value) { return value; };
+    spmv_select_strategy(exec, a, b, c, out);
+}
+
 GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_SPMV_KERNEL);
 
@@ -96,30 +360,12 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
 {
     using arithmetic_type =
         highest_precision<MatrixValueType, InputValueType, OutputValueType>;
-
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-    arithmetic_type valpha = alpha->at(0, 0);
-    arithmetic_type vbeta = beta->at(0, 0);
-
-    const auto a_vals =
-        acc::helper::build_const_rrm_accessor<arithmetic_type>(a);
-    const auto b_vals =
-        acc::helper::build_const_rrm_accessor<arithmetic_type>(b);
-    auto c_vals = acc::helper::build_rrm_accessor<arithmetic_type>(c);
-#pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            auto sum = c_vals(row, j) * vbeta;
-            for (size_type k = row_ptrs[row];
-                 k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
-                arithmetic_type val = a_vals(k);
-                auto col = col_idxs[k];
-                sum += valpha * val * b_vals(col, j);
-            }
-            c_vals(row, j) = sum;
-        }
-    }
+    const auto alpha_val = arithmetic_type{alpha->at(0, 0)};
+    const auto beta_val = arithmetic_type{beta->at(0, 0)};
+    auto out = [&](auto i, auto j, auto value) {
+        return alpha_val * value + beta_val * arithmetic_type{c->at(i, j)};
+    };
+    spmv_select_strategy(exec, a, b, c, out);
 }
 
 GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
@@ -314,6 +560,260 @@ auto spgemm_multiway_merge(size_type row,
 }
 
 
+/**
+ * @internal
+ *
+ * The accumulator used to compute a single row of an SpGEMM.
+ */
+enum class spgemm_accumulator_type {
+    /** multiway merge of the rows of B using a binary heap */
+    heap,
+    /** thread-local hash table of the output columns */
+    hash,
+    /** thread-local dense array over all columns of B */
+    dense
+};
+
+
+/**
+ * Rows of A with at most this many entries are merged using a heap: The heap
+ * is small and produces the output columns already sorted.
+ */
+constexpr int spgemm_heap_max_row_nnz = 4;
+
+
+/**
+ * Rows whose estimated output size is at least the number of columns of B
+ * divided by this value use the dense accumulator, the remaining rows use the
+ * hash table, which only touches memory proportional to the output size.
+ */
+constexpr int spgemm_dense_ratio = 16;
+
+
+/**
+ * @internal
+ *
+ * Thread-local accumulator computing single output rows of A * B. For each row,
+ * it selects a heap, hash table or dense accumulator based on the number of
+ * entries in the row of A and the upper bound on the number of output entries
+ * given by the number of scalar products.
+ *
+ * @tparam ValueType  The value type for matrices.
+ * @tparam IndexType  The index type for matrices.
+ */
+template <typename ValueType, typename IndexType>
+class spgemm_accumulator {
+public:
+    using matrix_type = matrix::Csr<ValueType, IndexType>;
+    using heap_element = val_heap_element<ValueType, IndexType>;
+
+    /**
+     * Creates an accumulator for the product of the given matrices.
+     *
+     * @param heap  the heap storage for all rows of A, which must have as many
+     *              entries as A has non-zeros. Each thread only accesses the
+     *              entries belonging to the rows it processes.
+     */
+    spgemm_accumulator(std::shared_ptr<const OmpExecutor> exec,
+                       const matrix_type* a, const matrix_type* b,
+                       heap_element* heap)
+        : a_{a},
+          b_{b},
+          heap_{heap},
+          dense_rows_{exec},
+          dense_vals_{exec},
+          hash_cols_{exec},
+          hash_vals_{exec},
+          cols_{exec}
+    {}
+
+    /** Returns the number of distinct output columns in the given row. */
+    IndexType count_row(IndexType row)
+    {
+        const auto type = select_type(row);
+        if (type == spgemm_accumulator_type::heap) {
+            return spgemm_multiway_merge(
+                row, a_, b_,
+                reinterpret_cast<col_heap_element<ValueType, IndexType>*>(
+                    heap_),
+                [](size_type) { return IndexType{}; },
+                [](ValueType, IndexType, IndexType&) {},
+                [](IndexType, IndexType& nnz) { nnz++; });
+        }
+        insert_row<false>(type, row);
+        return static_cast<IndexType>(cols_.size());
+    }
+
+    /**
+     * Calls `col_cb(column)` for each distinct output column in the given row
+     * in ascending order, without computing any values.
+     */
+    template <typename ColCallback>
+    void merge_row_pattern(IndexType row, ColCallback col_cb)
+    {
+        const auto type = select_type(row);
+        if (type == spgemm_accumulator_type::heap) {
+            spgemm_multiway_merge(
+                row, a_, b_,
+                reinterpret_cast<col_heap_element<ValueType, IndexType>*>(
+                    heap_),
+                [](size_type) { return IndexType{}; },
+                [](ValueType, IndexType, IndexType&) {},
+                [&](IndexType col, IndexType&) { col_cb(col); });
+            return;
+        }
+        insert_row<false>(type, row);
+        std::sort(cols_.begin(), cols_.end());
+        for (auto col : cols_) {
+            col_cb(col);
+        }
+    }
+
+    /**
+     * Computes the given output row and calls `col_cb(column, value)` for each
+     * of its columns in ascending order.
+     */
+    template <typename ColCallback>
+    void accumulate_row(IndexType row, ColCallback col_cb)
+    {
+        const auto type = select_type(row);
+        if (type == spgemm_accumulator_type::heap) {
+            spgemm_multiway_merge(
+                row, a_, b_, heap_,
+                [](size_type) { return zero<ValueType>(); },
+                [](ValueType val, IndexType, ValueType& sum) { sum += val; },
+                [&](IndexType col, ValueType& sum) {
+                    col_cb(col, sum);
+                    sum = zero<ValueType>();
+                });
+            return;
+        }
+        insert_row<true>(type, row);
+        std::sort(cols_.begin(), cols_.end());
+        for (auto col : cols_) {
+            col_cb(col, type == spgemm_accumulator_type::dense
+                            ? dense_vals_[col]
+                            : hash_vals_[hash_find(col)]);
+        }
+    }
+
+private:
+    spgemm_accumulator_type select_type(IndexType row)
+    {
+        const auto a_row_ptrs = a_->get_const_row_ptrs();
+        const auto a_cols = a_->get_const_col_idxs();
+        const auto b_row_ptrs = b_->get_const_row_ptrs();
+        const auto a_begin = a_row_ptrs[row];
+        const auto a_end = a_row_ptrs[row + 1];
+        if (a_end - a_begin <= spgemm_heap_max_row_nnz) {
+            return spgemm_accumulator_type::heap;
+        }
+        int64 num_products{};
+        for (auto a_nz = a_begin; a_nz < a_end; a_nz++) {
+            const auto b_row = a_cols[a_nz];
+            num_products += b_row_ptrs[b_row + 1] - b_row_ptrs[b_row];
+        }
+        num_products_ = num_products;
+        return num_products * spgemm_dense_ratio >=
+                       static_cast<int64>(b_->get_size()[1])
+                   ? spgemm_accumulator_type::dense
+                   : spgemm_accumulator_type::hash;
+    }
+
+    /**
+     * Stores the distinct output columns of the row in cols_, and if
+     * compute_values is set, the accumulated values in the dense array or
+     * hash table.
+     */
+    template <bool compute_values>
+    void insert_row(spgemm_accumulator_type type, IndexType row)
+    {
+        const auto a_row_ptrs = a_->get_const_row_ptrs();
+        const auto a_cols = a_->get_const_col_idxs();
+        const auto a_vals = a_->get_const_values();
+        const auto b_row_ptrs = b_->get_const_row_ptrs();
+        const auto b_cols = b_->get_const_col_idxs();
+        const auto b_vals = b_->get_const_values();
+        const bool dense = type == spgemm_accumulator_type::dense;
+        cols_.clear();
+        if (dense) {
+            if (dense_rows_.empty()) {
+                const auto num_cols = b_->get_size()[1];
+                dense_rows_.assign(num_cols, invalid_index<IndexType>());
+                dense_vals_.resize(num_cols);
+            }
+        } else {
+            // keep the load factor of the hash table at most 1/2
+            const auto size =
+                get_superior_power(int64{2}, 2 * num_products_, int64{2});
+            if (static_cast<int64>(hash_cols_.size()) < size) {
+                hash_cols_.resize(size);
+                hash_vals_.resize(size);
+            }
+            hash_mask_ = size - 1;
+            std::fill_n(hash_cols_.begin(), size, invalid_index<IndexType>());
+        }
+        for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; a_nz++) {
+            const auto b_row = a_cols[a_nz];
+            const auto a_val = a_vals[a_nz];
+            for (auto b_nz = b_row_ptrs[b_row]; b_nz < b_row_ptrs[b_row + 1];
+                 b_nz++) {
+                const auto col = b_cols[b_nz];
+                ValueType* entry{};
+                if (dense) {
+                    // tagging the columns with the row avoids resetting them
+                    if (dense_rows_[col] != row) {
+                        dense_rows_[col] = row;
+                        dense_vals_[col] = zero<ValueType>();
+                        cols_.push_back(col);
+                    }
+                    entry = &dense_vals_[col];
+                } else {
+                    const auto slot = hash_find(col);
+                    if (hash_cols_[slot] != col) {
+                        hash_cols_[slot] = col;
+                        hash_vals_[slot] = zero<ValueType>();
+                        cols_.push_back(col);
+                    }
+                    entry = &hash_vals_[slot];
+                }
+                if (compute_values) {
+                    *entry += a_val * b_vals[b_nz];
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the slot of the hash table containing the given column, or the
+     * empty slot where it needs to be inserted, using linear probing.
+     */
+    int64 hash_find(IndexType col) const
+    {
+        // multiplicative hashing spreads consecutive columns over the table
+        auto slot = static_cast<int64>(
+            (static_cast<uint64>(col) * 0x9E3779B97F4A7C15ull) >> 32);
+        slot &= hash_mask_;
+        while (hash_cols_[slot] != col &&
+               hash_cols_[slot] != invalid_index<IndexType>()) {
+            slot = (slot + 1) & hash_mask_;
+        }
+        return slot;
+    }
+
+    const matrix_type* a_;
+    const matrix_type* b_;
+    heap_element* heap_;
+    int64 num_products_{};
+    vector<IndexType> dense_rows_;
+    vector<ValueType> dense_vals_;
+    vector<IndexType> hash_cols_;
+    vector<ValueType> hash_vals_;
+    int64 hash_mask_{};
+    vector<IndexType> cols_;
+};
+
+
 }  // namespace
 
 
@@ -326,27 +826,22 @@ void spgemm(std::shared_ptr<const OmpExecutor> exec,
     auto num_rows = a->get_size()[0];
     auto c_row_ptrs = c->get_row_ptrs();
 
-    array<col_heap_element<ValueType, IndexType>> col_heap_array(
+    array<val_heap_element<ValueType, IndexType>> heap_array(
         exec, a->get_num_stored_elements());
 
-    auto col_heap = col_heap_array.get_data();
+    auto heap = heap_array.get_data();
 
     // first sweep: count nnz for each row
-#pragma omp parallel for
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        c_row_ptrs[a_row] = spgemm_multiway_merge(
-            a_row, a, b, col_heap, [](size_type) { return IndexType{}; },
-            [](ValueType, IndexType, IndexType&) {},
-            [](IndexType, IndexType& nnz) { nnz++; });
+#pragma omp parallel
+    {
+        spgemm_accumulator<ValueType, IndexType> accumulator{exec, a, b, heap};
+#pragma omp for schedule(dynamic, 64)
+        for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+            c_row_ptrs[a_row] =
+                accumulator.count_row(static_cast<IndexType>(a_row));
+        }
     }
 
-    col_heap_array.clear();
-
-    array<val_heap_element<ValueType, IndexType>> heap_array(
-        exec, a->get_num_stored_elements());
-
-    auto heap = heap_array.get_data();
-
     // build row pointers
     components::prefix_sum_nonnegative(exec, c_row_ptrs, num_rows + 1);
 
@@ -360,21 +855,19 @@ void spgemm(std::shared_ptr<const OmpExecutor> exec,
     auto c_col_idxs = c_col_idxs_array.get_data();
     auto c_vals = c_vals_array.get_data();
 
-#pragma omp parallel for
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        spgemm_multiway_merge(
-            a_row, a, b, heap,
-            [&](size_type row) {
-                return std::make_pair(zero<ValueType>(), c_row_ptrs[row]);
-            },
-            [](ValueType val, IndexType,
-               std::pair<ValueType, IndexType>& state) { state.first += val; },
-            [&](IndexType col, std::pair<ValueType, IndexType>& state) {
-                c_col_idxs[state.second] = col;
-                c_vals[state.second] = state.first;
-                state.first = zero<ValueType>();
-                state.second++;
-            });
+#pragma omp parallel
+    {
+        spgemm_accumulator<ValueType, IndexType> accumulator{exec, a, b, heap};
+#pragma omp for schedule(dynamic, 64)
+        for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+            auto c_nz = c_row_ptrs[a_row];
+            accumulator.accumulate_row(static_cast<IndexType>(a_row),
+                                       [&](IndexType col, ValueType val) {
+                                           c_col_idxs[c_nz] = col;
+                                           c_vals[c_nz] = val;
+                                           c_nz++;
+                                       });
+        }
     }
 }
 
@@ -405,29 +898,31 @@ void advanced_spgemm(std::shared_ptr<const OmpExecutor> exec,
         exec, a->get_num_stored_elements());
 
     auto heap = heap_array.get_data();
-    auto col_heap =
-        reinterpret_cast<col_heap_element<ValueType, IndexType>*>(heap);
 
     // first sweep: count nnz for each row
-#pragma omp parallel for
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        auto d_nz = d_row_ptrs[a_row];
-        auto d_end = d_row_ptrs[a_row + 1];
-        auto d_col = checked_load(d_cols, d_nz, d_end, sentinel);
-        c_row_ptrs[a_row] = spgemm_multiway_merge(
-            a_row, a, b, col_heap, [](size_type row) { return IndexType{}; },
-            [](ValueType, IndexType, IndexType&) {},
-            [&](IndexType col, IndexType& nnz) {
-                // skip smaller elements from d
-                while (d_col <= col) {
-                    d_nz++;
-                    nnz += d_col != col;
-                    d_col = checked_load(d_cols, d_nz, d_end, sentinel);
-                }
-                nnz++;
-            });
-        // handle the remaining columns from d
-        c_row_ptrs[a_row] += d_end - d_nz;
+#pragma omp parallel
+    {
+        spgemm_accumulator<ValueType, IndexType> accumulator{exec, a, b, heap};
+#pragma omp for schedule(dynamic, 64)
+        for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+            auto d_nz = d_row_ptrs[a_row];
+            auto d_end = d_row_ptrs[a_row + 1];
+            auto d_col = checked_load(d_cols, d_nz, d_end, sentinel);
+            IndexType nnz{};
+            // only the union of the patterns of A * B and d is needed here
+            accumulator.merge_row_pattern(
+                static_cast<IndexType>(a_row), [&](IndexType col) {
+                    // skip smaller elements from d
+                    while (d_col <= col) {
+                        d_nz++;
+                        nnz += d_col != col;
+                        d_col = checked_load(d_cols, d_nz, d_end, sentinel);
+                    }
+                    nnz++;
+                });
+            // handle the remaining columns from d
+            c_row_ptrs[a_row] = nnz + d_end - d_nz;
+        }
     }
 
     // build row pointers
@@ -443,53 +938,47 @@ void advanced_spgemm(std::shared_ptr<const OmpExecutor> exec,
     auto c_col_idxs = c_col_idxs_array.get_data();
     auto c_vals = c_vals_array.get_data();
 
-#pragma omp parallel for
-    for (size_type a_row = 0; a_row < num_rows; ++a_row) {
-        auto d_nz = d_row_ptrs[a_row];
-        auto d_end = d_row_ptrs[a_row + 1];
-        auto d_col = checked_load(d_cols, d_nz, d_end, sentinel);
-        auto d_val = checked_load(d_vals, d_nz, d_end, zero<ValueType>());
-        auto c_nz =
-            spgemm_multiway_merge(
-                a_row, a, b, heap,
-                [&](size_type row) {
-                    return std::make_pair(zero<ValueType>(), c_row_ptrs[row]);
-                },
-                [](ValueType val, IndexType,
-                   std::pair<ValueType, IndexType>& state) {
-                    state.first += val;
-                },
-                [&](IndexType col, std::pair<ValueType, IndexType>& state) {
+#pragma omp parallel
+    {
+        spgemm_accumulator<ValueType, IndexType> accumulator{exec, a, b, heap};
+#pragma omp for schedule(dynamic, 64)
+        for (size_type a_row = 0; a_row < num_rows; ++a_row) {
+            auto d_nz = d_row_ptrs[a_row];
+            auto d_end = d_row_ptrs[a_row + 1];
+            auto d_col = checked_load(d_cols, d_nz, d_end, sentinel);
+            auto d_val = checked_load(d_vals, d_nz, d_end, zero<ValueType>());
+            auto c_nz = c_row_ptrs[a_row];
+            accumulator.accumulate_row(
+                static_cast<IndexType>(a_row),
+                [&](IndexType col, ValueType val) {
                     // handle smaller elements from d
                     ValueType part_d_val{};
                     while (d_col <= col) {
                         if (d_col == col) {
                             part_d_val = d_val;
                         } else {
-                            c_col_idxs[state.second] = d_col;
-                            c_vals[state.second] = vbeta * d_val;
-                            state.second++;
+                            c_col_idxs[c_nz] = d_col;
+                            c_vals[c_nz] = vbeta * d_val;
+                            c_nz++;
                         }
                         d_nz++;
                         d_col = checked_load(d_cols, d_nz, d_end, sentinel);
                         d_val = checked_load(d_vals, d_nz, d_end,
                                              zero<ValueType>());
                     }
-                    c_col_idxs[state.second] = col;
-                    c_vals[state.second] =
-                        vbeta * part_d_val + valpha * state.first;
-                    state.first = zero<ValueType>();
-                    state.second++;
-                })
-                .second;
-        // handle remaining elements from d
-        while (d_col < sentinel) {
-            c_col_idxs[c_nz] = d_col;
-            c_vals[c_nz] = vbeta * d_val;
-            c_nz++;
-            d_nz++;
-            d_col = checked_load(d_cols, d_nz, d_end, sentinel);
-            d_val = checked_load(d_vals, d_nz, d_end, zero<ValueType>());
+                    c_col_idxs[c_nz] = col;
+                    c_vals[c_nz] = vbeta * part_d_val + valpha * val;
+                    c_nz++;
+                });
+            // handle remaining elements from d
+            while (d_col < sentinel) {
+                c_col_idxs[c_nz] = d_col;
+                c_vals[c_nz] = vbeta * d_val;
+                c_nz++;
+                d_nz++;
+                d_col = checked_load(d_cols, d_nz, d_end, sentinel);
+                d_val = checked_load(d_vals, d_nz, d_end, zero<ValueType>());
+            }
         }
     }
 }
@@ -589,6 +1078,7 @@ void convert_to_fbcsr(std::shared_ptr<const DefaultExecutor> exec,
     auto out_row_ptrs = row_ptrs.get_data();
     array<entry> entry_array{exec, nnz};
     auto entries = entry_array.get_data();
+#pragma omp parallel for
     for (IndexType row = 0; row < num_rows; row++) {
         for (auto nz = in_row_ptrs[row]; nz < in_row_ptrs[row + 1]; nz++) {
             entries[nz] = {row, in_cols[nz], in_vals[nz]};
@@ -598,8 +1088,9 @@ void convert_to_fbcsr(std::shared_ptr<const DefaultExecutor> exec,
         return std::make_pair(a.row / bs, a.column / bs);
     };
     // sort by block in row-major order
-    std::sort(entries, entries + nnz,
-              [&](entry a, entry b) { return to_block(a) < to_block(b); });
+    parallel_stable_sort(
+        exec, entries, nnz,
+        [&](entry a, entry b) { return to_block(a) < to_block(b); });
     // set row pointers by jumps in block row index
     gko::vector<IndexType> col_idx_vec{{exec}};
     gko::vector<ValueType> value_vec{{exec}};
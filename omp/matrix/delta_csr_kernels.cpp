@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/base/mixed_precision_types.hpp"
+#include "core/matrix/delta_csr_codec.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The delta-compressed sparse row matrix format namespace.
+ * @ref DeltaCsr
+ * @ingroup delta_csr
+ */
+namespace delta_csr {
+namespace {
+
+
+/**
+ * Computes the products of all rows of a with all columns of b, decoding every
+ * entry of a only once, and stores them using out(row, col, sum).
+ */
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType, typename OutputFn>
+void spmv_rows(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::DeltaCsr<MatrixValueType, IndexType>* a,
+               const matrix::Dense<InputValueType>* b,
+               matrix::Dense<OutputValueType>* c, OutputFn out)
+{
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto row_bases = a->get_const_row_bases();
+    const auto idx_ptrs = a->get_const_compressed_idx_ptrs();
+    const auto idxs = a->get_const_compressed_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_rhs = c->get_size()[1];
+
+#pragma omp parallel
+    {
+        vector<arithmetic_type> sums(num_rhs, {exec});
+#pragma omp for
+        for (size_type row = 0; row < a->get_size()[0]; ++row) {
+            std::fill(sums.begin(), sums.end(), zero<arithmetic_type>());
+            matrix::delta_csr::for_each_entry(
+                row_ptrs, row_bases, idx_ptrs, idxs, row,
+                [&](IndexType nz, IndexType col) {
+                    const auto val = static_cast<arithmetic_type>(vals[nz]);
+                    for (size_type j = 0; j < num_rhs; ++j) {
+                        sums[j] +=
+                            val * static_cast<arithmetic_type>(b->at(col, j));
+                    }
+                });
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) = out(row, j, sums[j]);
+            }
+        }
+    }
+}
+
+
+}  // anonymous namespace
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::DeltaCsr<MatrixValueType, IndexType>* a,
+          const matrix::Dense<InputValueType>* b,
+          matrix::Dense<OutputValueType>* c)
+{
+    spmv_rows(exec, a, b, c, [](size_type, size_type, auto sum) {
+        return static_cast<OutputValueType>(sum);
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<MatrixValueType>* alpha,
+                   const matrix::DeltaCsr<MatrixValueType, IndexType>* a,
+                   const matrix::Dense<InputValueType>* b,
+                   const matrix::Dense<OutputValueType>* beta,
+                   matrix::Dense<OutputValueType>* c)
+{
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
+    const auto valpha = static_cast<arithmetic_type>(alpha->at(0, 0));
+    const auto vbeta = static_cast<arithmetic_type>(beta->at(0, 0));
+    spmv_rows(exec, a, b, c, [&](size_type row, size_type j, auto sum) {
+        return static_cast<OutputValueType>(
+            vbeta * static_cast<arithmetic_type>(c->at(row, j)) +
+            valpha * sum);
+    });
+}
+
+GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+
+
+}  // namespace delta_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
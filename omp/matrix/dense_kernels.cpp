@@ -81,65 +81,217 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
     GKO_DECLARE_DENSE_COMPUTE_NORM2_DISPATCH_KERNEL);
 
 
+namespace {
+
+
+// number of rows of the register tile of c computed by the GEMM micro-kernel
+constexpr int gemm_tile_rows = 4;
+// number of columns of the register tile, chosen so that a row of the tile
+// fills 64 bytes, i.e. a cache line or one or two SIMD registers
 template <typename ValueType>
-void simple_apply(std::shared_ptr<const DefaultExecutor> exec,
-                  const matrix::Dense<ValueType>* a,
-                  const matrix::Dense<ValueType>* b,
-                  matrix::Dense<ValueType>* c)
+constexpr int gemm_tile_cols()
 {
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type col = 0; col < c->get_size()[1]; ++col) {
-            c->at(row, col) = zero<ValueType>();
-        }
-    }
+    return sizeof(ValueType) >= 64 ? 1 : 64 / sizeof(ValueType);
+}
+// maximal size of the row panel of a and c processed by a single thread
+constexpr size_type gemm_block_rows = 64;
+// size of the blocks of b that are kept in cache while a row panel is
+// processed
+constexpr size_type gemm_block_inner = 128;
+constexpr size_type gemm_block_cols = 128;
 
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) += a->at(row, inner) * b->at(inner, col);
+
+/**
+ * Computes a full tile_rows x tile_cols tile of c = beta * c + alpha * a * b
+ * over a block of the inner dimension, accumulating in registers.
+ * If load_c is false, the old values of c are ignored.
+ */
+template <int tile_rows, int tile_cols, typename ValueType>
+void gemm_tile(size_type num_inner, ValueType alpha, const ValueType* a,
+               size_type a_stride, const ValueType* b, size_type b_stride,
+               ValueType beta, bool load_c, ValueType* c, size_type c_stride)
+{
+    ValueType sum[tile_rows][tile_cols]{};
+    for (size_type inner = 0; inner < num_inner; ++inner) {
+        const auto b_row = b + inner * b_stride;
+        for (int i = 0; i < tile_rows; ++i) {
+            const auto a_val = a[i * a_stride + inner];
+#pragma omp simd
+            for (int j = 0; j < tile_cols; ++j) {
+                sum[i][j] += a_val * b_row[j];
             }
         }
     }
+    for (int i = 0; i < tile_rows; ++i) {
+        const auto c_row = c + i * c_stride;
+        for (int j = 0; j < tile_cols; ++j) {
+            c_row[j] = load_c ? beta * c_row[j] + alpha * sum[i][j]
+                              : alpha * sum[i][j];
+        }
+    }
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_SIMPLE_APPLY_KERNEL);
+
+/**
+ * Computes a row panel of tile_rows rows and num_cols columns of
+ * c = beta * c + alpha * a * b with register tiles of tile_cols columns.
+ * The remaining columns use tiles of half the width, down to a single column,
+ * so matrices with fewer columns than the widest tile still accumulate in
+ * registers.
+ */
+template <int tile_rows, int tile_cols>
+struct gemm_tile_row {
+    template <typename ValueType>
+    static void compute(size_type num_cols, size_type num_inner,
+                        ValueType alpha, const ValueType* a, size_type a_stride,
+                        const ValueType* b, size_type b_stride, ValueType beta,
+                        bool load_c, ValueType* c, size_type c_stride)
+    {
+        size_type col = 0;
+        for (; col + tile_cols <= num_cols; col += tile_cols) {
+            gemm_tile<tile_rows, tile_cols>(num_inner, alpha, a, a_stride,
+                                            b + col, b_stride, beta, load_c,
+                                            c + col, c_stride);
+        }
+        gemm_tile_row<tile_rows, tile_cols / 2>::compute(
+            num_cols - col, num_inner, alpha, a, a_stride, b + col, b_stride,
+            beta, load_c, c + col, c_stride);
+    }
+};
+
+
+template <int tile_rows>
+struct gemm_tile_row<tile_rows, 0> {
+    template <typename ValueType>
+    static void compute(size_type, size_type, ValueType, const ValueType*,
+                        size_type, const ValueType*, size_type, ValueType,
+                        bool, ValueType*, size_type)
+    {}
+};
 
 
+/**
+ * Computes a partial tile of c = beta * c + alpha * a * b at the border of the
+ * matrix, where the register tile does not fit.
+ */
 template <typename ValueType>
-void apply(std::shared_ptr<const DefaultExecutor> exec,
-           const matrix::Dense<ValueType>* alpha,
-           const matrix::Dense<ValueType>* a, const matrix::Dense<ValueType>* b,
-           const matrix::Dense<ValueType>* beta, matrix::Dense<ValueType>* c)
+void gemm_edge_tile(size_type num_rows, size_type num_cols,
+                    size_type num_inner, ValueType alpha, const ValueType* a,
+                    size_type a_stride, const ValueType* b, size_type b_stride,
+                    ValueType beta, bool load_c, ValueType* c,
+                    size_type c_stride)
 {
-    if (is_nonzero(beta->at(0, 0))) {
-#pragma omp parallel for
-        for (size_type row = 0; row < c->get_size()[0]; ++row) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) *= beta->at(0, 0);
-            }
-        }
-    } else {
-#pragma omp parallel for
-        for (size_type row = 0; row < c->get_size()[0]; ++row) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) *= zero<ValueType>();
+    for (size_type i = 0; i < num_rows; ++i) {
+        for (size_type j = 0; j < num_cols; ++j) {
+            auto sum = zero<ValueType>();
+            for (size_type inner = 0; inner < num_inner; ++inner) {
+                sum += a[i * a_stride + inner] * b[inner * b_stride + j];
             }
+            auto& c_val = c[i * c_stride + j];
+            c_val = load_c ? beta * c_val + alpha * sum : alpha * sum;
         }
     }
+}
 
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) +=
-                    alpha->at(0, 0) * a->at(row, inner) * b->at(inner, col);
+
+/**
+ * Computes c = beta * c + alpha * a * b, or c = alpha * a * b if overwrite is
+ * set.
+ *
+ * The rows of c are distributed in panels among the threads. Each thread
+ * processes its panel in cache blocks of b, and each cache block in register
+ * tiles of c, which get narrower at the right border of the block.
+ */
+template <typename ValueType>
+void gemm(ValueType alpha, const matrix::Dense<ValueType>* a,
+          const matrix::Dense<ValueType>* b, ValueType beta, bool overwrite,
+          matrix::Dense<ValueType>* c)
+{
+    constexpr auto tile_rows = gemm_tile_rows;
+    constexpr auto tile_cols = gemm_tile_cols<ValueType>();
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
+    const auto a_vals = a->get_const_values();
+    const auto b_vals = b->get_const_values();
+    const auto c_vals = c->get_values();
+    const auto a_stride = a->get_stride();
+    const auto b_stride = b->get_stride();
+    const auto c_stride = c->get_stride();
+    const auto num_threads = static_cast<size_type>(omp_get_max_threads());
+    // small matrices are split into smaller panels to use all threads
+    const auto block_rows = std::max<size_type>(
+        tile_rows, std::min<size_type>(
+                       gemm_block_rows,
+                       ceildiv(ceildiv(num_rows, num_threads), tile_rows) *
+                           tile_rows));
+    const auto num_row_blocks =
+        static_cast<size_type>(ceildiv(num_rows, block_rows));
+#pragma omp parallel for schedule(static)
+    for (size_type row_block = 0; row_block < num_row_blocks; ++row_block) {
+        const auto row_begin = row_block * block_rows;
+        const auto row_end = std::min(row_begin + block_rows, num_rows);
+        for (size_type col_begin = 0; col_begin < num_cols;
+             col_begin += gemm_block_cols) {
+            const auto col_end =
+                std::min(col_begin + gemm_block_cols, num_cols);
+            // the first inner block applies beta, so it needs to run even
+            // if the inner dimension is empty
+            for (size_type inner_begin = 0;
+                 inner_begin == 0 || inner_begin < num_inner;
+                 inner_begin += gemm_block_inner) {
+                const auto block_inner =
+                    std::min(gemm_block_inner, num_inner - inner_begin);
+                const auto first_block = inner_begin == 0;
+                const auto block_beta = first_block ? beta : one<ValueType>();
+                const auto load_c = !(first_block && overwrite);
+                const auto block_a = a_vals + inner_begin;
+                const auto block_b = b_vals + inner_begin * b_stride;
+                auto row = row_begin;
+                for (; row + tile_rows <= row_end; row += tile_rows) {
+                    gemm_tile_row<tile_rows, tile_cols>::compute(
+                        col_end - col_begin, block_inner, alpha,
+                        block_a + row * a_stride, a_stride,
+                        block_b + col_begin, b_stride, block_beta, load_c,
+                        c_vals + row * c_stride + col_begin, c_stride);
+                }
+                gemm_edge_tile(row_end - row, col_end - col_begin, block_inner,
+                               alpha, block_a + row * a_stride, a_stride,
+                               block_b + col_begin, b_stride, block_beta,
+                               load_c, c_vals + row * c_stride + col_begin,
+                               c_stride);
             }
         }
     }
 }
 
+
+}  // namespace
+
+
+template <typename ValueType>
+void simple_apply(std::shared_ptr<const DefaultExecutor> exec,
+                  const matrix::Dense<ValueType>* a,
+                  const matrix::Dense<ValueType>* b,
+                  matrix::Dense<ValueType>* c)
+{
+    gemm(one<ValueType>(), a, b, zero<ValueType>(), true, c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_SIMPLE_APPLY_KERNEL);
+
+
+template <typename ValueType>
+void apply(std::shared_ptr<const DefaultExecutor> exec,
+           const matrix::Dense<ValueType>* alpha,
+           const matrix::Dense<ValueType>* a, const matrix::Dense<ValueType>* b,
+           const matrix::Dense<ValueType>* beta, matrix::Dense<ValueType>* c)
+{
+    // a zero beta still propagates NaN and Inf from c, like the other
+    // executors do
+    gemm(alpha->at(0, 0), a, b, beta->at(0, 0), false, c);
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_APPLY_KERNEL);
 
 
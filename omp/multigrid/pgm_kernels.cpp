@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 
 
 #include <omp.h>
@@ -17,7 +18,8 @@
 #include <ginkgo/core/multigrid/pgm.hpp>
 
 
-#include "core/base/iterator_factory.hpp"
+#include "core/base/allocator.hpp"
+#include "omp/components/sorting.hpp"
 
 
 namespace gko {
@@ -35,8 +37,12 @@ template <typename IndexType>
 void sort_agg(std::shared_ptr<const DefaultExecutor> exec, IndexType num,
               IndexType* row_idxs, IndexType* col_idxs)
 {
-    auto it = detail::make_zip_iterator(row_idxs, col_idxs);
-    std::sort(it, it + num);
+    const auto size = static_cast<size_type>(num);
+    array<IndexType> permutation{exec, size};
+    compute_row_major_permutation(exec, row_idxs, col_idxs, size,
+                                  permutation.get_data());
+    apply_permutation(exec, permutation.get_const_data(), size, row_idxs);
+    apply_permutation(exec, permutation.get_const_data(), size, col_idxs);
 }
 
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_SORT_AGG_KERNEL);
@@ -46,11 +52,12 @@ template <typename ValueType, typename IndexType>
 void sort_row_major(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
                     IndexType* row_idxs, IndexType* col_idxs, ValueType* vals)
 {
-    auto it = detail::make_zip_iterator(row_idxs, col_idxs, vals);
-    std::stable_sort(it, it + nnz, [](auto a, auto b) {
-        return std::tie(std::get<0>(a), std::get<1>(a)) <
-               std::tie(std::get<0>(b), std::get<1>(b));
-    });
+    array<int64> permutation{exec, nnz};
+    compute_row_major_permutation(exec, row_idxs, col_idxs, nnz,
+                                  permutation.get_data());
+    apply_permutation(exec, permutation.get_const_data(), nnz, row_idxs);
+    apply_permutation(exec, permutation.get_const_data(), nnz, col_idxs);
+    apply_permutation(exec, permutation.get_const_data(), nnz, vals);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
@@ -65,28 +72,50 @@ void compute_coarse_coo(std::shared_ptr<const DefaultExecutor> exec,
     auto coarse_row = coarse_coo->get_row_idxs();
     auto coarse_col = coarse_coo->get_col_idxs();
     auto coarse_val = coarse_coo->get_values();
-    size_type idxs = 0;
-    size_type coarse_idxs = 0;
-    IndexType curr_row = row_idxs[0];
-    IndexType curr_col = col_idxs[0];
-    ValueType temp_val = vals[0];
-    for (size_type idxs = 1; idxs < fine_nnz; idxs++) {
-        if (curr_row != row_idxs[idxs] || curr_col != col_idxs[idxs]) {
-            coarse_row[coarse_idxs] = curr_row;
-            coarse_col[coarse_idxs] = curr_col;
-            coarse_val[coarse_idxs] = temp_val;
-            curr_row = row_idxs[idxs];
-            curr_col = col_idxs[idxs];
-            temp_val = vals[idxs];
-            coarse_idxs++;
-            continue;
+    const auto is_segment_begin = [&](size_type i) {
+        return i == 0 || row_idxs[i] != row_idxs[i - 1] ||
+               col_idxs[i] != col_idxs[i - 1];
+    };
+    // every chunk reduces the segments of equal (row, col) starting inside it,
+    // possibly reading past its end
+    const auto num_chunks = static_cast<size_type>(omp_get_max_threads());
+    const auto per_chunk =
+        static_cast<size_type>(ceildiv(fine_nnz, num_chunks));
+    vector<size_type> chunk_offsets(num_chunks + 1, {exec});
+#pragma omp parallel for
+    for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+        const auto begin = std::min(fine_nnz, chunk * per_chunk);
+        const auto end = std::min(fine_nnz, begin + per_chunk);
+        size_type count{};
+        for (auto i = begin; i < end; i++) {
+            count += is_segment_begin(i) ? 1 : 0;
+        }
+        chunk_offsets[chunk + 1] = count;
+    }
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                     chunk_offsets.begin());
+    GKO_ASSERT(chunk_offsets.back() == coarse_coo->get_num_stored_elements());
+#pragma omp parallel for
+    for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+        const auto begin = std::min(fine_nnz, chunk * per_chunk);
+        const auto end = std::min(fine_nnz, begin + per_chunk);
+        // skip the tail of a segment started by a previous chunk
+        auto i = begin;
+        while (i < end && !is_segment_begin(i)) {
+            i++;
+        }
+        auto coarse_idx = chunk_offsets[chunk];
+        while (i < end) {
+            auto temp_val = vals[i];
+            coarse_row[coarse_idx] = row_idxs[i];
+            coarse_col[coarse_idx] = col_idxs[i];
+            for (i++; i < fine_nnz && !is_segment_begin(i); i++) {
+                temp_val += vals[i];
+            }
+            coarse_val[coarse_idx] = temp_val;
+            coarse_idx++;
         }
-        temp_val += vals[idxs];
     }
-    GKO_ASSERT(coarse_idxs + 1 == coarse_coo->get_num_stored_elements());
-    coarse_row[coarse_idxs] = curr_row;
-    coarse_col[coarse_idxs] = curr_col;
-    coarse_val[coarse_idxs] = temp_val;
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
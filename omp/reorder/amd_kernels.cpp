@@ -0,0 +1,360 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/amd_kernels.hpp"
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "omp/components/atomic.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The AMD reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace amd {
+
+
+// Candidates for elimination may have a degree of up to
+// min_degree + min_degree / candidate_degree_slack.
+constexpr int candidate_degree_slack = 10;
+
+
+// Rows with more than max(dense_degree_min, dense_degree_factor * sqrt(n))
+// off-diagonal entries are considered dense and ordered last.
+constexpr int dense_degree_min = 16;
+constexpr double dense_degree_factor = 10.0;
+
+
+enum class node_status : uint8 { variable, element, absorbed, dense };
+
+
+/**
+ * Returns a pseudo-random priority for selecting pivots. The hash is
+ * bijective, so the priorities of all nodes are distinct.
+ */
+template <typename IndexType>
+uint64 pivot_priority(IndexType node)
+{
+    auto hash = static_cast<uint64>(node);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+
+/**
+ * Doubly-linked lists of all variables with the same approximate degree.
+ */
+template <typename IndexType>
+struct degree_lists {
+    degree_lists(std::shared_ptr<const DefaultExecutor> exec, IndexType size)
+        : heads(size, invalid_index<IndexType>(), exec),
+          next(size, exec),
+          prev(size, exec),
+          list_degrees(size, exec),
+          min_degree{size}
+    {}
+
+    void insert(IndexType node, IndexType degree)
+    {
+        next[node] = heads[degree];
+        prev[node] = invalid_index<IndexType>();
+        if (heads[degree] != invalid_index<IndexType>()) {
+            prev[heads[degree]] = node;
+        }
+        heads[degree] = node;
+        list_degrees[node] = degree;
+        min_degree = std::min(min_degree, degree);
+    }
+
+    void remove(IndexType node)
+    {
+        if (prev[node] != invalid_index<IndexType>()) {
+            next[prev[node]] = next[node];
+        } else {
+            heads[list_degrees[node]] = next[node];
+        }
+        if (next[node] != invalid_index<IndexType>()) {
+            prev[next[node]] = prev[node];
+        }
+    }
+
+    /** Returns the minimum degree, there must be at least one variable. */
+    IndexType find_min_degree()
+    {
+        while (heads[min_degree] == invalid_index<IndexType>()) {
+            ++min_degree;
+        }
+        return min_degree;
+    }
+
+    vector<IndexType> heads;
+    vector<IndexType> next;
+    vector<IndexType> prev;
+    vector<IndexType> list_degrees;
+    IndexType min_degree;
+};
+
+
+/**
+ * Calls fn for every variable reachable from the variable `node` in the
+ * elimination graph, including `node` itself. Variables may be visited more
+ * than once.
+ */
+template <typename IndexType, typename Callback>
+void for_each_reachable(const vector<vector<IndexType>>& variables,
+                        const vector<vector<IndexType>>& elements,
+                        IndexType node, Callback fn)
+{
+    fn(node);
+    for (const auto var : variables[node]) {
+        fn(var);
+    }
+    for (const auto element : elements[node]) {
+        for (const auto var : variables[element]) {
+            fn(var);
+        }
+    }
+}
+
+
+/**
+ * Computes an approximate minimum degree ordering by multiple elimination on
+ * the quotient graph: In every step, all candidates with almost minimum
+ * approximate degree are considered, and an independent subset of them is
+ * eliminated in parallel. The subset is independent in the elimination graph
+ * with distance 2, i.e. no two pivots have a common neighbor, so their
+ * eliminations do not interfere with each other. The selection is
+ * deterministic, so the result matches the reference implementation.
+ *
+ * For a variable, `variables` contains the adjacent variables and `elements`
+ * the adjacent elements, for an element, `variables` contains all variables
+ * it is adjacent to. These lists only ever contain variables, resp. elements
+ * that have not been absorbed.
+ */
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,
+                         IndexType num_rows, const IndexType* row_ptrs,
+                         const IndexType* col_idxs, IndexType* permutation)
+{
+    const auto dense_degree = std::max<IndexType>(
+        dense_degree_min,
+        static_cast<IndexType>(dense_degree_factor * std::sqrt(num_rows)));
+    vector<node_status> status(num_rows, node_status::variable, exec);
+    vector<vector<IndexType>> variables(num_rows, vector<IndexType>(exec),
+                                        exec);
+    vector<vector<IndexType>> elements(num_rows, vector<IndexType>(exec),
+                                       exec);
+    vector<IndexType> degrees(num_rows, exec);
+    for (IndexType row = 0; row < num_rows; row++) {
+        if (row_ptrs[row + 1] - row_ptrs[row] > dense_degree) {
+            status[row] = node_status::dense;
+        }
+    }
+    IndexType num_variables{};
+    degree_lists<IndexType> lists(exec, num_rows);
+    for (IndexType row = 0; row < num_rows; row++) {
+        if (status[row] == node_status::dense) {
+            continue;
+        }
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (col != row && status[col] != node_status::dense) {
+                variables[row].push_back(col);
+            }
+        }
+        degrees[row] = static_cast<IndexType>(variables[row].size());
+        lists.insert(row, degrees[row]);
+        num_variables++;
+    }
+    vector<IndexType> marks(num_rows, invalid_index<IndexType>(), exec);
+    vector<uint64> best_priorities(num_rows, std::numeric_limits<uint64>::max(),
+                                   exec);
+    vector<IndexType> candidates(exec);
+    vector<IndexType> pivots(exec);
+    vector<uint8> selected(exec);
+    IndexType num_eliminated{};
+    while (num_eliminated < num_variables) {
+        // collect all candidates with almost minimum degree
+        const auto min_degree = lists.find_min_degree();
+        const auto max_degree = std::min<IndexType>(
+            min_degree + min_degree / candidate_degree_slack, num_rows - 1);
+        candidates.clear();
+        for (auto degree = min_degree; degree <= max_degree; degree++) {
+            for (auto node = lists.heads[degree];
+                 node != invalid_index<IndexType>(); node = lists.next[node]) {
+                candidates.push_back(node);
+            }
+        }
+        // select all candidates with the highest priority among all
+        // candidates that can reach one of their neighbors
+        const auto num_candidates = static_cast<IndexType>(candidates.size());
+#pragma omp parallel for schedule(dynamic, 64)
+        for (IndexType i = 0; i < num_candidates; i++) {
+            const auto candidate = candidates[i];
+            const auto priority = pivot_priority(candidate);
+            for_each_reachable(variables, elements, candidate, [&](auto var) {
+                atomic_min(best_priorities[var], priority);
+            });
+        }
+        selected.resize(candidates.size());
+#pragma omp parallel for schedule(dynamic, 64)
+        for (IndexType i = 0; i < num_candidates; i++) {
+            const auto candidate = candidates[i];
+            const auto priority = pivot_priority(candidate);
+            bool is_selected = true;
+            for_each_reachable(variables, elements, candidate, [&](auto var) {
+                is_selected = is_selected && best_priorities[var] == priority;
+            });
+            selected[i] = is_selected;
+        }
+#pragma omp parallel for schedule(dynamic, 64)
+        for (IndexType i = 0; i < num_candidates; i++) {
+            for_each_reachable(variables, elements, candidates[i],
+                               [&](auto var) {
+#pragma omp atomic write
+                                   best_priorities[var] =
+                                       std::numeric_limits<uint64>::max();
+                               });
+        }
+        pivots.clear();
+        for (IndexType i = 0; i < num_candidates; i++) {
+            if (selected[i]) {
+                pivots.push_back(candidates[i]);
+            }
+        }
+        const auto num_pivots = static_cast<IndexType>(pivots.size());
+        num_eliminated += num_pivots;
+        const auto num_remaining = num_variables - num_eliminated;
+        // eliminate the pivots: each pivot becomes an element adjacent to all
+        // variables reachable from it, absorbing its adjacent elements
+#pragma omp parallel
+        {
+            vector<IndexType> new_element(exec);
+#pragma omp for schedule(dynamic, 16)
+            for (IndexType i = 0; i < num_pivots; i++) {
+                const auto pivot = pivots[i];
+                new_element.clear();
+                const auto add_variable = [&](IndexType var) {
+                    if (var != pivot && marks[var] != pivot) {
+                        marks[var] = pivot;
+                        new_element.push_back(var);
+                    }
+                };
+                for (const auto var : variables[pivot]) {
+                    add_variable(var);
+                }
+                for (const auto element : elements[pivot]) {
+                    for (const auto var : variables[element]) {
+                        add_variable(var);
+                    }
+                    status[element] = node_status::absorbed;
+                    variables[element].clear();
+                    variables[element].shrink_to_fit();
+                }
+                variables[pivot].assign(new_element.begin(),
+                                        new_element.end());
+                elements[pivot].clear();
+                elements[pivot].shrink_to_fit();
+                status[pivot] = node_status::element;
+            }
+        }
+        // update the adjacent variables and their approximate degrees
+#pragma omp parallel
+        {
+            std::unordered_map<IndexType, IndexType> external_degrees;
+#pragma omp for schedule(dynamic, 16)
+            for (IndexType i = 0; i < num_pivots; i++) {
+                const auto pivot = pivots[i];
+                const auto new_degree =
+                    static_cast<IndexType>(variables[pivot].size()) - 1;
+                external_degrees.clear();
+                for (const auto var : variables[pivot]) {
+                    auto& var_variables = variables[var];
+                    var_variables.erase(
+                        std::remove_if(
+                            var_variables.begin(), var_variables.end(),
+                            [&](IndexType other) {
+                                return other == pivot || marks[other] == pivot;
+                            }),
+                        var_variables.end());
+                    auto& var_elements = elements[var];
+                    var_elements.erase(
+                        std::remove_if(var_elements.begin(), var_elements.end(),
+                                       [&](IndexType element) {
+                                           return status[element] ==
+                                                  node_status::absorbed;
+                                       }),
+                        var_elements.end());
+                    // |A_i \ i| + |L_p \ i| + sum_e |L_e \ L_p|
+                    auto degree = static_cast<IndexType>(var_variables.size()) +
+                                  new_degree;
+                    for (const auto element : var_elements) {
+                        auto it = external_degrees.find(element);
+                        if (it == external_degrees.end()) {
+                            const auto& element_variables = variables[element];
+                            const auto external_degree = std::count_if(
+                                element_variables.begin(),
+                                element_variables.end(), [&](IndexType other) {
+                                    return marks[other] != pivot;
+                                });
+                            it = external_degrees
+                                     .emplace(element, external_degree)
+                                     .first;
+                        }
+                        degree += it->second;
+                    }
+                    var_elements.push_back(pivot);
+                    degrees[var] = std::min(
+                        {num_remaining - 1, degrees[var] + new_degree, degree});
+                }
+            }
+        }
+        for (const auto pivot : pivots) {
+            lists.remove(pivot);
+            *permutation = pivot;
+            permutation++;
+        }
+        for (const auto pivot : pivots) {
+            for (const auto var : variables[pivot]) {
+                lists.remove(var);
+                lists.insert(var, degrees[var]);
+            }
+        }
+    }
+    for (IndexType row = 0; row < num_rows; row++) {
+        if (status[row] == node_status::dense) {
+            *permutation = row;
+            permutation++;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_AMD_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
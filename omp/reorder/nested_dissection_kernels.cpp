@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/nested_dissection_kernels.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/reorder/amd_kernels.hpp"
+#include "core/reorder/graph_bisection.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The nested dissection reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace nested_dissection {
+
+
+// Subgraphs with at most this many nodes are ordered using AMD.
+constexpr int max_leaf_size = 120;
+
+// Subgraphs with at least this many nodes are dissected in a separate task.
+constexpr int min_task_size = 1000;
+
+
+using experimental::reorder::bisection::node_part;
+
+
+/**
+ * Orders the nodes of a subgraph by recursively ordering the two parts
+ * separated by a vertex separator, followed by the separator itself.
+ * The resulting ordering is a postorder of the separator tree, so the
+ * elimination tree of the permuted matrix contains independent subtrees for
+ * both parts.
+ * Only the two parts are ordered in parallel tasks. The separator itself is
+ * computed sequentially to match the reference ordering, so the first levels
+ * of the recursion run on a single thread and limit the speedup.
+ *
+ * @param node_ids  the original node ID of every node in the subgraph.
+ * @param permutation  the output array, it receives the original node IDs in
+ *                     elimination order.
+ */
+template <typename IndexType>
+void dissect(std::shared_ptr<const DefaultExecutor> exec, IndexType num_nodes,
+             const IndexType* row_ptrs, const IndexType* col_idxs,
+             const IndexType* node_ids, IndexType* permutation)
+{
+    vector<uint8> parts(num_nodes, exec);
+    IndexType part_sizes[3]{};
+    if (num_nodes > max_leaf_size) {
+        experimental::reorder::bisection::compute_separator(
+            exec, num_nodes, row_ptrs, col_idxs, parts.data());
+        for (const auto part : parts) {
+            part_sizes[part]++;
+        }
+    }
+    if (part_sizes[0] == 0 || part_sizes[1] == 0) {
+        vector<IndexType> local_permutation(num_nodes, exec);
+        amd::compute_permutation(exec, num_nodes, row_ptrs, col_idxs,
+                                 local_permutation.data());
+        for (IndexType i = 0; i < num_nodes; i++) {
+            permutation[i] = node_ids[local_permutation[i]];
+        }
+        return;
+    }
+    vector<IndexType> left_row_ptrs(exec);
+    vector<IndexType> left_col_idxs(exec);
+    vector<IndexType> left_node_ids(exec);
+    vector<IndexType> right_row_ptrs(exec);
+    vector<IndexType> right_col_idxs(exec);
+    vector<IndexType> right_node_ids(exec);
+    experimental::reorder::bisection::extract_subgraph(
+        exec, num_nodes, row_ptrs, col_idxs, node_ids, parts.data(),
+        node_part::left, left_row_ptrs, left_col_idxs, left_node_ids);
+    experimental::reorder::bisection::extract_subgraph(
+        exec, num_nodes, row_ptrs, col_idxs, node_ids, parts.data(),
+        node_part::right, right_row_ptrs, right_col_idxs, right_node_ids);
+    const auto left_size = part_sizes[0];
+    const auto right_size = part_sizes[1];
+    // the subgraphs are independent, so they can be ordered concurrently
+#pragma omp task default(shared) if (left_size >= min_task_size)
+    dissect(exec, left_size, left_row_ptrs.data(), left_col_idxs.data(),
+            left_node_ids.data(), permutation);
+    dissect(exec, right_size, right_row_ptrs.data(), right_col_idxs.data(),
+            right_node_ids.data(), permutation + left_size);
+#pragma omp taskwait
+    auto sub_permutation = permutation + left_size + right_size;
+    for (IndexType node = 0; node < num_nodes; node++) {
+        if (parts[node] == static_cast<uint8>(node_part::separator)) {
+            *sub_permutation = node_ids[node];
+            sub_permutation++;
+        }
+    }
+}
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,
+                         IndexType num_rows, const IndexType* row_ptrs,
+                         const IndexType* col_idxs, IndexType* permutation)
+{
+    vector<IndexType> node_ids(num_rows, exec);
+    std::iota(node_ids.begin(), node_ids.end(), IndexType{});
+#pragma omp parallel
+#pragma omp single
+    dissect(exec, num_rows, row_ptrs, col_idxs, node_ids.data(), permutation);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_NESTED_DISSECTION_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
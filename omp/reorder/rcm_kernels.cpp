@@ -28,6 +28,7 @@
 
 #include "core/base/allocator.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "omp/components/atomic.hpp"
 #include "omp/components/omp_mutex.hpp"
 #include "omp/components/sort_small.hpp"
 
@@ -167,50 +168,6 @@ struct UbfsLinearQueue {
 };
 
 
-#ifdef _MSC_VER
-#define GKO_CMPXCHG_IMPL(ptr, ptr_expected, replace_with)                     \
-    if (sizeof replace_with == 8) {                                           \
-        return _InterlockedCompareExchange64(reinterpret_cast<int64_t*>(ptr), \
-                                             replace_with,                    \
-                                             *ptr_expected) == *ptr_expected; \
-    }                                                                         \
-    if (sizeof replace_with == 4) {                                           \
-        return _InterlockedCompareExchange(reinterpret_cast<long*>(ptr),      \
-                                           replace_with,                      \
-                                           *ptr_expected) == *ptr_expected;   \
-    }                                                                         \
-    if (sizeof replace_with == 2) {                                           \
-        return _InterlockedCompareExchange16(reinterpret_cast<short*>(ptr),   \
-                                             replace_with,                    \
-                                             *ptr_expected) == *ptr_expected; \
-    }                                                                         \
-    if (sizeof replace_with == 1) {                                           \
-        return _InterlockedCompareExchange8(reinterpret_cast<char*>(ptr),     \
-                                            replace_with,                     \
-                                            *ptr_expected) == *ptr_expected;  \
-    }
-#else
-#define GKO_CMPXCHG_IMPL(ptr, ptr_expected, replace_with) \
-    return __atomic_compare_exchange_n(                   \
-        ptr, ptr_expected, replace_with, true,            \
-        static_cast<int>(std::memory_order_acq_rel),      \
-        static_cast<int>(std::memory_order_acquire));
-#endif
-
-/**
- * Basic building block for CAS loops.
- * Note that "weak" and "acqrel" are only the minimum guarantees made.
- * Usage with types of size > 8 bytes is undefined behaviour.
- * Usage with non-primitive types is explicitly discouraged.
- */
-template <typename TargetType>
-inline bool compare_exchange_weak_acqrel(TargetType* value, TargetType old,
-                                         TargetType newer)
-{
-    GKO_CMPXCHG_IMPL(value, &old, newer)
-}
-
-
 template <typename IndexType>
 inline void reduce_neighbours_levels(const IndexType num_vertices,
                                      const IndexType* const row_ptrs,
@@ -342,17 +299,17 @@ void ubfs(std::shared_ptr<const OmpExecutor> exec, const IndexType num_vertices,
  */
 template <typename IndexType>
 std::pair<IndexType, IndexType> rls_contender_and_height(
-    std::shared_ptr<const OmpExecutor> exec, const IndexType num_vertices,
-    const IndexType* const row_ptrs, const IndexType* const col_idxs,
-    const IndexType* const degrees,
-    IndexType* const levels,  // Must be max/inf in all nodes connected to start
+    std::shared_ptr<const OmpExecutor> exec, const IndexType* const row_ptrs,
+    const IndexType* const col_idxs, const IndexType* const degrees,
+    const IndexType* const component, const IndexType component_size,
+    IndexType* const levels,  // Must be max/inf in all nodes of the component
     const IndexType start, const IndexType max_degree)
 {
     // Layout: ((level, degree), idx).
     using contending = std::pair<std::pair<IndexType, IndexType>, IndexType>;
 
     // Create a level structure.
-    ubfs(exec, num_vertices, row_ptrs, col_idxs, levels, start, max_degree);
+    ubfs(exec, component_size, row_ptrs, col_idxs, levels, start, max_degree);
 
     // Find a node in the last level with minimal degree, the "contender".
     // Implement this through a tie-max reduction. First reduce local ...
@@ -367,13 +324,14 @@ std::pair<IndexType, IndexType> rls_contender_and_height(
         auto local_contender = initial_value;
 
 #pragma omp for schedule(static)
-        for (IndexType i = 1; i < num_vertices; ++i) {
+        for (IndexType i = 0; i < component_size; ++i) {
+            const auto node = component[i];
             // choose maximum level and minimum degree
-            if (levels[i] != std::numeric_limits<IndexType>::max() &&
-                std::tie(levels[i], local_contender.first.second) >
-                    std::tie(local_contender.first.first, degrees[i])) {
-                local_contender.first = std::make_pair(levels[i], degrees[i]);
-                local_contender.second = i;
+            if (std::tie(levels[node], local_contender.first.second) >
+                std::tie(local_contender.first.first, degrees[node])) {
+                local_contender.first =
+                    std::make_pair(levels[node], degrees[node]);
+                local_contender.second = node;
             }
         }
 
@@ -384,9 +342,9 @@ std::pair<IndexType, IndexType> rls_contender_and_height(
     auto global_contender = initial_value;
     for (int32 i = 0; i < num_threads; ++i) {
         if (std::tie(local_contenders[i].first.first,
-                     local_contenders[i].first.second) >
+                     global_contender.first.second) >
             std::tie(global_contender.first.first,
-                     global_contender.first.second)) {
+                     local_contenders[i].first.second)) {
             global_contender = local_contenders[i];
         }
     }
@@ -397,15 +355,13 @@ std::pair<IndexType, IndexType> rls_contender_and_height(
 
 
 /**
- * Finds the index of a node with minimum degree and the maximum degree.
+ * Finds the index of a node with minimum degree and the maximum degree
+ * within a connected component.
  */
 template <typename IndexType>
 std::pair<IndexType, IndexType> find_min_idx_and_max_val(
-    std::shared_ptr<const OmpExecutor> exec, const IndexType num_vertices,
-    const IndexType* const row_ptrs, const IndexType* const col_idxs,
-    const IndexType* const degrees, vector<IndexType>& levels,
-    const uint8* const previous_component,
-    gko::reorder::starting_strategy strategy)
+    std::shared_ptr<const OmpExecutor> exec, const IndexType* const degrees,
+    const IndexType* const component, const IndexType component_size)
 {
     // Layout: ((min_val, min_idx), (max_val, max_idx)).
     using minmax = std::pair<std::pair<IndexType, IndexType>,
@@ -424,15 +380,13 @@ std::pair<IndexType, IndexType> find_min_idx_and_max_val(
         auto local_minmax = initial_value;
 
 #pragma omp for schedule(static)
-        for (IndexType i = 0; i < num_vertices; ++i) {
-            // If this level hasn't been discovered before.
-            if (!previous_component[i]) {
-                if (degrees[i] < local_minmax.first.first) {
-                    local_minmax.first = std::make_pair(degrees[i], i);
-                }
-                if (degrees[i] > local_minmax.second.first) {
-                    local_minmax.second = std::make_pair(degrees[i], i);
-                }
+        for (IndexType i = 0; i < component_size; ++i) {
+            const auto node = component[i];
+            if (degrees[node] < local_minmax.first.first) {
+                local_minmax.first = std::make_pair(degrees[node], node);
+            }
+            if (degrees[node] > local_minmax.second.first) {
+                local_minmax.second = std::make_pair(degrees[node], node);
             }
         }
 
@@ -441,17 +395,12 @@ std::pair<IndexType, IndexType> find_min_idx_and_max_val(
 
     // ... then global.
     auto global_minmax = initial_value;
-    for (IndexType i = 0; i < num_threads; ++i) {
-        // If this level hasn't been discovered before.
-        if (!previous_component[local_minmaxs[i].first.second]) {
-            if (local_minmaxs[i].first.first < global_minmax.first.first) {
-                global_minmax.first = local_minmaxs[i].first;
-            }
+    for (int32 i = 0; i < num_threads; ++i) {
+        if (local_minmaxs[i].first.first < global_minmax.first.first) {
+            global_minmax.first = local_minmaxs[i].first;
         }
-        if (!previous_component[local_minmaxs[i].second.second]) {
-            if (local_minmaxs[i].second.first > global_minmax.second.first) {
-                global_minmax.second = local_minmaxs[i].second;
-            }
+        if (local_minmaxs[i].second.first > global_minmax.second.first) {
+            global_minmax.second = local_minmaxs[i].second;
         }
     }
 
@@ -461,51 +410,64 @@ std::pair<IndexType, IndexType> find_min_idx_and_max_val(
 
 
 /**
- * Finds a start node for the urcm algorithm, using parallel building blocks.
+ * Resets the levels of all nodes in a connected component to max/inf.
+ */
+template <typename IndexType>
+void reset_levels(const IndexType* const component,
+                  const IndexType component_size, IndexType* const levels)
+{
+#pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < component_size; ++i) {
+        levels[component[i]] = std::numeric_limits<IndexType>::max();
+    }
+}
+
+
+/**
+ * Finds a start node for the urcm algorithm in a connected component, using
+ * parallel building blocks. On return, `levels` points to the level structure
+ * rooted at the start node, and `tmp_levels` to scratch storage, which may
+ * be swapped during the pseudo-peripheral node search.
  */
 template <typename IndexType>
 IndexType find_start_node(std::shared_ptr<const OmpExecutor> exec,
-                          const IndexType num_vertices,
                           const IndexType* const row_ptrs,
                           const IndexType* const col_idxs,
                           const IndexType* const degrees,
-                          vector<IndexType>& levels,
-                          const uint8* const previous_component,
+                          const IndexType* const component,
+                          const IndexType component_size, IndexType*& levels,
+                          IndexType*& tmp_levels,
                           const gko::reorder::starting_strategy strategy)
 {
     // Find the node with minimal degree and the maximum degree.
     // That is necessary for every strategy.
     const auto min_idx_and_max_val =
-        find_min_idx_and_max_val(exec, num_vertices, row_ptrs, col_idxs,
-                                 degrees, levels, previous_component, strategy);
+        find_min_idx_and_max_val(exec, degrees, component, component_size);
     const auto min_idx = min_idx_and_max_val.first;
     const auto max_val = min_idx_and_max_val.second;
 
     // Now is the time to return for the min degere strategy.
     if (strategy == gko::reorder::starting_strategy::minimum_degree) {
-        ubfs(exec, num_vertices, row_ptrs, col_idxs, &levels[0], min_idx,
+        ubfs(exec, component_size, row_ptrs, col_idxs, levels, min_idx,
              max_val);
         return min_idx;
     }
 
-    // Intermediate storage.
-    // We copy back to `levels` for the final pick.
-    vector<IndexType> levels_clone(levels, exec);
-    vector<IndexType> current_levels_clone(levels, exec);
-
+    // George-Liu pseudo-peripheral node search, where every level structure
+    // is built by a parallel ubfs.
     auto current = min_idx;
     const auto contender_and_height =
-        rls_contender_and_height(exec, num_vertices, row_ptrs, col_idxs,
-                                 degrees, &levels_clone[0], current, max_val);
-    current_levels_clone.swap(levels_clone);
+        rls_contender_and_height(exec, row_ptrs, col_idxs, degrees, component,
+                                 component_size, levels, current, max_val);
     auto current_contender = contender_and_height.first;
     auto current_height = contender_and_height.second;
 
     // This loop always terminates, as height needs to strictly increase.
     while (true) {
+        reset_levels(component, component_size, tmp_levels);
         const auto contender_contender_and_height = rls_contender_and_height(
-            exec, num_vertices, row_ptrs, col_idxs, degrees, &levels_clone[0],
-            current_contender, max_val);
+            exec, row_ptrs, col_idxs, degrees, component, component_size,
+            tmp_levels, current_contender, max_val);
         auto contender_contender = contender_contender_and_height.first;
         auto contender_height = contender_contender_and_height.second;
 
@@ -513,11 +475,8 @@ IndexType find_start_node(std::shared_ptr<const OmpExecutor> exec,
             current_height = contender_height;
             current = current_contender;
             current_contender = contender_contender;
-            current_levels_clone = vector<IndexType>(levels, exec);
-            current_levels_clone.swap(levels_clone);
+            std::swap(levels, tmp_levels);
         } else {
-            std::copy_n(current_levels_clone.begin(), num_vertices,
-                        levels.begin());
             return current;
         }
     }
@@ -525,13 +484,13 @@ IndexType find_start_node(std::shared_ptr<const OmpExecutor> exec,
 
 
 /**
- * Counts how many nodes there are per level.
+ * Counts how many nodes there are per level of a connected component.
  */
 template <typename IndexType>
 vector<IndexType> count_levels(std::shared_ptr<const OmpExecutor> exec,
                                const IndexType* const levels,
-                               uint8* const previous_component,
-                               IndexType num_vertices)
+                               const IndexType* const component,
+                               const IndexType component_size)
 {
     const int32 num_threads = omp_get_max_threads();
     vector<vector<IndexType>> level_counts(num_threads, vector<IndexType>(exec),
@@ -543,19 +502,12 @@ vector<IndexType> count_levels(std::shared_ptr<const OmpExecutor> exec,
         auto local_level_counts = &level_counts[tid];
 
 #pragma omp for schedule(static)
-        for (IndexType i = 0; i < num_vertices; ++i) {
-            const auto level = levels[i];
-
-            // If not part of previous component and actually discovered in this
-            // component.
-            if (!previous_component[i] &&
-                level != std::numeric_limits<IndexType>::max()) {
-                if (level >= local_level_counts->size()) {
-                    local_level_counts->resize(level + 1);
-                }
-                previous_component[i] = true;
-                ++(*local_level_counts)[level];
+        for (IndexType i = 0; i < component_size; ++i) {
+            const auto level = levels[component[i]];
+            if (level >= local_level_counts->size()) {
+                local_level_counts->resize(level + 1);
             }
+            ++(*local_level_counts)[level];
         }
     }
 
@@ -582,10 +534,10 @@ vector<IndexType> count_levels(std::shared_ptr<const OmpExecutor> exec,
 template <typename IndexType>
 vector<IndexType> compute_level_offsets(std::shared_ptr<const OmpExecutor> exec,
                                         const IndexType* const levels,
-                                        IndexType num_vertices,
-                                        uint8* const previous_component)
+                                        const IndexType* const component,
+                                        const IndexType component_size)
 {
-    auto counts = count_levels(exec, levels, previous_component, num_vertices);
+    auto counts = count_levels(exec, levels, component, component_size);
     counts.push_back(0);
     components::prefix_sum_nonnegative(exec, &counts[0], counts.size());
     return counts;
@@ -698,50 +650,237 @@ void write_permutation(std::shared_ptr<const OmpExecutor> exec,
 
 
 /**
- * Processes all isolated nodes, returning their count.
+ * Builds the rooted level structure of a connected component with a
+ * sequential breadth-first search, storing the visited nodes in `queue`, and
+ * returns a contender along with the rls height. All levels are reset to
+ * max/inf afterwards.
  */
 template <typename IndexType>
-IndexType handle_isolated_nodes(std::shared_ptr<const OmpExecutor> exec,
-                                const IndexType* const row_ptrs,
-                                const IndexType* const col_idxs,
-                                const IndexType* const degrees,
-                                IndexType* const perm, IndexType num_vertices,
-                                vector<uint8>& previous_component)
+std::pair<IndexType, IndexType> rls_contender_and_height_sequential(
+    const IndexType* const row_ptrs, const IndexType* const col_idxs,
+    const IndexType* const degrees, IndexType* const levels,
+    IndexType* const queue, const IndexType start)
 {
-    const int32 num_threads = omp_get_max_threads();
-    vector<vector<IndexType>> local_isolated_nodes(
-        num_threads, vector<IndexType>(exec), exec);
+    IndexType head = 0;
+    IndexType tail = 1;
+    queue[0] = start;
+    levels[start] = 0;
+    while (head < tail) {
+        const auto node = queue[head];
+        ++head;
+        for (auto nz = row_ptrs[node]; nz < row_ptrs[node + 1]; ++nz) {
+            const auto neighbour = col_idxs[nz];
+            if (levels[neighbour] == std::numeric_limits<IndexType>::max()) {
+                levels[neighbour] = levels[node] + 1;
+                queue[tail] = neighbour;
+                ++tail;
+            }
+        }
+    }
+    // The last level is stored contiguously at the end of the queue.
+    const auto height = levels[queue[tail - 1]];
+    auto contender = queue[tail - 1];
+    for (auto i = tail - 1; i >= 0 && levels[queue[i]] == height; --i) {
+        if (degrees[queue[i]] < degrees[contender]) {
+            contender = queue[i];
+        }
+    }
+    for (IndexType i = 0; i < tail; ++i) {
+        levels[queue[i]] = std::numeric_limits<IndexType>::max();
+    }
+    return std::make_pair(contender, height);
+}
 
-#pragma omp parallel
-    {
-        const int32 tid = omp_get_thread_num();
 
-#pragma omp for schedule(static)
-        for (IndexType i = 0; i < num_vertices; ++i) {
-            // No need to check for diagonal elements (only self-neighbouring)
-            // here, those are already removed from the matrix.
-            if (degrees[i] == 0) {
-                local_isolated_nodes[tid].push_back(i);
-                previous_component[i] = true;
+/**
+ * Computes the cm ordering of a (small) connected component sequentially,
+ * writing it to `perm`, which needs to have space for `component_size`
+ * entries.
+ */
+template <typename IndexType>
+void compute_component_permutation_sequential(
+    const IndexType* const row_ptrs, const IndexType* const col_idxs,
+    const IndexType* const degrees, const IndexType* const component,
+    const IndexType component_size, IndexType* const levels,
+    IndexType* const perm, const gko::reorder::starting_strategy strategy)
+{
+    // Find a node with minimal degree.
+    auto current = *std::min_element(
+        component, component + component_size,
+        [&](IndexType u, IndexType v) { return degrees[u] < degrees[v]; });
+
+    // Find a pseudo-peripheral node, using perm as bfs queue storage.
+    // Isolated nodes are by definition peripheral.
+    if (strategy == gko::reorder::starting_strategy::pseudo_peripheral &&
+        degrees[current] > 0) {
+        auto contender_and_height = rls_contender_and_height_sequential(
+            row_ptrs, col_idxs, degrees, levels, perm, current);
+        // This loop always terminates, as height needs to strictly increase.
+        while (true) {
+            const auto contender_contender_and_height =
+                rls_contender_and_height_sequential(
+                    row_ptrs, col_idxs, degrees, levels, perm,
+                    contender_and_height.first);
+            if (contender_contender_and_height.second >
+                contender_and_height.second) {
+                current = contender_and_height.first;
+                contender_and_height = contender_contender_and_height;
+            } else {
+                break;
             }
         }
     }
 
-    const auto isolated_nodes = std::accumulate(
-        local_isolated_nodes.begin(), local_isolated_nodes.end(),
-        vector<IndexType>(exec), [](vector<IndexType> a, vector<IndexType> b) {
-            a.reserve(a.size() + b.size());
-            a.insert(a.end(), b.begin(), b.end());
-            return a;
-        });
+    // Breadth-first search from the start node, visiting the neighbours of
+    // each node in order of increasing degree.
+    IndexType head = 0;
+    IndexType tail = 1;
+    perm[0] = current;
+    levels[current] = 0;
+    while (head < tail) {
+        const auto node = perm[head];
+        ++head;
+        const auto prev_tail = tail;
+        for (auto nz = row_ptrs[node]; nz < row_ptrs[node + 1]; ++nz) {
+            const auto neighbour = col_idxs[nz];
+            if (levels[neighbour] == std::numeric_limits<IndexType>::max()) {
+                levels[neighbour] = levels[node] + 1;
+                perm[tail] = neighbour;
+                ++tail;
+            }
+        }
+        std::stable_sort(
+            perm + prev_tail, perm + tail,
+            [&](IndexType u, IndexType v) { return degrees[u] < degrees[v]; });
+    }
+}
+
 
-    std::copy_n(isolated_nodes.begin(), isolated_nodes.size(), perm);
-    return isolated_nodes.size();
+/**
+ * Returns the representative of the set containing node in a disjoint-set
+ * forest that is concurrently modified, halving the path to it on the way.
+ */
+template <typename IndexType>
+IndexType find_root_concurrent(IndexType* const parents, IndexType node)
+{
+    IndexType parent;
+#pragma omp atomic read
+    parent = parents[node];
+    while (parent != node) {
+        IndexType grandparent;
+#pragma omp atomic read
+        grandparent = parents[parent];
+        // Only ever shortens the path to the root, so failure is harmless.
+        compare_exchange_weak_acqrel(&parents[node], parent, grandparent);
+        node = parent;
+        parent = grandparent;
+    }
+    return node;
 }
 
 
 /**
- * Computes a rcm permutation, employing the parallel unordered rcm algorithm.
+ * Computes the connected components of the graph in parallel, grouping their
+ * nodes by component. The components are ordered by their smallest node,
+ * their nodes in ascending order.
+ *
+ * @param component_ptrs  returns the offsets of all components in
+ *                        component_nodes
+ * @param component_nodes  returns the nodes of all components, needs to have
+ *                         space for num_vertices entries
+ */
+template <typename IndexType>
+void find_connected_components(std::shared_ptr<const OmpExecutor> exec,
+                               const IndexType num_vertices,
+                               const IndexType* const row_ptrs,
+                               const IndexType* const col_idxs,
+                               array<IndexType>& component_ptrs,
+                               IndexType* const component_nodes)
+{
+    // Build a disjoint-set forest, where the smallest node of each component
+    // is its representative.
+    array<IndexType> parent_array{exec, static_cast<size_type>(num_vertices)};
+    const auto parents = parent_array.get_data();
+#pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < num_vertices; ++i) {
+        parents[i] = i;
+    }
+#pragma omp parallel for
+    for (IndexType node = 0; node < num_vertices; ++node) {
+        for (auto nz = row_ptrs[node]; nz < row_ptrs[node + 1]; ++nz) {
+            const auto neighbour = col_idxs[nz];
+            // The adjacency matrix is symmetric, handle every edge once.
+            if (neighbour >= node) {
+                continue;
+            }
+            while (true) {
+                auto node_root = find_root_concurrent(parents, node);
+                auto neighbour_root = find_root_concurrent(parents, neighbour);
+                if (node_root == neighbour_root) {
+                    break;
+                }
+                if (node_root < neighbour_root) {
+                    std::swap(node_root, neighbour_root);
+                }
+                // Attach the larger root below the smaller one, which fails
+                // if it was attached somewhere else in the meantime.
+                if (compare_exchange_weak_acqrel(&parents[node_root], node_root,
+                                                 neighbour_root)) {
+                    break;
+                }
+            }
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < num_vertices; ++i) {
+        const auto root = find_root_concurrent(parents, i);
+#pragma omp atomic write
+        parents[i] = root;
+    }
+
+    // Number the components by their representatives.
+    array<IndexType> component_id_array{
+        exec, static_cast<size_type>(num_vertices + 1)};
+    const auto component_ids = component_id_array.get_data();
+#pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < num_vertices; ++i) {
+        component_ids[i] = parents[i] == i ? 1 : 0;
+    }
+    components::prefix_sum_nonnegative(exec, component_ids, num_vertices + 1);
+    const auto num_components = component_ids[num_vertices];
+
+    // Group the nodes by component.
+    component_ptrs.resize_and_reset(num_components + 1);
+    const auto ptrs = component_ptrs.get_data();
+    std::fill_n(ptrs, num_components + 1, IndexType{});
+#pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < num_vertices; ++i) {
+#pragma omp atomic update
+        ++ptrs[component_ids[parents[i]]];
+    }
+    components::prefix_sum_nonnegative(exec, ptrs, num_components + 1);
+    array<IndexType> fill_array{exec, static_cast<size_type>(num_components)};
+    const auto fill_ptrs = fill_array.get_data();
+    std::copy_n(ptrs, num_components, fill_ptrs);
+#pragma omp parallel for schedule(static)
+    for (IndexType i = 0; i < num_vertices; ++i) {
+        IndexType output;
+#pragma omp atomic capture
+        output = fill_ptrs[component_ids[parents[i]]]++;
+        component_nodes[output] = i;
+    }
+#pragma omp parallel for schedule(dynamic)
+    for (IndexType component = 0; component < num_components; ++component) {
+        std::sort(component_nodes + ptrs[component],
+                  component_nodes + ptrs[component + 1]);
+    }
+}
+
+
+/**
+ * Computes a rcm permutation, employing the parallel unordered rcm algorithm
+ * on large connected components and processing small components
+ * concurrently.
  */
 template <typename IndexType>
 void compute_permutation(std::shared_ptr<const OmpExecutor> exec,
@@ -758,35 +897,66 @@ void compute_permutation(std::shared_ptr<const OmpExecutor> exec,
     for (IndexType i = 0; i < num_vertices; ++i) {
         degrees[i] = row_ptrs[i + 1] - row_ptrs[i];
     }
-    // Initialize the perm to all "signal value".
-    std::fill(perm, perm + num_vertices, perm_untouched);
-
-    // For multiple components.
-    IndexType base_offset = 0;
-
-    // Stores for each node if it is part of an already discovered component.
-    vector<uint8> previous_component(num_vertices, 0, exec);
 
-    // First handle all isolated nodes. That reduces complexity later on.
-    base_offset +=
-        handle_isolated_nodes(exec, row_ptrs, col_idxs, degrees, perm,
-                              num_vertices, previous_component);
-
-    // Stores the level structure. Initialized to all "infinity".
+    // Every component is written to the permutation at the offset of its
+    // node list.
+    array<IndexType> component_ptr_array{exec};
+    array<IndexType> component_node_array{
+        exec, static_cast<size_type>(num_vertices)};
+    const auto component_nodes = component_node_array.get_data();
+    find_connected_components(exec, num_vertices, row_ptrs, col_idxs,
+                              component_ptr_array, component_nodes);
+    const auto component_ptrs = component_ptr_array.get_const_data();
+    const IndexType num_components = component_ptr_array.get_size() - 1;
+
+    // Stores the level structures. Initialized to all "infinity".
+    // Components are disjoint, so they can share the storage.
     vector<IndexType> levels(num_vertices, exec);
+    vector<IndexType> tmp_levels(num_vertices, exec);
     std::fill(levels.begin(), levels.end(),
               std::numeric_limits<IndexType>::max());
+    std::fill(tmp_levels.begin(), tmp_levels.end(),
+              std::numeric_limits<IndexType>::max());
+
+    // Components with at least a single thread's share of the nodes are
+    // reordered one after another using all threads, all smaller components
+    // are reordered concurrently, one per thread.
+    const int32 num_threads = omp_get_max_threads();
+    const auto is_large = [&](IndexType component) {
+        const auto size =
+            component_ptrs[component + 1] - component_ptrs[component];
+        return size > 1 && static_cast<size_type>(size) * num_threads >=
+                               static_cast<size_type>(num_vertices);
+    };
+
+#pragma omp parallel for schedule(dynamic)
+    for (IndexType component = 0; component < num_components; ++component) {
+        if (!is_large(component)) {
+            const auto begin = component_ptrs[component];
+            compute_component_permutation_sequential(
+                row_ptrs, col_idxs, degrees, component_nodes + begin,
+                component_ptrs[component + 1] - begin, &levels[0],
+                perm + begin, strategy);
+        }
+    }
 
-    // Are we done yet?
-    auto done = false;
+    for (IndexType component = 0; component < num_components; ++component) {
+        if (!is_large(component)) {
+            continue;
+        }
+        const auto base_offset = component_ptrs[component];
+        const auto component_size =
+            component_ptrs[component + 1] - base_offset;
+        const auto component_begin = component_nodes + base_offset;
+        auto component_levels = &levels[0];
+        auto component_tmp_levels = &tmp_levels[0];
 
-    while (!done) {
         // Phase 1:
         // Finds a start node, while also filling the level structure.
 
-        const auto start =
-            find_start_node(exec, num_vertices, row_ptrs, col_idxs, degrees,
-                            levels, &previous_component[0], strategy);
+        const auto start = find_start_node(
+            exec, row_ptrs, col_idxs, degrees, component_begin, component_size,
+            component_levels, component_tmp_levels, strategy);
 
         // Phase 2:
         // Generate the level offsets.
@@ -794,7 +964,7 @@ void compute_permutation(std::shared_ptr<const OmpExecutor> exec,
         // Will contain 0 -- 1 -- level_count(2) + 1 -- level_count(2) +
         // level_count(3) + 1 -- ... -- total_sum
         vector<IndexType> offsets = compute_level_offsets(
-            exec, &levels[0], num_vertices, &previous_component[0]);
+            exec, component_levels, component_begin, component_size);
 
 
         // Phase 3:
@@ -804,15 +974,13 @@ void compute_permutation(std::shared_ptr<const OmpExecutor> exec,
         //              Write those neighbours of the node which are in the next
         //              level (and havent been written to that next level yet)
         //              to the next level, sorted by degree.
-        //  Once the last node in the last level is written for the last
-        //  component, the algorithm is finished.
+        //  Once the last node in the last level is written, the component is
+        //  finished.
 
-        write_permutation(exec, row_ptrs, col_idxs, &levels[0], degrees,
+        // Initialize the perm to all "signal value".
+        std::fill_n(perm + base_offset, component_size, perm_untouched);
+        write_permutation(exec, row_ptrs, col_idxs, component_levels, degrees,
                           offsets, perm, num_vertices, base_offset, start);
-
-        // Are we done yet?
-        done = base_offset + offsets.back() == num_vertices;
-        base_offset += offsets.back();
     }
 
 // Finally reverse the order.
@@ -831,6 +999,7 @@ void compute_permutation(std::shared_ptr<const OmpExecutor> exec,
     }
 }
 
+
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_RCM_COMPUTE_PERMUTATION_KERNEL);
 
 
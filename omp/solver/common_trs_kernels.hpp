@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+#define GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+
+
+#include <algorithm>
+#include <memory>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "omp/components/level_schedule.hpp"
+
+
+namespace gko {
+namespace solver {
+
+
+struct SolveStruct {
+    virtual ~SolveStruct() = default;
+};
+
+
+}  // namespace solver
+
+
+namespace kernels {
+namespace omp {
+namespace {
+
+
+/**
+ * Minimum average number of rows per level for which the level-scheduled
+ * triangular solve is used. Below this, the synchronization after each level
+ * outweighs the parallelism exposed by the schedule, and the solve falls back
+ * to the sequential sweep (parallelized over right-hand sides only).
+ */
+constexpr int trs_min_avg_level_size = 32;
+
+
+/**
+ * Level schedule of a sparse triangular matrix.
+ *
+ * The rows are partitioned into levels such that each row only depends on rows
+ * from previous levels. The rows of level `l` are stored in
+ * `level_rows[level_ptrs[l]]` to `level_rows[level_ptrs[l + 1] - 1]` in
+ * ascending order, so all rows inside a level can be solved in parallel.
+ */
+template <typename IndexType>
+struct LevelSolveStruct : gko::solver::SolveStruct {
+    array<IndexType> level_ptrs;
+    array<IndexType> level_rows;
+    /** the storage index of the diagonal entry for each row, or -1 */
+    array<IndexType> diag_idxs;
+
+    size_type get_num_levels() const
+    {
+        return level_ptrs.get_size() == 0 ? 0 : level_ptrs.get_size() - 1;
+    }
+
+    LevelSolveStruct(std::shared_ptr<const OmpExecutor> exec)
+        : level_ptrs{exec}, level_rows{exec}, diag_idxs{exec}
+    {}
+};
+
+
+/**
+ * Performs the analysis phase of the triangular solve by computing the level
+ * schedule of the triangular part of the matrix. If the schedule does not
+ * expose enough parallelism, solve_struct is reset to nullptr, which makes the
+ * solve kernel use the sequential sweep instead.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void generate_level_schedule(std::shared_ptr<const OmpExecutor> exec,
+                             const matrix::Csr<ValueType, IndexType>* matrix,
+                             std::shared_ptr<solver::SolveStruct>& solve_struct)
+{
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    solve_struct = nullptr;
+    if (num_rows == 0) {
+        return;
+    }
+    auto result = std::make_shared<LevelSolveStruct<IndexType>>(exec);
+    result->diag_idxs.resize_and_reset(num_rows);
+    array<IndexType> levels{exec, static_cast<size_type>(num_rows)};
+    const auto diag_idxs = result->diag_idxs.get_data();
+    const auto row_levels = levels.get_data();
+    IndexType num_levels{};
+    // the level of a row is one more than the maximum level of its
+    // dependencies, which have already been processed in sweep order
+    for (IndexType i = 0; i < num_rows; i++) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        IndexType level{};
+        diag_idxs[row] = -1;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (is_upper ? col > row : col < row) {
+                level = std::max(level, row_levels[col] + 1);
+            } else if (col == row) {
+                diag_idxs[row] = nz;
+            }
+        }
+        row_levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+    if (num_rows / num_levels < trs_min_avg_level_size) {
+        return;
+    }
+    result->level_ptrs.resize_and_reset(num_levels + 1);
+    result->level_rows.resize_and_reset(num_rows);
+    group_by_level(row_levels, num_rows, num_levels,
+                   result->level_ptrs.get_data(),
+                   result->level_rows.get_data());
+    solve_struct = std::move(result);
+}
+
+
+/**
+ * Solves the triangular system level by level, using all threads for the rows
+ * of a single level and synchronizing between two consecutive levels.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void sptrsv_level_scheduled(std::shared_ptr<const OmpExecutor> exec,
+                            const matrix::Csr<ValueType, IndexType>* matrix,
+                            const LevelSolveStruct<IndexType>* solve_struct,
+                            bool unit_diag, const matrix::Dense<ValueType>* b,
+                            matrix::Dense<ValueType>* x)
+{
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    const auto vals = matrix->get_const_values();
+    const auto level_ptrs = solve_struct->level_ptrs.get_const_data();
+    const auto level_rows = solve_struct->level_rows.get_const_data();
+    const auto diag_idxs = solve_struct->diag_idxs.get_const_data();
+    const auto num_levels =
+        static_cast<IndexType>(solve_struct->get_num_levels());
+    const auto num_rhs = b->get_size()[1];
+
+#pragma omp parallel
+    for (IndexType level = 0; level < num_levels; level++) {
+        // the implicit barrier at the end of the loop orders the levels
+#pragma omp for schedule(static)
+        for (IndexType i = level_ptrs[level]; i < level_ptrs[level + 1]; i++) {
+            const auto row = level_rows[i];
+            const auto diag_idx = diag_idxs[row];
+            for (size_type j = 0; j < num_rhs; j++) {
+                auto sum = b->at(row, j);
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    const auto col = col_idxs[nz];
+                    if (is_upper ? col > row : col < row) {
+                        sum -= vals[nz] * x->at(col, j);
+                    }
+                }
+                if (!unit_diag) {
+                    sum /= diag_idx >= 0 ? vals[diag_idx] : one<ValueType>();
+                }
+                x->at(row, j) = sum;
+            }
+        }
+    }
+}
+
+
+}  // namespace
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
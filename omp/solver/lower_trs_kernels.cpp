@@ -20,6 +20,9 @@
 #include <ginkgo/core/solver/triangular.hpp>
 
 
+#include "omp/solver/common_trs_kernels.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -45,9 +48,7 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
               bool unit_diag, const solver::trisolve_algorithm algorithm,
               const size_type num_rhs)
 {
-    // This generate kernel is here to allow for a more sophisticated
-    // implementation as for other executors. This kernel would perform the
-    // "analysis" phase for the triangular matrix.
+    generate_level_schedule<false>(exec, matrix, solve_struct);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -70,6 +71,13 @@ void solve(std::shared_ptr<const OmpExecutor> exec,
     auto col_idxs = matrix->get_const_col_idxs();
     auto vals = matrix->get_const_values();
 
+    if (auto level_struct =
+            dynamic_cast<const LevelSolveStruct<IndexType>*>(solve_struct)) {
+        sptrsv_level_scheduled<false>(exec, matrix, level_struct, unit_diag, b,
+                                   x);
+        return;
+    }
+
 #pragma omp parallel for
     for (size_type j = 0; j < b->get_size()[1]; ++j) {
         for (size_type row = 0; row < matrix->get_size()[0]; ++row) {
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "omp/components/sorting.hpp"
+
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Sorting : public ::testing::Test {
+protected:
+    using index_type = T;
+
+    Sorting() : omp(gko::OmpExecutor::create()), rand_engine(42) {}
+
+    std::vector<index_type> generate_keys(gko::size_type size,
+                                          index_type min_key,
+                                          index_type max_key)
+    {
+        std::uniform_int_distribution<index_type> dist(min_key, max_key);
+        std::vector<index_type> keys(size);
+        for (auto& key : keys) {
+            key = dist(rand_engine);
+        }
+        return keys;
+    }
+
+    std::shared_ptr<const gko::OmpExecutor> omp;
+    std::default_random_engine rand_engine;
+};
+
+TYPED_TEST_SUITE(Sorting, gko::test::IndexTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(Sorting, RadixSortIsEquivalentToStdSort)
+{
+    using index_type = typename TestFixture::index_type;
+    for (gko::size_type size : {0, 1, 100, 100000}) {
+        SCOPED_TRACE(size);
+        auto keys = this->generate_keys(size, -1000000, 1000000);
+        auto expected = keys;
+
+        gko::kernels::omp::radix_sort(this->omp, keys.data(), size);
+
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(keys, expected);
+    }
+}
+
+
+TYPED_TEST(Sorting, RadixSortHandlesFullKeyRange)
+{
+    using index_type = typename TestFixture::index_type;
+    auto keys = this->generate_keys(100000,
+                                    std::numeric_limits<index_type>::min(),
+                                    std::numeric_limits<index_type>::max());
+    auto expected = keys;
+
+    gko::kernels::omp::radix_sort(this->omp, keys.data(), keys.size());
+
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(keys, expected);
+}
+
+
+TYPED_TEST(Sorting, RadixSortByKeyIsStable)
+{
+    using index_type = typename TestFixture::index_type;
+    for (gko::size_type size : {0, 1, 100, 100000}) {
+        SCOPED_TRACE(size);
+        auto keys = this->generate_keys(size, 0, 1000);
+        std::vector<gko::int64> values(size);
+        std::iota(values.begin(), values.end(), 0);
+        std::vector<std::pair<index_type, gko::int64>> expected(size);
+        for (gko::size_type i = 0; i < size; i++) {
+            expected[i] = {keys[i], values[i]};
+        }
+
+        gko::kernels::omp::radix_sort_by_key(this->omp, keys.data(),
+                                             values.data(), size);
+
+        std::stable_sort(
+            expected.begin(), expected.end(),
+            [](auto a, auto b) { return a.first < b.first; });
+        for (gko::size_type i = 0; i < size; i++) {
+            ASSERT_EQ(keys[i], expected[i].first);
+            ASSERT_EQ(values[i], expected[i].second);
+        }
+    }
+}
+
+
+TYPED_TEST(Sorting, ParallelStableSortIsEquivalentToStdStableSort)
+{
+    using index_type = typename TestFixture::index_type;
+    using pair_type = std::pair<index_type, index_type>;
+    const auto comp = [](pair_type a, pair_type b) {
+        return a.first < b.first;
+    };
+    for (gko::size_type size : {0, 1, 100, 100000, 123457}) {
+        SCOPED_TRACE(size);
+        auto keys = this->generate_keys(size, 0, 100);
+        std::vector<pair_type> data(size);
+        for (gko::size_type i = 0; i < size; i++) {
+            data[i] = {keys[i], static_cast<index_type>(i)};
+        }
+        auto expected = data;
+
+        gko::kernels::omp::parallel_stable_sort(this->omp, data.data(), size,
+                                                comp);
+
+        std::stable_sort(expected.begin(), expected.end(), comp);
+        ASSERT_EQ(data, expected);
+    }
+}
+
+
+TYPED_TEST(Sorting, ComputesRowMajorPermutation)
+{
+    using index_type = typename TestFixture::index_type;
+    const gko::size_type size = 100000;
+    auto rows = this->generate_keys(size, 0, 5000);
+    auto cols = this->generate_keys(size, 0, 5000);
+    std::vector<gko::int64> permutation(size);
+    std::vector<gko::int64> expected(size);
+    std::iota(expected.begin(), expected.end(), 0);
+
+    gko::kernels::omp::compute_row_major_permutation(
+        this->omp, rows.data(), cols.data(), size, permutation.data());
+
+    std::stable_sort(expected.begin(), expected.end(), [&](auto a, auto b) {
+        return std::tie(rows[a], cols[a]) < std::tie(rows[b], cols[b]);
+    });
+    ASSERT_EQ(permutation, expected);
+}
+
+
+TYPED_TEST(Sorting, ComputesRowMajorPermutationForLargeIndices)
+{
+    using index_type = typename TestFixture::index_type;
+    const gko::size_type size = 100000;
+    const auto max = std::numeric_limits<index_type>::max();
+    // for 64 bit indices, the linearized index does not fit into 64 bits
+    auto rows = this->generate_keys(size, 0, max);
+    auto cols = this->generate_keys(size, 0, max);
+    // make sure there are some duplicate rows to sort by column
+    std::copy_n(rows.begin(), size / 2, rows.begin() + size / 2);
+    std::vector<gko::int64> permutation(size);
+    std::vector<gko::int64> expected(size);
+    std::iota(expected.begin(), expected.end(), 0);
+
+    gko::kernels::omp::compute_row_major_permutation(
+        this->omp, rows.data(), cols.data(), size, permutation.data());
+
+    std::stable_sort(expected.begin(), expected.end(), [&](auto a, auto b) {
+        return std::tie(rows[a], cols[a]) < std::tie(rows[b], cols[b]);
+    });
+    ASSERT_EQ(permutation, expected);
+}
+
+
+}  // namespace
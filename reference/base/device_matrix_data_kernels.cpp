@@ -6,11 +6,13 @@
 
 
 #include <algorithm>
+#include <tuple>
 
 
 #include <ginkgo/core/base/math.hpp>
 
 
+#include "core/base/iterator_factory.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
 
 
@@ -149,6 +151,25 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void sort_and_sum_duplicates(std::shared_ptr<const DefaultExecutor> exec,
+                             size_type num_rows, array<ValueType>& values,
+                             array<IndexType>& row_idxs,
+                             array<IndexType>& col_idxs)
+{
+    auto it = detail::make_zip_iterator(row_idxs.get_data(),
+                                        col_idxs.get_data(), values.get_data());
+    std::stable_sort(it, it + values.get_size(), [](auto a, auto b) {
+        return std::tie(std::get<0>(a), std::get<1>(a)) <
+               std::tie(std::get<0>(b), std::get<1>(b));
+    });
+    sum_duplicates(exec, num_rows, values, row_idxs, col_idxs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_AND_SUM_DUPLICATES_KERNEL);
+
+
 }  // namespace components
 }  // namespace reference
 }  // namespace kernels
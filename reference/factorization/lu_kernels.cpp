@@ -69,6 +69,7 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
                const IndexType* lookup_offsets, const int64* lookup_descs,
                const int32* lookup_storage, const IndexType* diag_idxs,
                matrix::Csr<ValueType, IndexType>* factors,
+               experimental::factorization::numeric_type algorithm,
                array<int>& tmp_storage)
 {
     const auto num_rows = factors->get_size()[0];
@@ -301,6 +301,54 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_CSR_ADVANCED_SPGEMM_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void spgemm_numeric(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* a,
+                    const matrix::Csr<ValueType, IndexType>* b,
+                    const IndexType* storage_offsets, const int64* row_desc,
+                    const int32* storage, matrix::Csr<ValueType, IndexType>* c,
+                    size_type& num_missing)
+{
+    const auto num_rows = a->get_size()[0];
+    const auto a_row_ptrs = a->get_const_row_ptrs();
+    const auto a_col_idxs = a->get_const_col_idxs();
+    const auto a_vals = a->get_const_values();
+    const auto b_row_ptrs = b->get_const_row_ptrs();
+    const auto b_col_idxs = b->get_const_col_idxs();
+    const auto b_vals = b->get_const_values();
+    const auto c_row_ptrs = c->get_const_row_ptrs();
+    const auto c_col_idxs = c->get_const_col_idxs();
+    const auto c_vals = c->get_values();
+    num_missing = 0;
+    for (size_type row = 0; row < num_rows; row++) {
+        gko::matrix::csr::device_sparsity_lookup<IndexType> lookup{
+            c_row_ptrs, c_col_idxs, storage_offsets,
+            storage,    row_desc,   row};
+        const auto c_begin = c_row_ptrs[row];
+        const auto c_end = c_row_ptrs[row + 1];
+        std::fill(c_vals + c_begin, c_vals + c_end, zero<ValueType>());
+        for (auto a_nz = a_row_ptrs[row]; a_nz < a_row_ptrs[row + 1]; a_nz++) {
+            const auto a_val = a_vals[a_nz];
+            const auto b_row = a_col_idxs[a_nz];
+            for (auto b_nz = b_row_ptrs[b_row]; b_nz < b_row_ptrs[b_row + 1];
+                 b_nz++) {
+                const auto c_nz = c_begin == c_end
+                                      ? invalid_index<IndexType>()
+                                      : lookup[b_col_idxs[b_nz]];
+                if (c_nz == invalid_index<IndexType>()) {
+                    num_missing++;
+                } else {
+                    c_vals[c_begin + c_nz] += a_val * b_vals[b_nz];
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_SPGEMM_NUMERIC_KERNEL);
+
+
 template <typename ValueType, typename IndexType>
 void spgeam(std::shared_ptr<const ReferenceExecutor> exec,
             const matrix::Dense<ValueType>* alpha,
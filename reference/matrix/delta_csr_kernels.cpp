@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/mixed_precision_types.hpp"
+#include "core/matrix/delta_csr_codec.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The delta-compressed sparse row matrix format namespace.
+ * @ref DeltaCsr
+ * @ingroup delta_csr
+ */
+namespace delta_csr {
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::DeltaCsr<MatrixValueType, IndexType>* a,
+          const matrix::Dense<InputValueType>* b,
+          matrix::Dense<OutputValueType>* c)
+{
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto row_bases = a->get_const_row_bases();
+    const auto idx_ptrs = a->get_const_compressed_idx_ptrs();
+    const auto idxs = a->get_const_compressed_idxs();
+    const auto vals = a->get_const_values();
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            auto temp_val = gko::zero<arithmetic_type>();
+            matrix::delta_csr::for_each_entry(
+                row_ptrs, row_bases, idx_ptrs, idxs, row,
+                [&](IndexType nz, IndexType col) {
+                    temp_val += static_cast<arithmetic_type>(vals[nz]) *
+                                static_cast<arithmetic_type>(b->at(col, j));
+                });
+            c->at(row, j) = static_cast<OutputValueType>(temp_val);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_SPMV_KERNEL);
+
+
+template <typename MatrixValueType, typename InputValueType,
+          typename OutputValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<MatrixValueType>* alpha,
+                   const matrix::DeltaCsr<MatrixValueType, IndexType>* a,
+                   const matrix::Dense<InputValueType>* b,
+                   const matrix::Dense<OutputValueType>* beta,
+                   matrix::Dense<OutputValueType>* c)
+{
+    using arithmetic_type =
+        highest_precision<InputValueType, OutputValueType, MatrixValueType>;
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto row_bases = a->get_const_row_bases();
+    const auto idx_ptrs = a->get_const_compressed_idx_ptrs();
+    const auto idxs = a->get_const_compressed_idxs();
+    const auto vals = a->get_const_values();
+    const auto valpha = static_cast<arithmetic_type>(alpha->at(0, 0));
+    const auto vbeta = static_cast<arithmetic_type>(beta->at(0, 0));
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            auto temp_val = gko::zero<arithmetic_type>();
+            matrix::delta_csr::for_each_entry(
+                row_ptrs, row_bases, idx_ptrs, idxs, row,
+                [&](IndexType nz, IndexType col) {
+                    temp_val += static_cast<arithmetic_type>(vals[nz]) *
+                                static_cast<arithmetic_type>(b->at(col, j));
+                });
+            c->at(row, j) = static_cast<OutputValueType>(
+                vbeta * static_cast<arithmetic_type>(c->at(row, j)) +
+                valpha * temp_val);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename IndexType>
+void compute_compressed_sizes(std::shared_ptr<const ReferenceExecutor> exec,
+                              size_type num_rows, const IndexType* row_ptrs,
+                              const IndexType* col_idxs, IndexType* row_bases,
+                              int64* compressed_sizes)
+{
+    for (size_type row = 0; row < num_rows; ++row) {
+        compressed_sizes[row] = matrix::delta_csr::compute_row_size(
+            col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1],
+            row_bases[row]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_COMPUTE_COMPRESSED_SIZES_KERNEL);
+
+
+template <typename IndexType>
+void compress_idxs(std::shared_ptr<const ReferenceExecutor> exec,
+                   size_type num_rows, const IndexType* row_ptrs,
+                   const IndexType* col_idxs, const IndexType* row_bases,
+                   const int64* compressed_idx_ptrs, uint8* compressed_idxs)
+{
+    for (size_type row = 0; row < num_rows; ++row) {
+        const auto begin = row_ptrs[row];
+        const auto end = row_ptrs[row + 1];
+        if (begin == end) {
+            continue;
+        }
+        const auto width =
+            (compressed_idx_ptrs[row + 1] - compressed_idx_ptrs[row]) /
+            (end - begin);
+        matrix::delta_csr::encode_row(
+            col_idxs + begin, col_idxs + end, row_bases[row], width,
+            compressed_idxs + compressed_idx_ptrs[row]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_DELTA_CSR_COMPRESS_IDXS_KERNEL);
+
+
+template <typename IndexType>
+void decompress_idxs(std::shared_ptr<const ReferenceExecutor> exec,
+                     size_type num_rows, const IndexType* row_ptrs,
+                     const IndexType* row_bases,
+                     const int64* compressed_idx_ptrs,
+                     const uint8* compressed_idxs, IndexType* col_idxs)
+{
+    for (size_type row = 0; row < num_rows; ++row) {
+        matrix::delta_csr::for_each_entry(
+            row_ptrs, row_bases, compressed_idx_ptrs, compressed_idxs, row,
+            [&](IndexType nz, IndexType col) { col_idxs[nz] = col; });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_DELTA_CSR_DECOMPRESS_IDXS_KERNEL);
+
+
+}  // namespace delta_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -320,6 +320,32 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 
 
+template <typename LocalIndexType, typename GlobalIndexType>
+void map_to_global(std::shared_ptr<const DefaultExecutor> exec, size_type num,
+                   GlobalIndexType offset, const LocalIndexType* local_idxs,
+                   GlobalIndexType* global_idxs)
+{
+    for (size_type i = 0; i < num; i++) {
+        global_idxs[i] = offset + static_cast<GlobalIndexType>(local_idxs[i]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(GKO_DECLARE_PGM_MAP_TO_GLOBAL);
+
+
+template <typename LocalIndexType, typename GlobalIndexType>
+void gather_index(std::shared_ptr<const DefaultExecutor> exec, size_type num,
+                  const GlobalIndexType* orig, const LocalIndexType* gather_map,
+                  GlobalIndexType* result)
+{
+    for (size_type i = 0; i < num; i++) {
+        result[i] = orig[gather_map[i]];
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(GKO_DECLARE_PGM_GATHER_INDEX);
+
+
 }  // namespace pgm
 }  // namespace reference
 }  // namespace kernels
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/nested_dissection_kernels.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/reorder/amd_kernels.hpp"
+#include "core/reorder/graph_bisection.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The nested dissection reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace nested_dissection {
+
+
+// Subgraphs with at most this many nodes are ordered using AMD.
+constexpr int max_leaf_size = 120;
+
+
+using experimental::reorder::bisection::node_part;
+
+
+/**
+ * Orders the nodes of a subgraph by recursively ordering the two parts
+ * separated by a vertex separator, followed by the separator itself.
+ * The resulting ordering is a postorder of the separator tree, so the
+ * elimination tree of the permuted matrix contains independent subtrees for
+ * both parts.
+ *
+ * @param node_ids  the original node ID of every node in the subgraph.
+ * @param permutation  the output array, it receives the original node IDs in
+ *                     elimination order.
+ */
+template <typename IndexType>
+void dissect(std::shared_ptr<const DefaultExecutor> exec, IndexType num_nodes,
+             const IndexType* row_ptrs, const IndexType* col_idxs,
+             const IndexType* node_ids, IndexType* permutation)
+{
+    vector<uint8> parts(num_nodes, exec);
+    IndexType part_sizes[3]{};
+    if (num_nodes > max_leaf_size) {
+        experimental::reorder::bisection::compute_separator(
+            exec, num_nodes, row_ptrs, col_idxs, parts.data());
+        for (const auto part : parts) {
+            part_sizes[part]++;
+        }
+    }
+    if (part_sizes[0] == 0 || part_sizes[1] == 0) {
+        vector<IndexType> local_permutation(num_nodes, exec);
+        amd::compute_permutation(exec, num_nodes, row_ptrs, col_idxs,
+                                 local_permutation.data());
+        for (IndexType i = 0; i < num_nodes; i++) {
+            permutation[i] = node_ids[local_permutation[i]];
+        }
+        return;
+    }
+    vector<IndexType> sub_row_ptrs(exec);
+    vector<IndexType> sub_col_idxs(exec);
+    vector<IndexType> sub_node_ids(exec);
+    auto sub_permutation = permutation;
+    for (const auto part : {node_part::left, node_part::right}) {
+        experimental::reorder::bisection::extract_subgraph(
+            exec, num_nodes, row_ptrs, col_idxs, node_ids, parts.data(), part,
+            sub_row_ptrs, sub_col_idxs, sub_node_ids);
+        const auto sub_size = static_cast<IndexType>(sub_node_ids.size());
+        dissect(exec, sub_size, sub_row_ptrs.data(), sub_col_idxs.data(),
+                sub_node_ids.data(), sub_permutation);
+        sub_permutation += sub_size;
+    }
+    for (IndexType node = 0; node < num_nodes; node++) {
+        if (parts[node] == static_cast<uint8>(node_part::separator)) {
+            *sub_permutation = node_ids[node];
+            sub_permutation++;
+        }
+    }
+}
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,
+                         IndexType num_rows, const IndexType* row_ptrs,
+                         const IndexType* col_idxs, IndexType* permutation)
+{
+    vector<IndexType> node_ids(num_rows, exec);
+    std::iota(node_ids.begin(), node_ids.end(), IndexType{});
+    dissect(exec, num_rows, row_ptrs, col_idxs, node_ids.data(), permutation);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_NESTED_DISSECTION_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
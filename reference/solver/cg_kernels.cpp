@@ -97,6 +97,61 @@ void step_2(std::shared_ptr<const ReferenceExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void gather_columns(std::shared_ptr<const ReferenceExecutor> exec,
+                    const array<size_type>& columns,
+                    const matrix::Dense<ValueType>* orig,
+                    matrix::Dense<ValueType>* gathered)
+{
+    for (size_type i = 0; i < gathered->get_size()[0]; ++i) {
+        for (size_type j = 0; j < gathered->get_size()[1]; ++j) {
+            gathered->at(i, j) = orig->at(i, columns.get_const_data()[j]);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_GATHER_COLUMNS_KERNEL);
+
+
+template <typename ValueType>
+void scatter_columns(std::shared_ptr<const ReferenceExecutor> exec,
+                     const array<size_type>& columns,
+                     const matrix::Dense<ValueType>* gathered,
+                     matrix::Dense<ValueType>* orig)
+{
+    for (size_type i = 0; i < gathered->get_size()[0]; ++i) {
+        for (size_type j = 0; j < gathered->get_size()[1]; ++j) {
+            orig->at(i, columns.get_const_data()[j]) = gathered->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_SCATTER_COLUMNS_KERNEL);
+
+
+template <typename ValueType>
+void block_conj_dot(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Dense<ValueType>* x,
+                    const matrix::Dense<ValueType>* y,
+                    matrix::Dense<ValueType>* result, array<char>& tmp)
+{
+    for (size_type i = 0; i < result->get_size()[0]; ++i) {
+        for (size_type j = 0; j < result->get_size()[1]; ++j) {
+            result->at(i, j) = zero<ValueType>();
+        }
+    }
+    for (size_type row = 0; row < x->get_size()[0]; ++row) {
+        for (size_type i = 0; i < x->get_size()[1]; ++i) {
+            for (size_type j = 0; j < y->get_size()[1]; ++j) {
+                result->at(i, j) += conj(x->at(row, i)) * y->at(row, j);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_BLOCK_CONJ_DOT_KERNEL);
+
+
 }  // namespace cg
 }  // namespace reference
 }  // namespace kernels
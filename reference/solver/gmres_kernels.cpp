@@ -73,6 +73,49 @@ void multi_axpy(std::shared_ptr<const ReferenceExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL);
 
 
+template <typename ValueType>
+void multi_dot(std::shared_ptr<const ReferenceExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               const matrix::Dense<ValueType>* next_krylov,
+               matrix::Dense<ValueType>* hessenberg_col, array<char>&)
+{
+    const auto num_rows = next_krylov->get_size()[0];
+    for (size_type i = 0; i < hessenberg_col->get_size()[0]; ++i) {
+        for (size_type k = 0; k < next_krylov->get_size()[1]; ++k) {
+            auto value = zero<ValueType>();
+            for (size_type row = 0; row < num_rows; ++row) {
+                value += conj(krylov_bases->at(row + i * num_rows, k)) *
+                         next_krylov->at(row, k);
+            }
+            hessenberg_col->at(i, k) = value;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
+
+
+template <typename ValueType>
+void multi_sub(std::shared_ptr<const ReferenceExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               const matrix::Dense<ValueType>* hessenberg_col,
+               matrix::Dense<ValueType>* next_krylov)
+{
+    const auto num_rows = next_krylov->get_size()[0];
+    for (size_type i = 0; i < hessenberg_col->get_size()[0]; ++i) {
+        for (size_type row = 0; row < num_rows; ++row) {
+            for (size_type k = 0; k < next_krylov->get_size()[1]; ++k) {
+                next_krylov->at(row, k) -=
+                    hessenberg_col->at(i, k) *
+                    krylov_bases->at(row + i * num_rows, k);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_SUB_KERNEL);
+
+
 }  // namespace gmres
 }  // namespace reference
 }  // namespace kernels
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The pipelined CG solver namespace.
+ *
+ * @ingroup pipe_cg
+ */
+namespace pipe_cg {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* z, matrix::Dense<ValueType>* w,
+                matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* s,
+                matrix::Dense<ValueType>* prev_rho_delta,
+                matrix::Dense<ValueType>* prev_alpha,
+                array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        prev_rho_delta->at(j) = one<ValueType>();
+        prev_alpha->at(j) = zero<ValueType>();
+        stop_status->get_data()[j].reset();
+    }
+    for (size_type i = 0; i < b->get_size()[0]; ++i) {
+        for (size_type j = 0; j < b->get_size()[1]; ++j) {
+            r->at(i, j) = b->at(i, j);
+            z->at(i, j) = w->at(i, j) = p->at(i, j) = s->at(i, j) =
+                zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void compute_dots(std::shared_ptr<const ReferenceExecutor> exec,
+                  const matrix::Dense<ValueType>* r,
+                  const matrix::Dense<ValueType>* z,
+                  const matrix::Dense<ValueType>* w,
+                  matrix::Dense<ValueType>* rho_delta, array<char>&)
+{
+    const auto num_rhs = r->get_size()[1];
+    for (size_type j = 0; j < num_rhs; ++j) {
+        rho_delta->at(j) = zero<ValueType>();
+        rho_delta->at(j + num_rhs) = zero<ValueType>();
+    }
+    for (size_type i = 0; i < r->get_size()[0]; ++i) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            rho_delta->at(j) += conj(r->at(i, j)) * z->at(i, j);
+            rho_delta->at(j + num_rhs) += conj(z->at(i, j)) * w->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_COMPUTE_DOTS_KERNEL);
+
+
+template <typename ValueType>
+void step(std::shared_ptr<const ReferenceExecutor> exec,
+          matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+          matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* s,
+          const matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* w,
+          const matrix::Dense<ValueType>* rho_delta,
+          const matrix::Dense<ValueType>* prev_rho_delta,
+          const matrix::Dense<ValueType>* prev_alpha,
+          matrix::Dense<ValueType>* alpha,
+          const array<stopping_status>* stop_status)
+{
+    const auto num_rhs = x->get_size()[1];
+    for (size_type j = 0; j < num_rhs; ++j) {
+        const auto rho = rho_delta->at(j);
+        const auto delta = rho_delta->at(j + num_rhs);
+        const auto beta = prev_rho_delta->at(j) != zero<ValueType>()
+                              ? rho / prev_rho_delta->at(j)
+                              : zero<ValueType>();
+        const auto tmp = prev_alpha->at(j) != zero<ValueType>()
+                             ? beta * (rho / prev_alpha->at(j))
+                             : zero<ValueType>();
+        alpha->at(j) =
+            delta - tmp != zero<ValueType>() ? rho / (delta - tmp)
+                                             : zero<ValueType>();
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            const auto beta = prev_rho_delta->at(j) != zero<ValueType>()
+                                  ? rho_delta->at(j) / prev_rho_delta->at(j)
+                                  : zero<ValueType>();
+            p->at(i, j) = z->at(i, j) + beta * p->at(i, j);
+            s->at(i, j) = w->at(i, j) + beta * s->at(i, j);
+            x->at(i, j) += alpha->at(j) * p->at(i, j);
+            r->at(i, j) -= alpha->at(j) * s->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_KERNEL);
+
+
+}  // namespace pipe_cg
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
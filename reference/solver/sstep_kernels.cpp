@@ -0,0 +1,290 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/sstep_kernels.hpp"
+
+
+#include <limits>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The s-step Krylov solver namespace.
+ *
+ * @ingroup sstep
+ */
+namespace sstep {
+namespace {
+
+
+// computes u^H G v with G(i, j) = gram(i * m + j, col)
+template <typename ValueType>
+ValueType quadratic_form(const matrix::Dense<ValueType>* gram,
+                         const matrix::Dense<ValueType>* coeffs, size_type col,
+                         size_type m, size_type u, size_type v)
+{
+    auto result = zero<ValueType>();
+    for (size_type i = 0; i < m; ++i) {
+        auto row_result = zero<ValueType>();
+        for (size_type j = 0; j < m; ++j) {
+            row_result += gram->at(i * m + j, col) * coeffs->at(v + j, col);
+        }
+        result += conj(coeffs->at(u + i, col)) * row_result;
+    }
+    return result;
+}
+
+
+// checks whether the value of u^H G u computed by quadratic_form is dominated
+// by rounding errors, i.e. below the rounding error bound of the sum
+template <typename ValueType>
+bool is_rounding_error(const matrix::Dense<ValueType>* gram,
+                       const matrix::Dense<ValueType>* coeffs, size_type col,
+                       size_type m, size_type u, ValueType value)
+{
+    auto bound = zero<remove_complex<ValueType>>();
+    for (size_type i = 0; i < m; ++i) {
+        for (size_type j = 0; j < m; ++j) {
+            bound += abs(coeffs->at(u + i, col)) * abs(gram->at(i * m + j, col)) *
+                     abs(coeffs->at(u + j, col));
+        }
+    }
+    return abs(value) <=
+           m * std::numeric_limits<remove_complex<ValueType>>::epsilon() *
+               bound;
+}
+
+
+// computes g^T v with g(j) = gram(m * m + j, col)
+template <typename ValueType>
+ValueType shadow_dot(const matrix::Dense<ValueType>* gram,
+                     const matrix::Dense<ValueType>* coeffs, size_type col,
+                     size_type m, size_type v)
+{
+    auto result = zero<ValueType>();
+    for (size_type j = 0; j < m; ++j) {
+        result += gram->at(m * m + j, col) * coeffs->at(v + j, col);
+    }
+    return result;
+}
+
+
+// shifts the coefficients within the basis parts starting at 0 and split
+template <typename ValueType>
+void shift(matrix::Dense<ValueType>* coeffs, size_type col, size_type m,
+           size_type split, size_type in, size_type out)
+{
+    for (size_type i = 0; i < m; ++i) {
+        coeffs->at(out + i, col) = i == 0 || i == split
+                                       ? zero<ValueType>()
+                                       : coeffs->at(in + i - 1, col);
+    }
+}
+
+
+}  // anonymous namespace
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        stop_status->get_data()[j].reset();
+    }
+    for (size_type i = 0; i < b->get_size()[0]; ++i) {
+        for (size_type j = 0; j < b->get_size()[1]; ++j) {
+            r->at(i, j) = b->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void compute_gram(std::shared_ptr<const ReferenceExecutor> exec,
+                  size_type num_rows, const matrix::Dense<ValueType>* left,
+                  const matrix::Dense<ValueType>* right,
+                  matrix::Dense<ValueType>* gram, array<char>&)
+{
+    const auto num_rhs = gram->get_size()[1];
+    const auto num_right =
+        num_rows == 0 ? size_type{} : right->get_size()[0] / num_rows;
+    for (size_type block = 0; block < gram->get_size()[0]; ++block) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            auto value = zero<ValueType>();
+            for (size_type row = 0; row < num_rows; ++row) {
+                const auto left_row = block / num_right * num_rows + row;
+                const auto right_row = block % num_right * num_rows + row;
+                value += conj(left->at(left_row, j)) * right->at(right_row, j);
+            }
+            gram->at(block, j) = value;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_COMPUTE_GRAM_KERNEL);
+
+
+template <typename ValueType>
+void cg_coefficients(std::shared_ptr<const ReferenceExecutor> exec,
+                     size_type steps, const matrix::Dense<ValueType>* gram,
+                     matrix::Dense<ValueType>* coeffs,
+                     matrix::Dense<ValueType>* rho)
+{
+    const auto m = 2 * steps + 1;
+    // coordinates of x, p, r and A p
+    const auto cx = size_type{};
+    const auto cp = m;
+    const auto cr = 2 * m;
+    const auto cw = 3 * m;
+    for (size_type j = 0; j < gram->get_size()[1]; ++j) {
+        for (size_type i = 0; i < 4 * m; ++i) {
+            coeffs->at(i, j) = zero<ValueType>();
+        }
+        coeffs->at(cp, j) = one<ValueType>();
+        coeffs->at(cr + steps + 1, j) = one<ValueType>();
+        auto cur_rho = quadratic_form(gram, coeffs, j, m, cr, cr);
+        rho->at(j) = cur_rho;
+        for (size_type step = 0; step < steps; ++step) {
+            shift(coeffs, j, m, steps + 1, cp, cw);
+            const auto alpha = safe_divide(
+                cur_rho, quadratic_form(gram, coeffs, j, m, cp, cw));
+            for (size_type i = 0; i < m; ++i) {
+                coeffs->at(cx + i, j) += alpha * coeffs->at(cp + i, j);
+                coeffs->at(cr + i, j) -= alpha * coeffs->at(cw + i, j);
+            }
+            const auto new_rho = quadratic_form(gram, coeffs, j, m, cr, cr);
+            if (is_rounding_error(gram, coeffs, j, m, cr, new_rho)) {
+                // the remaining inner products are dominated by rounding
+                // errors, so restart from the residual in the next basis
+                for (size_type i = 0; i < m; ++i) {
+                    coeffs->at(cp + i, j) = coeffs->at(cr + i, j);
+                }
+                break;
+            }
+            const auto beta = safe_divide(new_rho, cur_rho);
+            for (size_type i = 0; i < m; ++i) {
+                coeffs->at(cp + i, j) =
+                    coeffs->at(cr + i, j) + beta * coeffs->at(cp + i, j);
+            }
+            cur_rho = new_rho;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_CG_COEFFICIENTS_KERNEL);
+
+
+template <typename ValueType>
+void bicgstab_coefficients(std::shared_ptr<const ReferenceExecutor> exec,
+                           size_type steps,
+                           const matrix::Dense<ValueType>* gram,
+                           matrix::Dense<ValueType>* coeffs)
+{
+    const auto m = 4 * steps + 1;
+    const auto split = 2 * steps + 1;
+    // coordinates of x, p, r (and s), A p and A s
+    const auto cx = size_type{};
+    const auto cp = m;
+    const auto cr = 2 * m;
+    const auto cv = 3 * m;
+    const auto ct = 4 * m;
+    for (size_type j = 0; j < gram->get_size()[1]; ++j) {
+        for (size_type i = 0; i < 5 * m; ++i) {
+            coeffs->at(i, j) = zero<ValueType>();
+        }
+        coeffs->at(cp, j) = one<ValueType>();
+        coeffs->at(cr + split, j) = one<ValueType>();
+        auto rho = shadow_dot(gram, coeffs, j, m, cr);
+        for (size_type step = 0; step < steps; ++step) {
+            shift(coeffs, j, m, split, cp, cv);
+            const auto alpha =
+                safe_divide(rho, shadow_dot(gram, coeffs, j, m, cv));
+            // s = r - alpha * A p
+            for (size_type i = 0; i < m; ++i) {
+                coeffs->at(cr + i, j) -= alpha * coeffs->at(cv + i, j);
+            }
+            if (is_rounding_error(gram, coeffs, j, m, cr,
+                                  quadratic_form(gram, coeffs, j, m, cr, cr))) {
+                // the remaining inner products are dominated by rounding
+                // errors, so restart from the residual in the next basis
+                for (size_type i = 0; i < m; ++i) {
+                    coeffs->at(cx + i, j) += alpha * coeffs->at(cp + i, j);
+                    coeffs->at(cp + i, j) = coeffs->at(cr + i, j);
+                }
+                break;
+            }
+            shift(coeffs, j, m, split, cr, ct);
+            const auto omega =
+                safe_divide(quadratic_form(gram, coeffs, j, m, ct, cr),
+                            quadratic_form(gram, coeffs, j, m, ct, ct));
+            for (size_type i = 0; i < m; ++i) {
+                coeffs->at(cx + i, j) += alpha * coeffs->at(cp + i, j) +
+                                         omega * coeffs->at(cr + i, j);
+                coeffs->at(cr + i, j) -= omega * coeffs->at(ct + i, j);
+            }
+            if (is_rounding_error(gram, coeffs, j, m, cr,
+                                  quadratic_form(gram, coeffs, j, m, cr, cr))) {
+                for (size_type i = 0; i < m; ++i) {
+                    coeffs->at(cp + i, j) = coeffs->at(cr + i, j);
+                }
+                break;
+            }
+            const auto new_rho = shadow_dot(gram, coeffs, j, m, cr);
+            const auto beta =
+                safe_divide(new_rho, rho) * safe_divide(alpha, omega);
+            for (size_type i = 0; i < m; ++i) {
+                coeffs->at(cp + i, j) =
+                    coeffs->at(cr + i, j) +
+                    beta * (coeffs->at(cp + i, j) -
+                            omega * coeffs->at(cv + i, j));
+            }
+            rho = new_rho;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_SSTEP_BICGSTAB_COEFFICIENTS_KERNEL);
+
+
+template <typename ValueType>
+void combine_basis(std::shared_ptr<const ReferenceExecutor> exec,
+                   size_type num_rows, const matrix::Dense<ValueType>* basis,
+                   const matrix::Dense<ValueType>* coeffs,
+                   matrix::Dense<ValueType>* result, bool accumulate,
+                   const array<stopping_status>* stop_status)
+{
+    for (size_type i = 0; i < result->get_size()[0]; ++i) {
+        for (size_type j = 0; j < result->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            auto value = accumulate ? result->at(i, j) : zero<ValueType>();
+            for (size_type k = 0; k < coeffs->get_size()[0]; ++k) {
+                value += basis->at(k * num_rows + i, j) * coeffs->at(k, j);
+            }
+            result->at(i, j) = value;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_SSTEP_COMBINE_BASIS_KERNEL);
+
+
+}  // namespace sstep
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
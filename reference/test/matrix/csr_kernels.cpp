@@ -691,6 +691,53 @@ TYPED_TEST(Csr, AppliesToCsrMatrix)
 }
 
 
+TYPED_TEST(Csr, MultipliesWithReuse)
+{
+    using T = typename TestFixture::value_type;
+    auto mtx = this->mtx->clone();
+
+    auto result = mtx->multiply_reuse(this->mtx3_unsorted);
+    auto& product = result.first;
+    const auto& reuse_info = result.second;
+
+    GKO_ASSERT_MTX_NEAR(product, l({{13.0, 5.0, 31.0}, {15.0, 5.0, 40.0}}),
+                        0.0);
+    ASSERT_TRUE(product->is_sorted_by_column_index());
+    for (gko::size_type i = 0; i < mtx->get_num_stored_elements(); i++) {
+        mtx->get_values()[i] *= T{2.0};
+    }
+    reuse_info.update_values(mtx, this->mtx3_unsorted, product);
+    GKO_ASSERT_MTX_NEAR(product, l({{26.0, 10.0, 62.0}, {30.0, 10.0, 80.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(Csr, MultiplyReuseUpdateThrowsOnDimensionMismatch)
+{
+    auto result = this->mtx->multiply_reuse(this->mtx3_unsorted);
+
+    ASSERT_THROW(
+        result.second.update_values(this->mtx, this->mtx, result.first),
+        gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Csr, MultiplyReuseUpdateThrowsOnPatternMismatch)
+{
+    using T = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    auto identity = gko::initialize<Mtx>({I<T>{1.0, 0.0}, I<T>{0.0, 1.0}},
+                                         this->exec);
+    auto swap = gko::initialize<Mtx>({I<T>{0.0, 1.0}, I<T>{1.0, 0.0}},
+                                     this->exec);
+    auto result = identity->multiply_reuse(identity);
+
+    // same sizes and number of nonzeros, but a different product pattern
+    ASSERT_THROW(result.second.update_values(identity, swap, result.first),
+                 gko::ValueMismatch);
+}
+
+
 TYPED_TEST(Csr, AppliesLinearCombinationToCsrMatrix)
 {
     using Vec = typename TestFixture::Vec;
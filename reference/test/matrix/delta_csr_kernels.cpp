@@ -0,0 +1,284 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/delta_csr.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/delta_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class DeltaCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using mat_data = gko::matrix_data<value_type, index_type>;
+
+    DeltaCsr()
+        : exec(gko::ReferenceExecutor::create()), mtx(Mtx::create(exec))
+    {
+        /*
+         * 1   3   2
+         * 0   5   0
+         */
+        mtx->read(mat_data{gko::dim<2>{2, 3},
+                           {{0, 0, 1.0},
+                            {0, 1, 3.0},
+                            {0, 2, 2.0},
+                            {1, 1, 5.0}}});
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(DeltaCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(DeltaCsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx->apply(x, y);
+
+    EXPECT_EQ(y->at(0), T{13.0});
+    EXPECT_EQ(y->at(1), T{5.0});
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesToMixedDenseVector)
+{
+    using T = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<T>;
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2, 1});
+
+    this->mtx->apply(x, y);
+
+    EXPECT_EQ(y->at(0), T{13.0});
+    EXPECT_EQ(y->at(1), T{5.0});
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0}, I<T>{1.0, -1.5}, I<T>{4.0, 2.5}}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{2});
+
+    this->mtx->apply(x, y);
+
+    EXPECT_EQ(y->at(0, 0), T{13.0});
+    EXPECT_EQ(y->at(1, 0), T{5.0});
+    EXPECT_EQ(y->at(0, 1), T{3.5});
+    EXPECT_EQ(y->at(1, 1), T{-7.5});
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0}, this->exec);
+
+    this->mtx->apply(alpha, x, beta, y);
+
+    EXPECT_EQ(y->at(0), T{-11.0});
+    EXPECT_EQ(y->at(1), T{-1.0});
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesLinearCombinationToMixedDenseVector)
+{
+    using T = gko::next_precision<typename TestFixture::value_type>;
+    using Vec = gko::matrix::Dense<T>;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0}, this->exec);
+
+    this->mtx->apply(alpha, x, beta, y);
+
+    EXPECT_EQ(y->at(0), T{-11.0});
+    EXPECT_EQ(y->at(1), T{-1.0});
+}
+
+
+TYPED_TEST(DeltaCsr, ApplyFailsOnWrongInnerDimension)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = Vec::create(this->exec, gko::dim<2>{2});
+    auto y = Vec::create(this->exec, gko::dim<2>{2});
+
+    ASSERT_THROW(this->mtx->apply(x, y), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(DeltaCsr, UsesSmallestDeltaWidthPerRow)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mat_data = typename TestFixture::mat_data;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Mtx::create(this->exec);
+
+    mtx->read(mat_data{gko::dim<2>{3, 100000},
+                       {{0, 10, 1.0},
+                        {0, 265, 2.0},
+                        {1, 10, 3.0},
+                        {1, 266, 4.0},
+                        {2, 5, 5.0},
+                        {2, 99999, 6.0}}});
+
+    auto ptrs = mtx->get_const_compressed_idx_ptrs();
+    auto bases = mtx->get_const_row_bases();
+    EXPECT_EQ(ptrs[0], 0);
+    EXPECT_EQ(ptrs[1], 2);
+    EXPECT_EQ(ptrs[2], 6);
+    EXPECT_EQ(ptrs[3], 6 + 2 * sizeof(index_type));
+    EXPECT_EQ(bases[0], 10);
+    EXPECT_EQ(bases[1], 10);
+    EXPECT_EQ(bases[2], 5);
+}
+
+
+TYPED_TEST(DeltaCsr, AppliesWithAllDeltaWidths)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using mat_data = typename TestFixture::mat_data;
+    using T = typename TestFixture::value_type;
+    auto mtx = Mtx::create(this->exec);
+    mtx->read(mat_data{gko::dim<2>{4, 100000},
+                       {{0, 10, 1.0},
+                        {0, 265, 2.0},
+                        {1, 10, 3.0},
+                        {1, 266, 4.0},
+                        {3, 5, 5.0},
+                        {3, 99999, 6.0}}});
+    auto x = Vec::create(this->exec, gko::dim<2>{100000, 1});
+    x->fill(gko::zero<T>());
+    x->at(5) = 1.0;
+    x->at(10) = 2.0;
+    x->at(265) = 3.0;
+    x->at(266) = 4.0;
+    x->at(99999) = 5.0;
+    auto y = Vec::create(this->exec, gko::dim<2>{4, 1});
+
+    mtx->apply(x, y);
+
+    EXPECT_EQ(y->at(0), T{8.0});
+    EXPECT_EQ(y->at(1), T{22.0});
+    EXPECT_EQ(y->at(2), T{0.0});
+    EXPECT_EQ(y->at(3), T{35.0});
+}
+
+
+TYPED_TEST(DeltaCsr, KeepsUnsortedColumnOrder)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    auto csr = Csr::create(this->exec, gko::dim<2>{2, 600}, 4);
+    auto r = csr->get_row_ptrs();
+    auto c = csr->get_col_idxs();
+    auto v = csr->get_values();
+    r[0] = 0;
+    r[1] = 3;
+    r[2] = 4;
+    c[0] = 512;
+    c[1] = 7;
+    c[2] = 300;
+    c[3] = 4;
+    v[0] = 1.0;
+    v[1] = 2.0;
+    v[2] = 3.0;
+    v[3] = 4.0;
+    auto mtx = Mtx::create(this->exec);
+    auto result = Csr::create(this->exec);
+
+    csr->convert_to(mtx);
+    mtx->convert_to(result);
+
+    EXPECT_EQ(mtx->get_const_row_bases()[0], 7);
+    EXPECT_EQ(mtx->get_const_row_bases()[1], 4);
+    GKO_ASSERT_MTX_NEAR(result, csr, 0.0);
+    EXPECT_EQ(result->get_const_col_idxs()[0], 512);
+    EXPECT_EQ(result->get_const_col_idxs()[1], 7);
+    EXPECT_EQ(result->get_const_col_idxs()[2], 300);
+}
+
+
+TYPED_TEST(DeltaCsr, ConvertsToAndFromCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    auto csr = Csr::create(this->exec);
+    auto back = Mtx::create(this->exec);
+
+    this->mtx->convert_to(csr);
+    csr->convert_to(back);
+
+    GKO_ASSERT_MTX_NEAR(csr, l({{1.0, 3.0, 2.0}, {0.0, 5.0, 0.0}}), 0.0);
+    GKO_ASSERT_MTX_NEAR(back, csr, 0.0);
+    ASSERT_EQ(back->get_num_compressed_idx_bytes(), 4);
+}
+
+
+TYPED_TEST(DeltaCsr, MovesToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec);
+
+    this->mtx->move_to(csr);
+
+    GKO_ASSERT_MTX_NEAR(csr, l({{1.0, 3.0, 2.0}, {0.0, 5.0, 0.0}}), 0.0);
+}
+
+
+TYPED_TEST(DeltaCsr, ConvertsEmptyRows)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using mat_data = typename TestFixture::mat_data;
+    auto csr = Csr::create(this->exec);
+    csr->read(mat_data{gko::dim<2>{4, 3}, {{1, 2, 1.0}, {1, 0, 2.0}}});
+    auto mtx = Mtx::create(this->exec);
+    auto result = Csr::create(this->exec);
+
+    csr->convert_to(mtx);
+    mtx->convert_to(result);
+
+    EXPECT_EQ(mtx->get_num_compressed_idx_bytes(), 2);
+    GKO_ASSERT_MTX_NEAR(result, csr, 0.0);
+}
+
+
+}  // namespace
@@ -5,11 +5,15 @@
 #include <ginkgo/core/reorder/nested_dissection.hpp>
 
 
+#include <algorithm>
+#include <fstream>
 #include <memory>
 
 
 #include <gtest/gtest.h>
+#if GKO_HAVE_METIS
 #include GKO_METIS_HEADER
+#endif
 
 
 #include <ginkgo/core/base/exception.hpp>
@@ -19,8 +23,10 @@
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
 
 
+#include "core/factorization/symbolic.hpp"
 #include "core/test/utils.hpp"
 #include "core/test/utils/assertions.hpp"
+#include "matrices/config.hpp"
 
 
 namespace {
@@ -63,6 +69,9 @@ TYPED_TEST(NestedDissection, HasSensibleDefaults)
 }
 
 
+#if GKO_HAVE_METIS
+
+
 TYPED_TEST(NestedDissection, FailsWithInvalidOption)
 {
     using value_type = typename TestFixture::value_type;
@@ -104,4 +113,64 @@ TYPED_TEST(NestedDissection, ComputesSensiblePermutation)
 }
 
 
+#else
+
+
+TYPED_TEST(NestedDissection, FailsWithMetisIfNotAvailable)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    auto factory =
+        reorder_type::build()
+            .with_algorithm(
+                gko::experimental::reorder::nested_dissection_algorithm::metis)
+            .on(this->exec);
+
+    ASSERT_THROW(factory->generate(this->star_mtx), gko::NotCompiled);
+}
+
+
+#endif
+
+
+TYPED_TEST(NestedDissection, NativeReducesFillInAni4)
+{
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    auto mtx = gko::share(gko::read<matrix_type>(
+        std::ifstream{gko::matrices::location_ani4_mtx}, this->exec));
+    const auto num_rows = mtx->get_size()[0];
+    auto factory =
+        reorder_type::build()
+            .with_algorithm(
+                gko::experimental::reorder::nested_dissection_algorithm::native)
+            .on(this->exec);
+
+    auto perm = factory->generate(mtx);
+
+    auto perm_array = gko::make_array_view(this->exec, num_rows,
+                                           perm->get_permutation());
+    gko::array<index_type> sorted_perm{this->exec, perm_array};
+    std::sort(sorted_perm.get_data(),
+              sorted_perm.get_data() + sorted_perm.get_size());
+    for (index_type i = 0; i < static_cast<index_type>(num_rows); i++) {
+        ASSERT_EQ(sorted_perm.get_const_data()[i], i);
+    }
+    auto permuted_mtx = gko::as<matrix_type>(mtx->permute(&perm_array));
+    std::unique_ptr<gko::factorization::elimination_forest<index_type>> forest;
+    std::unique_ptr<matrix_type> factorized_mtx;
+    std::unique_ptr<matrix_type> factorized_permuted_mtx;
+    gko::factorization::symbolic_cholesky(mtx.get(), true, factorized_mtx,
+                                          forest);
+    gko::factorization::symbolic_cholesky(permuted_mtx.get(), true,
+                                          factorized_permuted_mtx, forest);
+    int fillin_mtx = factorized_mtx->get_num_stored_elements() -
+                     mtx->get_num_stored_elements();
+    int fillin_permuted = factorized_permuted_mtx->get_num_stored_elements() -
+                          permuted_mtx->get_num_stored_elements();
+    ASSERT_LE(fillin_permuted, fillin_mtx / 2);
+}
+
+
 }  // namespace
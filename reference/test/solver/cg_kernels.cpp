@@ -10,6 +10,7 @@
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/record.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
@@ -215,6 +216,58 @@ TYPED_TEST(Cg, KernelStep2DivByZero)
 }
 
 
+TYPED_TEST(Cg, KernelGatherColumns)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto orig = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0, 3.0}, I<T>{4.0, 5.0, 6.0}}, this->exec);
+    auto gathered = Mtx::create(this->exec, gko::dim<2>{2, 2});
+    gko::array<gko::size_type> columns{this->exec, {2, 0}};
+
+    gko::kernels::reference::cg::gather_columns(this->exec, columns,
+                                                orig.get(), gathered.get());
+
+    GKO_ASSERT_MTX_NEAR(gathered, l({{3.0, 1.0}, {6.0, 4.0}}), 0);
+}
+
+
+TYPED_TEST(Cg, KernelScatterColumns)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto gathered =
+        gko::initialize<Mtx>({I<T>{3.0, 1.0}, I<T>{6.0, 4.0}}, this->exec);
+    auto orig = Mtx::create(this->exec, gko::dim<2>{2, 3});
+    orig->fill(0);
+    gko::array<gko::size_type> columns{this->exec, {2, 0}};
+
+    gko::kernels::reference::cg::scatter_columns(this->exec, columns,
+                                                 gathered.get(), orig.get());
+
+    GKO_ASSERT_MTX_NEAR(orig, l({{1.0, 0.0, 3.0}, {4.0, 0.0, 6.0}}), 0);
+}
+
+
+TYPED_TEST(Cg, KernelBlockConjDot)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0}, I<T>{0.0, -1.0}, I<T>{3.0, 1.0}}, this->exec);
+    auto y = gko::initialize<Mtx>(
+        {I<T>{2.0, 1.0, 0.0}, I<T>{1.0, 4.0, 1.0}, I<T>{-1.0, 0.0, 2.0}},
+        this->exec);
+    auto result = Mtx::create(this->exec, gko::dim<2>{2, 3});
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::cg::block_conj_dot(this->exec, x.get(), y.get(),
+                                                result.get(), tmp);
+
+    GKO_ASSERT_MTX_NEAR(result, l({{-1.0, 1.0, 6.0}, {2.0, -2.0, 1.0}}), 0);
+}
+
+
 TYPED_TEST(Cg, SolvesStencilSystem)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -305,6 +358,50 @@ TYPED_TEST(Cg, SolvesMultipleStencilSystems)
 }
 
 
+TYPED_TEST(Cg, SolvesMultipleStencilSystemsWithCompaction)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto params = this->cg_factory->get_parameters();
+    auto solver =
+        params.with_multi_rhs_method(gko::solver::cg::multi_rhs_method::compact)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 1.0}, I<T>{3.0, 0.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Cg, SolvesMultipleStencilSystemsWithBlockCg)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto params = this->cg_factory->get_parameters();
+    auto solver =
+        params.with_multi_rhs_method(gko::solver::cg::multi_rhs_method::block)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 1.0}, I<T>{3.0, 0.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value);
+}
+
+
 TYPED_TEST(Cg, SolvesStencilSystemUsingAdvancedApply)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -526,6 +623,108 @@ TYPED_TEST(Cg, SolvesMultipleDenseSystemForDivergenceCheck)
 }
 
 
+TYPED_TEST(Cg, SolvesMultipleDenseSystemsWithEarlyConvergence)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    for (auto method : {gko::solver::cg::multi_rhs_method::compact,
+                        gko::solver::cg::multi_rhs_method::block}) {
+        SCOPED_TRACE(static_cast<int>(method));
+        auto params = this->cg_factory_big->get_parameters();
+        auto solver = params.with_multi_rhs_method(method)
+                          .on(this->exec)
+                          ->generate(this->mtx_big);
+        auto b = gko::initialize<Mtx>({I<T>{1300083.0, 1300083.0, 886630.5},
+                                       I<T>{1018120.5, 1018120.5, -172578.0},
+                                       I<T>{906410.0, 906410.0, 684522.0},
+                                       I<T>{-42679.5, -42679.5, -65310.5},
+                                       I<T>{846779.5, 846779.5, 455487.5},
+                                       I<T>{1176858.5, 1176858.5, 607436.0}},
+                                      this->exec);
+        // the second column starts at the solution, so it stops immediately
+        auto x = gko::initialize<Mtx>({I<T>{0.0, 81.0, 0.0},
+                                       I<T>{0.0, 55.0, 0.0},
+                                       I<T>{0.0, 45.0, 0.0},
+                                       I<T>{0.0, 5.0, 0.0},
+                                       I<T>{0.0, 85.0, 0.0},
+                                       I<T>{0.0, -10.0, 0.0}},
+                                      this->exec);
+
+        solver->apply(b, x);
+
+        GKO_ASSERT_MTX_NEAR(x,
+                            l({{81.0, 81.0, 33.0},
+                               {55.0, 55.0, -56.0},
+                               {45.0, 45.0, 81.0},
+                               {5.0, 5.0, -30.0},
+                               {85.0, 85.0, 21.0},
+                               {-10.0, -10.0, 40.0}}),
+                            r<value_type>::value * 1e3);
+    }
+}
+
+
+TYPED_TEST(Cg, SolvesMultipleDenseSystemsWithCompactionAndImplicitResidual)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    // both columns converge at the same time, so they stay in the working
+    // vectors during the whole solve
+    auto b = gko::initialize<Mtx>({I<T>{1300083.0, 1300083.0},
+                                   I<T>{1018120.5, 1018120.5},
+                                   I<T>{906410.0, 906410.0},
+                                   I<T>{-42679.5, -42679.5},
+                                   I<T>{846779.5, 846779.5},
+                                   I<T>{1176858.5, 1176858.5}},
+                                  this->exec);
+    auto x = gko::initialize<Mtx>({I<T>{0.0, 0.0}, I<T>{0.0, 0.0},
+                                   I<T>{0.0, 0.0}, I<T>{0.0, 0.0},
+                                   I<T>{0.0, 0.0}, I<T>{0.0, 0.0}},
+                                  this->exec);
+    auto x_independent = x->clone();
+    auto params = this->cg_factory_big2->get_parameters();
+    auto solver =
+        params.with_multi_rhs_method(gko::solver::cg::multi_rhs_method::compact)
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto independent_solver = this->cg_factory_big2->generate(this->mtx_big);
+    auto logger = gko::share(gko::log::Record::create(
+        gko::log::Logger::iteration_complete_mask, 100));
+    auto independent_logger = gko::share(gko::log::Record::create(
+        gko::log::Logger::iteration_complete_mask, 100));
+    solver->add_logger(logger);
+    independent_solver->add_logger(independent_logger);
+
+    solver->apply(b, x);
+    independent_solver->apply(b, x_independent);
+
+    // the stopping criterion and the loggers need to see the current rho in
+    // every iteration, not the one from the previous iteration
+    const auto& iterations = logger->get().iteration_completed;
+    const auto& independent_iterations =
+        independent_logger->get().iteration_completed;
+    ASSERT_EQ(iterations.size(), independent_iterations.size());
+    for (gko::size_type i = 0; i < iterations.size(); i++) {
+        SCOPED_TRACE(i);
+        GKO_ASSERT_MTX_NEAR(
+            gko::as<Mtx>(iterations[i]->implicit_sq_residual_norm.get()),
+            gko::as<Mtx>(
+                independent_iterations[i]->implicit_sq_residual_norm.get()),
+            r<value_type>::value);
+    }
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({{81.0, 81.0},
+                           {55.0, 55.0},
+                           {45.0, 45.0},
+                           {5.0, 5.0},
+                           {85.0, 85.0},
+                           {-10.0, -10.0}}),
+                        r<value_type>::value * 1e3);
+}
+
+
 TYPED_TEST(Cg, SolvesTransposedBigDenseSystem)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -371,6 +371,70 @@ TYPED_TEST(Gmres, KernelMultiAxpy)
 }
 
 
+TYPED_TEST(Gmres, KernelMultiDot)
+{
+    using T = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    const T nan = std::numeric_limits<gko::remove_complex<T>>::quiet_NaN();
+    this->small_krylov_bases = gko::initialize<Mtx>(  // restart+1 x rows x #rhs
+        {
+            I<T>{1, 10},     // 0, 0, x
+            I<T>{2, 11},     // 0, 1, x
+            I<T>{3, 12},     // 0, 2, x
+            I<T>{4, 13},     // 1, 0, x
+            I<T>{5, 14},     // 1, 1, x
+            I<T>{6, 15},     // 1, 2, x
+            I<T>{nan, nan},  // 2, 0, x
+            I<T>{nan, nan},  // 2, 1, x
+            I<T>{nan, nan},  // 2, 2, x
+        },
+        this->exec);
+    auto next_krylov = gko::initialize<Mtx>(
+        {I<T>{1., -1.}, I<T>{0., 2.}, I<T>{1., 0.}}, this->exec);
+    auto hessenberg_col = Mtx::create(this->exec, gko::dim<2>{2, 2});
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::gmres::multi_dot(
+        this->exec, this->small_krylov_bases.get(), next_krylov.get(),
+        hessenberg_col.get(), tmp);
+
+    GKO_ASSERT_MTX_NEAR(hessenberg_col, l({{4., 12.}, {10., 15.}}),
+                        r<T>::value);
+}
+
+
+TYPED_TEST(Gmres, KernelMultiSub)
+{
+    using T = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    const T nan = std::numeric_limits<gko::remove_complex<T>>::quiet_NaN();
+    this->small_krylov_bases = gko::initialize<Mtx>(  // restart+1 x rows x #rhs
+        {
+            I<T>{1, 10},     // 0, 0, x
+            I<T>{2, 11},     // 0, 1, x
+            I<T>{3, 12},     // 0, 2, x
+            I<T>{4, 13},     // 1, 0, x
+            I<T>{5, 14},     // 1, 1, x
+            I<T>{6, 15},     // 1, 2, x
+            I<T>{nan, nan},  // 2, 0, x
+            I<T>{nan, nan},  // 2, 1, x
+            I<T>{nan, nan},  // 2, 2, x
+        },
+        this->exec);
+    auto next_krylov = gko::initialize<Mtx>(
+        {I<T>{1., -1.}, I<T>{0., 2.}, I<T>{1., 0.}}, this->exec);
+    auto hessenberg_col =
+        gko::initialize<Mtx>({I<T>{1., 2.}, I<T>{-1., 0.}}, this->exec);
+
+    gko::kernels::reference::gmres::multi_sub(
+        this->exec, this->small_krylov_bases.get(), hessenberg_col.get(),
+        next_krylov.get());
+
+    GKO_ASSERT_MTX_NEAR(next_krylov, l({{4., -21.}, {3., -20.}, {4., -24.}}),
+                        r<T>::value);
+}
+
+
 TYPED_TEST(Gmres, SolvesStencilSystem)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -601,6 +665,83 @@ TYPED_TEST(Gmres, SolvesBigDenseSystem2)
 }
 
 
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithCgs)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(100u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs)
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystem1WithCgs2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(100u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {72748.36, 297469.88, 347229.24, 36290.66, 82958.82, -80192.15},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({52.7, 85.4, 134.2, -250.0, -16.8, 35.3}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(Gmres, SolvesMultipleStencilSystemsWithCgs2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(4u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .with_krylov_dim(3u)
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{13.0, 6.0}, I<T>{7.0, 4.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
 TYPED_TEST(Gmres, SolveWithImplicitResNormCritIsDisabled)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -0,0 +1,312 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/pipe_cg.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+#include <ginkgo/core/stop/time.hpp>
+
+
+#include "core/solver/pipe_cg_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class PipeCg : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::PipeCg<value_type>;
+    PipeCg()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          pipe_cg_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(400u),
+                      gko::stop::Time::build().with_time_limit(
+                          std::chrono::seconds(6)),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec)),
+          mtx_big(gko::initialize<Mtx>(
+              {{8828.0, 2673.0, 4150.0, -3139.5, 3829.5, 5856.0},
+               {2673.0, 10765.5, 1805.0, 73.0, 1966.0, 3919.5},
+               {4150.0, 1805.0, 6472.5, 2656.0, 2409.5, 3836.5},
+               {-3139.5, 73.0, 2656.0, 6048.0, 665.0, -132.0},
+               {3829.5, 1966.0, 2409.5, 665.0, 4240.5, 4373.5},
+               {5856.0, 3919.5, 3836.5, -132.0, 4373.5, 5678.0}},
+              exec)),
+          pipe_cg_factory_big(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(100u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec)),
+          pipe_cg_factory_big2(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(100u),
+                      gko::stop::ImplicitResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec)),
+          small_stop(exec, 2)
+    {
+        small_stop.get_data()[0].reset();
+        small_stop.get_data()[1].reset();
+        small_stop.get_data()[1].stop(1);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> pipe_cg_factory;
+    std::shared_ptr<Mtx> mtx_big;
+    std::unique_ptr<typename Solver::Factory> pipe_cg_factory_big;
+    std::unique_ptr<typename Solver::Factory> pipe_cg_factory_big2;
+    gko::array<gko::stopping_status> small_stop;
+};
+
+TYPED_TEST_SUITE(PipeCg, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(PipeCg, KernelInitialize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto b = gko::initialize<Mtx>({I<T>{1.0, 2.0}, I<T>{3.0, 4.0}}, this->exec);
+    auto r = gko::initialize<Mtx>({I<T>{5.0, 5.0}, I<T>{5.0, 5.0}}, this->exec);
+    auto z = r->clone();
+    auto w = r->clone();
+    auto p = r->clone();
+    auto s = r->clone();
+    auto prev_rho_delta =
+        gko::initialize<Mtx>({I<T>{5.0, 5.0, 5.0, 5.0}}, this->exec);
+    auto prev_alpha = gko::initialize<Mtx>({I<T>{5.0, 5.0}}, this->exec);
+
+    gko::kernels::reference::pipe_cg::initialize(
+        this->exec, b.get(), r.get(), z.get(), w.get(), p.get(), s.get(),
+        prev_rho_delta.get(), prev_alpha.get(), &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(r, b, 0);
+    GKO_ASSERT_MTX_NEAR(z, l({{0.0, 0.0}, {0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(w, l({{0.0, 0.0}, {0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(p, l({{0.0, 0.0}, {0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(s, l({{0.0, 0.0}, {0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(prev_rho_delta, l({{1.0, 1.0, 5.0, 5.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(prev_alpha, l({{0.0, 0.0}}), 0);
+    ASSERT_FALSE(this->small_stop.get_const_data()[0].has_stopped());
+    ASSERT_FALSE(this->small_stop.get_const_data()[1].has_stopped());
+}
+
+
+TYPED_TEST(PipeCg, KernelComputeDots)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto r = gko::initialize<Mtx>({I<T>{1.0, 2.0}, I<T>{3.0, 4.0}}, this->exec);
+    auto z =
+        gko::initialize<Mtx>({I<T>{2.0, 1.0}, I<T>{-1.0, 0.0}}, this->exec);
+    auto w = gko::initialize<Mtx>({I<T>{0.0, 3.0}, I<T>{2.0, 1.0}}, this->exec);
+    auto rho_delta = Mtx::create(this->exec, gko::dim<2>{1, 4});
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::pipe_cg::compute_dots(
+        this->exec, r.get(), z.get(), w.get(), rho_delta.get(), tmp);
+
+    GKO_ASSERT_MTX_NEAR(rho_delta, l({{-1.0, 2.0, -2.0, 3.0}}), 0);
+}
+
+
+TYPED_TEST(PipeCg, KernelStep)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Mtx>({I<T>{1.0, 1.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto r = gko::initialize<Mtx>({I<T>{2.0, 2.0}, I<T>{2.0, 2.0}}, this->exec);
+    auto p =
+        gko::initialize<Mtx>({I<T>{1.0, 1.0}, I<T>{-1.0, 1.0}}, this->exec);
+    auto s = gko::initialize<Mtx>({I<T>{2.0, 1.0}, I<T>{0.0, 1.0}}, this->exec);
+    auto z = gko::initialize<Mtx>({I<T>{1.0, 1.0}, I<T>{2.0, 1.0}}, this->exec);
+    auto w = gko::initialize<Mtx>({I<T>{0.0, 1.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto rho_delta =
+        gko::initialize<Mtx>({I<T>{4.0, 4.0, 8.0, 8.0}}, this->exec);
+    auto prev_rho_delta =
+        gko::initialize<Mtx>({I<T>{2.0, 2.0, 0.0, 0.0}}, this->exec);
+    auto prev_alpha = gko::initialize<Mtx>({I<T>{2.0, 2.0}}, this->exec);
+    auto alpha = Mtx::create(this->exec, gko::dim<2>{1, 2});
+
+    gko::kernels::reference::pipe_cg::step(
+        this->exec, x.get(), r.get(), p.get(), s.get(), z.get(), w.get(),
+        rho_delta.get(), prev_rho_delta.get(), prev_alpha.get(), alpha.get(),
+        &this->small_stop);
+
+    // beta = 4 / 2 = 2, alpha = 4 / (8 - 2 * 4 / 2) = 1
+    GKO_ASSERT_MTX_NEAR(alpha, l({{1.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(p, l({{3.0, 1.0}, {0.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(s, l({{4.0, 1.0}, {1.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(x, l({{4.0, 1.0}, {1.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(r, l({{-2.0, 2.0}, {1.0, 2.0}}), 0);
+}
+
+
+TYPED_TEST(PipeCg, KernelStepDivByZero)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Mtx>({I<T>{1.0, 1.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto r = gko::initialize<Mtx>({I<T>{2.0, 2.0}, I<T>{2.0, 2.0}}, this->exec);
+    auto p =
+        gko::initialize<Mtx>({I<T>{1.0, 1.0}, I<T>{-1.0, 1.0}}, this->exec);
+    auto s = gko::initialize<Mtx>({I<T>{2.0, 1.0}, I<T>{0.0, 1.0}}, this->exec);
+    auto z = gko::initialize<Mtx>({I<T>{1.0, 1.0}, I<T>{2.0, 1.0}}, this->exec);
+    auto w = gko::initialize<Mtx>({I<T>{0.0, 1.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto rho_delta =
+        gko::initialize<Mtx>({I<T>{4.0, 4.0, 0.0, 0.0}}, this->exec);
+    auto prev_rho_delta =
+        gko::initialize<Mtx>({I<T>{0.0, 0.0, 0.0, 0.0}}, this->exec);
+    auto prev_alpha = gko::initialize<Mtx>({I<T>{0.0, 0.0}}, this->exec);
+    auto alpha = Mtx::create(this->exec, gko::dim<2>{1, 2});
+
+    gko::kernels::reference::pipe_cg::step(
+        this->exec, x.get(), r.get(), p.get(), s.get(), z.get(), w.get(),
+        rho_delta.get(), prev_rho_delta.get(), prev_alpha.get(), alpha.get(),
+        &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(alpha, l({{0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(p, l({{1.0, 1.0}, {2.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(s, l({{0.0, 1.0}, {1.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {1.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(r, l({{2.0, 2.0}, {2.0, 2.0}}), 0);
+}
+
+
+TYPED_TEST(PipeCg, SolvesStencilSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(PipeCg, SolvesStencilSystemMixed)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}),
+                        (r_mixed<value_type, TypeParam>()));
+}
+
+
+TYPED_TEST(PipeCg, SolvesMultipleStencilSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 1.0}, I<T>{3.0, 0.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(PipeCg, SolvesStencilSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha, b, beta, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, 5.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(PipeCg, SolvesBigDenseSystem1)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory_big->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(PipeCg, SolvesBigDenseSystem2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory_big2->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {886630.5, -172578.0, 684522.0, -65310.5, 455487.5, 607436.0},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({33.0, -56.0, 81.0, -30.0, 21.0, 40.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(PipeCg, SolvesTransposedBigDenseSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory_big->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->transpose()->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+}  // namespace
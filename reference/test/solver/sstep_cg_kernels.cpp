@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/sstep_cg.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+#include <ginkgo/core/stop/time.hpp>
+
+
+#include "core/solver/sstep_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class SstepCg : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::SstepCg<value_type>;
+    using Jacobi = gko::preconditioner::Jacobi<value_type>;
+    SstepCg()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          sstep_cg_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(400u),
+                      gko::stop::Time::build().with_time_limit(
+                          std::chrono::seconds(6)),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec)),
+          mtx_big(gko::initialize<Mtx>(
+              {{8828.0, 2673.0, 4150.0, -3139.5, 3829.5, 5856.0},
+               {2673.0, 10765.5, 1805.0, 73.0, 1966.0, 3919.5},
+               {4150.0, 1805.0, 6472.5, 2656.0, 2409.5, 3836.5},
+               {-3139.5, 73.0, 2656.0, 6048.0, 665.0, -132.0},
+               {3829.5, 1966.0, 2409.5, 665.0, 4240.5, 4373.5},
+               {5856.0, 3919.5, 3836.5, -132.0, 4373.5, 5678.0}},
+              exec)),
+          // the unnormalized basis requires a well-scaled system
+          sstep_cg_factory_big(
+              Solver::build()
+                  .with_preconditioner(
+                      Jacobi::build().with_max_block_size(1u))
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(100u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec)),
+          sstep_cg_factory_big2(
+              Solver::build()
+                  .with_preconditioner(
+                      Jacobi::build().with_max_block_size(1u))
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(100u),
+                      gko::stop::ImplicitResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec)),
+          small_stop(exec, 2)
+    {
+        small_stop.get_data()[0].reset();
+        small_stop.get_data()[1].reset();
+        small_stop.get_data()[1].stop(1);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> sstep_cg_factory;
+    std::shared_ptr<Mtx> mtx_big;
+    std::unique_ptr<typename Solver::Factory> sstep_cg_factory_big;
+    std::unique_ptr<typename Solver::Factory> sstep_cg_factory_big2;
+    gko::array<gko::stopping_status> small_stop;
+};
+
+TYPED_TEST_SUITE(SstepCg, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(SstepCg, KernelInitialize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto b = gko::initialize<Mtx>({I<T>{1.0, 2.0}, I<T>{3.0, 4.0}}, this->exec);
+    auto r = gko::initialize<Mtx>({I<T>{5.0, 5.0}, I<T>{5.0, 5.0}}, this->exec);
+
+    gko::kernels::reference::sstep::initialize(this->exec, b.get(), r.get(),
+                                               &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(r, b, 0);
+    ASSERT_FALSE(this->small_stop.get_const_data()[0].has_stopped());
+    ASSERT_FALSE(this->small_stop.get_const_data()[1].has_stopped());
+}
+
+
+TYPED_TEST(SstepCg, KernelComputeGram)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto left = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0}, I<T>{3.0, 4.0}, I<T>{0.0, 1.0}, I<T>{2.0, -1.0}},
+        this->exec);
+    auto right = gko::initialize<Mtx>(
+        {I<T>{2.0, 1.0}, I<T>{-1.0, 0.0}, I<T>{0.0, 3.0}, I<T>{2.0, 1.0}},
+        this->exec);
+    auto gram = Mtx::create(this->exec, gko::dim<2>{4, 2});
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::sstep::compute_gram(
+        this->exec, 2, left.get(), right.get(), gram.get(), tmp);
+
+    GKO_ASSERT_MTX_NEAR(
+        gram, l({{-1.0, 2.0}, {6.0, 10.0}, {-2.0, 1.0}, {4.0, 2.0}}), 0);
+}
+
+
+TYPED_TEST(SstepCg, KernelCombineBasis)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto basis = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0}, I<T>{3.0, 4.0}, I<T>{0.0, 1.0}, I<T>{2.0, -1.0}},
+        this->exec);
+    auto coeffs =
+        gko::initialize<Mtx>({I<T>{2.0, 1.0}, I<T>{1.0, 3.0}}, this->exec);
+    auto x = gko::initialize<Mtx>({I<T>{1.0, 1.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto y = x->clone();
+
+    gko::kernels::reference::sstep::combine_basis(
+        this->exec, 2, basis.get(), coeffs.get(), x.get(), true,
+        &this->small_stop);
+    gko::kernels::reference::sstep::combine_basis(
+        this->exec, 2, basis.get(), coeffs.get(), y.get(), false,
+        &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{3.0, 1.0}, {9.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(y, l({{2.0, 1.0}, {8.0, 1.0}}), 0);
+}
+
+
+TYPED_TEST(SstepCg, KernelCgCoefficients)
+{
+    using Mtx = typename TestFixture::Mtx;
+    // basis [q, A p, r] with p = q = e_0 and r = e_2
+    auto gram = gko::initialize<Mtx>(
+        {1.0, 2.0, 0.0, 2.0, 5.0, 1.0, 0.0, 1.0, 4.0}, this->exec);
+    auto coeffs = Mtx::create(this->exec, gko::dim<2>{12, 1});
+    auto rho = Mtx::create(this->exec, gko::dim<2>{1, 1});
+
+    gko::kernels::reference::sstep::cg_coefficients(this->exec, 1, gram.get(),
+                                                    coeffs.get(), rho.get());
+
+    // rho = 4, alpha = 4 / 2 = 2, beta = 20 / 4 = 5
+    GKO_ASSERT_MTX_NEAR(rho, l({4.0}), 0);
+    GKO_ASSERT_MTX_NEAR(coeffs,
+                        l({2.0, 0.0, 0.0, 5.0, -2.0, 1.0, 0.0, -2.0, 1.0, 0.0,
+                           1.0, 0.0}),
+                        0);
+}
+
+
+TYPED_TEST(SstepCg, SolvesStencilSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->sstep_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(SstepCg, SolvesStencilSystemMixed)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    auto solver = this->sstep_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}),
+                        (r_mixed<value_type, TypeParam>()));
+}
+
+
+TYPED_TEST(SstepCg, SolvesMultipleStencilSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver = this->sstep_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 1.0}, I<T>{3.0, 0.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(SstepCg, SolvesStencilSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->sstep_cg_factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha, b, beta, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, 5.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(SstepCg, MatchesCgIterates)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto iteration = gko::stop::Iteration::build().with_max_iters(2u);
+    auto solver = TestFixture::Solver::build()
+                      .with_steps(2u)
+                      .with_criteria(iteration)
+                      .on(this->exec)
+                      ->generate(this->mtx);
+    auto cg = gko::solver::Cg<value_type>::build()
+                  .with_criteria(iteration)
+                  .on(this->exec)
+                  ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+    auto x_cg = x->clone();
+
+    solver->apply(b, x);
+    cg->apply(b, x_cg);
+
+    GKO_ASSERT_MTX_NEAR(x, x_cg, r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(SstepCg, SolvesBigDenseSystem1)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->sstep_cg_factory_big->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(SstepCg, SolvesBigDenseSystem2)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->sstep_cg_factory_big2->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {886630.5, -172578.0, 684522.0, -65310.5, 455487.5, 607436.0},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    // the implicit residual norm does not reflect the rounding errors of the
+    // monomial basis, which are significant in single precision
+    GKO_ASSERT_MTX_NEAR(x, l({33.0, -56.0, 81.0, -30.0, 21.0, 40.0}),
+                        r<value_type>::value * 1e3);
+}
+
+
+TYPED_TEST(SstepCg, SolvesTransposedBigDenseSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->sstep_cg_factory_big->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->transpose()->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+}  // namespace
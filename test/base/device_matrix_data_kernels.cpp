@@ -329,6 +329,36 @@ TYPED_TEST(DeviceMatrixData, SumsDuplicates)
 }
 
 
+TYPED_TEST(DeviceMatrixData, SortsAndSumsDuplicatesLikeReference)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using device_matrix_data = gko::device_matrix_data<value_type, index_type>;
+    auto ref_arrays =
+        device_matrix_data::create_from_host(this->ref, this->duplicate_data)
+            .empty_out();
+    auto arrays =
+        device_matrix_data::create_from_host(this->exec, this->duplicate_data)
+            .empty_out();
+
+    gko::kernels::reference::components::sort_and_sum_duplicates(
+        this->ref, this->duplicate_data.size[0], ref_arrays.values,
+        ref_arrays.row_idxs, ref_arrays.col_idxs);
+    gko::kernels::EXEC_NAMESPACE::components::sort_and_sum_duplicates(
+        this->exec, this->duplicate_data.size[0], arrays.values,
+        arrays.row_idxs, arrays.col_idxs);
+
+    GKO_ASSERT_ARRAY_EQ(arrays.row_idxs, ref_arrays.row_idxs);
+    GKO_ASSERT_ARRAY_EQ(arrays.col_idxs, ref_arrays.col_idxs);
+    arrays.values.set_executor(this->ref);
+    for (int i = 0; i < arrays.values.get_size(); i++) {
+        ASSERT_LT(std::abs(arrays.values.get_const_data()[i] -
+                           ref_arrays.values.get_const_data()[i]),
+                  2 * r<value_type>::value);
+    }
+}
+
+
 #endif
 
 
@@ -273,6 +273,27 @@ TYPED_TEST(ParIlut, KernelThresholdSelectMaxIsEquivalentToRef)
 }
 
 
+TYPED_TEST(ParIlut, KernelThresholdSelectLargeIsEquivalentToRef)
+{
+    this->test_select(this->mtx1, this->dmtx1,
+                      this->mtx1->get_num_stored_elements() / 3);
+}
+
+
+TYPED_TEST(ParIlut, KernelThresholdSelectRepeatedValuesIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::clone(this->ref, this->mtx1);
+    auto vals = mtx->get_values();
+    for (gko::size_type i = 0; i < mtx->get_num_stored_elements(); ++i) {
+        vals[i] = static_cast<value_type>(i % 4 == 0 ? 1.0 : 2.0);
+    }
+    auto dmtx = gko::clone(this->exec, mtx);
+
+    this->test_select(mtx, dmtx, mtx->get_num_stored_elements() / 2);
+}
+
+
 TYPED_TEST(ParIlut, KernelThresholdFilterNullptrCooIsEquivalentToRef)
 {
     using Csr = typename TestFixture::Csr;
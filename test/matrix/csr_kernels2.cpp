@@ -295,13 +295,9 @@ TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithClassical)
 }
 
 
-// OpenMP doesn't have strategies
-#ifndef GKO_COMPILING_OMP
-
-
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalance)
+TEST_F(Csr, SimpleApplyToMultipleBlocksOfVectorsIsEquivalentToRef)
 {
-    set_up_apply_data<Mtx::load_balance>();
+    set_up_apply_data<Mtx::classical>(11);
 
     mtx->apply(y, expected);
     dmtx->apply(dy, dresult);
@@ -310,10 +306,9 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalance)
 }
 
 
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalanceUnsorted)
+TEST_F(Csr, SimpleApplyToWideDenseMatrixIsEquivalentToRef)
 {
-    set_up_apply_data<Mtx::load_balance>();
-    unsort_mtx();
+    set_up_apply_data<Mtx::classical>(37);
 
     mtx->apply(y, expected);
     dmtx->apply(dy, dresult);
@@ -322,9 +317,9 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalanceUnsorted)
 }
 
 
-TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithLoadBalance)
+TEST_F(Csr, AdvancedApplyToWideDenseMatrixIsEquivalentToRef)
 {
-    set_up_apply_data<Mtx::load_balance>();
+    set_up_apply_data<Mtx::classical>(37);
 
     mtx->apply(alpha, y, beta, expected);
     dmtx->apply(dalpha, dy, dbeta, dresult);
@@ -333,9 +328,9 @@ TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithLoadBalance)
 }
 
 
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithSparselib)
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithMergePath)
 {
-    set_up_apply_data<Mtx::sparselib>();
+    set_up_apply_data<Mtx::merge_path>();
 
     mtx->apply(y, expected);
     dmtx->apply(dy, dresult);
@@ -344,9 +339,9 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithSparselib)
 }
 
 
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithSparselibUnsorted)
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithMergePathUnsorted)
 {
-    set_up_apply_data<Mtx::sparselib>();
+    set_up_apply_data<Mtx::merge_path>();
     unsort_mtx();
 
     mtx->apply(y, expected);
@@ -356,9 +351,9 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithSparselibUnsorted)
 }
 
 
-TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithSparselib)
+TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithMergePath)
 {
-    set_up_apply_data<Mtx::sparselib>();
+    set_up_apply_data<Mtx::merge_path>();
 
     mtx->apply(alpha, y, beta, expected);
     dmtx->apply(dalpha, dy, dbeta, dresult);
@@ -367,9 +362,9 @@ TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithSparselib)
 }
 
 
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithMergePath)
+TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRefWithMergePath)
 {
-    set_up_apply_data<Mtx::merge_path>();
+    set_up_apply_data<Mtx::merge_path>(3);
 
     mtx->apply(y, expected);
     dmtx->apply(dy, dresult);
@@ -378,9 +373,60 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithMergePath)
 }
 
 
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithMergePathUnsorted)
+TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithMergePath)
 {
-    set_up_apply_data<Mtx::merge_path>();
+    set_up_apply_data<Mtx::merge_path>(3);
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Csr, AdvancedApplyWithDenseAndEmptyRowsIsEquivalentToRefWithMergePath)
+{
+    set_up_apply_data<Mtx::merge_path>(3);
+    gko::matrix_data<value_type, int> data{mtx->get_size()};
+    const auto num_cols = static_cast<int>(mtx->get_size()[1]);
+    // dense rows are split between multiple threads, which need to combine
+    // their partial sums, while the empty rows in between are skipped
+    for (auto row : {0, 1, 50, 51, 52, 100}) {
+        for (int col = 0; col < num_cols; col++) {
+            data.nonzeros.emplace_back(row, col, value_type(col % 7) - 3);
+        }
+    }
+    for (int row = 60; row < 100; row += 3) {
+        data.nonzeros.emplace_back(row, row, 1.0);
+    }
+    mtx->read(data);
+    dmtx->copy_from(mtx);
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+// OpenMP doesn't have the device-specific strategies
+#ifndef GKO_COMPILING_OMP
+
+
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalance)
+{
+    set_up_apply_data<Mtx::load_balance>();
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalanceUnsorted)
+{
+    set_up_apply_data<Mtx::load_balance>();
     unsort_mtx();
 
     mtx->apply(y, expected);
@@ -390,9 +436,9 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithMergePathUnsorted)
 }
 
 
-TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithMergePath)
+TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithLoadBalance)
 {
-    set_up_apply_data<Mtx::merge_path>();
+    set_up_apply_data<Mtx::load_balance>();
 
     mtx->apply(alpha, y, beta, expected);
     dmtx->apply(dalpha, dy, dbeta, dresult);
@@ -401,9 +447,9 @@ TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithMergePath)
 }
 
 
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomatical)
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithSparselib)
 {
-    set_up_apply_data<Mtx::automatical>();
+    set_up_apply_data<Mtx::sparselib>();
 
     mtx->apply(y, expected);
     dmtx->apply(dy, dresult);
@@ -412,9 +458,9 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomatical)
 }
 
 
-TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomaticalUnsorted)
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithSparselibUnsorted)
 {
-    set_up_apply_data<Mtx::automatical>();
+    set_up_apply_data<Mtx::sparselib>();
     unsort_mtx();
 
     mtx->apply(y, expected);
@@ -424,9 +470,20 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomaticalUnsorted)
 }
 
 
-TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRefWithLoadBalance)
+TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithSparselib)
 {
-    set_up_apply_data<Mtx::load_balance>(3);
+    set_up_apply_data<Mtx::sparselib>();
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomatical)
+{
+    set_up_apply_data<Mtx::automatical>();
 
     mtx->apply(y, expected);
     dmtx->apply(dy, dresult);
@@ -435,20 +492,21 @@ TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRefWithLoadBalance)
 }
 
 
-TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithLoadBalance)
+TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomaticalUnsorted)
 {
-    set_up_apply_data<Mtx::load_balance>(3);
+    set_up_apply_data<Mtx::automatical>();
+    unsort_mtx();
 
-    mtx->apply(alpha, y, beta, expected);
-    dmtx->apply(dalpha, dy, dbeta, dresult);
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
 
     GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
 }
 
 
-TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRefWithMergePath)
+TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRefWithLoadBalance)
 {
-    set_up_apply_data<Mtx::merge_path>(3);
+    set_up_apply_data<Mtx::load_balance>(3);
 
     mtx->apply(y, expected);
     dmtx->apply(dy, dresult);
@@ -457,9 +515,9 @@ TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRefWithMergePath)
 }
 
 
-TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithMergePath)
+TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithLoadBalance)
 {
-    set_up_apply_data<Mtx::merge_path>(3);
+    set_up_apply_data<Mtx::load_balance>(3);
 
     mtx->apply(alpha, y, beta, expected);
     dmtx->apply(dalpha, dy, dbeta, dresult);
@@ -563,6 +621,71 @@ TEST_F(Csr, SimpleApplySparseToSparseCsrMatrixIsEquivalentToRef)
 }
 
 
+TEST_F(Csr, SimpleApplySparseToWideSparseCsrMatrixIsEquivalentToRef)
+{
+    set_up_apply_data<Mtx::classical>();
+    auto mtx1 = gen_mtx<Mtx>(mtx->get_size()[0], mtx->get_size()[1], 0, 10);
+    auto mtx2 = gen_mtx<Mtx>(mtx->get_size()[1], 5000, 0, 10);
+    auto dmtx1 = gko::clone(exec, mtx1);
+    auto dmtx2 = gko::clone(exec, mtx2);
+    auto result = Mtx::create(ref, gko::dim<2>{mtx1->get_size()[0], 5000});
+    auto dresult = Mtx::create(exec, result->get_size());
+
+    mtx1->apply(mtx2, result);
+    dmtx1->apply(dmtx2, dresult);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(dresult, result);
+    GKO_ASSERT_MTX_NEAR(dresult, result, r<value_type>::value);
+    ASSERT_TRUE(dresult->is_sorted_by_column_index());
+}
+
+
+TEST_F(Csr, AdvancedApplySparseToWideSparseCsrMatrixIsEquivalentToRef)
+{
+    set_up_apply_data<Mtx::classical>();
+    auto mtx1 = gen_mtx<Mtx>(mtx->get_size()[0], mtx->get_size()[1], 0, 10);
+    auto mtx2 = gen_mtx<Mtx>(mtx->get_size()[1], 5000, 0, 10);
+    auto result = gen_mtx<Mtx>(mtx1->get_size()[0], 5000, 0, 10);
+    auto dmtx1 = gko::clone(exec, mtx1);
+    auto dmtx2 = gko::clone(exec, mtx2);
+    auto dresult = gko::clone(exec, result);
+
+    mtx1->apply(alpha, mtx2, beta, result);
+    dmtx1->apply(dalpha, dmtx2, dbeta, dresult);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(dresult, result);
+    GKO_ASSERT_MTX_NEAR(dresult, result, r<value_type>::value);
+    ASSERT_TRUE(dresult->is_sorted_by_column_index());
+}
+
+
+TEST_F(Csr, MultiplyReuseUpdateValuesIsEquivalentToRef)
+{
+    set_up_apply_data<Mtx::classical>();
+    auto mtx1 = gen_mtx<Mtx>(mtx->get_size()[0], mtx->get_size()[1], 0, 10);
+    auto mtx2 = gen_mtx<Mtx>(mtx->get_size()[1], 5000, 0, 10);
+    auto dmtx1 = gko::clone(exec, mtx1);
+    auto dmtx2 = gko::clone(exec, mtx2);
+    auto result = mtx1->multiply_reuse(mtx2);
+    auto dresult = dmtx1->multiply_reuse(dmtx2);
+    // change the values, but keep the sparsity pattern
+    std::normal_distribution<value_type> dist(-1.0, 1.0);
+    for (auto m : {mtx1.get(), mtx2.get()}) {
+        for (gko::size_type i = 0; i < m->get_num_stored_elements(); i++) {
+            m->get_values()[i] = dist(rand_engine);
+        }
+    }
+    dmtx1->copy_from(mtx1);
+    dmtx2->copy_from(mtx2);
+
+    result.second.update_values(mtx1, mtx2, result.first);
+    dresult.second.update_values(dmtx1, dmtx2, dresult.first);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(dresult.first, result.first);
+    GKO_ASSERT_MTX_NEAR(dresult.first, result.first, r<value_type>::value);
+}
+
+
 // TODO: broken in ROCm <= 4.5
 #ifndef GKO_COMPILING_HIP
 
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/delta_csr_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/delta_csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "test/utils/executor.hpp"
+
+
+namespace {
+
+
+class DeltaCsr : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::DeltaCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using MixedVec = gko::matrix::Dense<gko::next_precision<value_type>>;
+
+    DeltaCsr() : rng{4217}
+    {
+        auto data =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                300, 70000, std::uniform_int_distribution<index_type>(0, 20),
+                std::normal_distribution<gko::remove_complex<value_type>>(),
+                rng);
+        // mix rows with 8-bit, 16-bit and full-width deltas
+        for (auto& entry : data.nonzeros) {
+            if (entry.row % 3 == 0) {
+                entry.column = entry.row + entry.column % 200;
+            } else if (entry.row % 3 == 1) {
+                entry.column %= 40000;
+            }
+        }
+        data.sum_duplicates();
+        csr = Csr::create(ref);
+        csr->read(data);
+        mtx = Mtx::create(ref);
+        csr->convert_to(mtx);
+        dmtx = gko::clone(exec, mtx);
+        x = gko::test::generate_random_matrix<Vec>(
+            70000, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<gko::remove_complex<value_type>>(), rng,
+            ref);
+        dx = gko::clone(exec, x);
+        y = gko::test::generate_random_matrix<Vec>(
+            300, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<gko::remove_complex<value_type>>(), rng,
+            ref);
+        dy = gko::clone(exec, y);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        dalpha = gko::clone(exec, alpha);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    std::default_random_engine rng;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> dx;
+    std::unique_ptr<Vec> y;
+    std::unique_ptr<Vec> dy;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> beta;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(DeltaCsr, SimpleApplyIsEquivalentToRef)
+{
+    mtx->apply(x, y);
+    dmtx->apply(dx, dy);
+
+    GKO_ASSERT_MTX_NEAR(dy, y, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, SimpleApplyIsEquivalentToCsr)
+{
+    auto expected = y->clone();
+
+    csr->apply(x, expected);
+    dmtx->apply(dx, dy);
+
+    GKO_ASSERT_MTX_NEAR(dy, expected, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, AdvancedApplyIsEquivalentToRef)
+{
+    mtx->apply(alpha, x, beta, y);
+    dmtx->apply(dalpha, dx, dbeta, dy);
+
+    GKO_ASSERT_MTX_NEAR(dy, y, r<value_type>::value);
+}
+
+
+TEST_F(DeltaCsr, MixedApplyIsEquivalentToRef)
+{
+    auto mixed_x = MixedVec::create(ref);
+    auto mixed_y = MixedVec::create(ref);
+    x->convert_to(mixed_x);
+    y->convert_to(mixed_y);
+    auto dmixed_x = gko::clone(exec, mixed_x);
+    auto dmixed_y = gko::clone(exec, mixed_y);
+
+    mtx->apply(mixed_x, mixed_y);
+    dmtx->apply(dmixed_x, dmixed_y);
+
+    GKO_ASSERT_MTX_NEAR(dmixed_y, mixed_y,
+                        r<gko::next_precision<value_type>>::value);
+}
+
+
+TEST_F(DeltaCsr, ConversionFromCsrIsEquivalentToRef)
+{
+    auto dcsr = gko::clone(exec, csr);
+    auto result = Mtx::create(exec);
+
+    dcsr->convert_to(result);
+
+    auto host_result = gko::clone(ref, result);
+    const auto num_ptrs = mtx->get_size()[0] + 1;
+    const auto num_bytes = mtx->get_num_compressed_idx_bytes();
+    ASSERT_EQ(host_result->get_num_compressed_idx_bytes(), num_bytes);
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(
+            ref, num_ptrs, host_result->get_const_compressed_idx_ptrs()),
+        gko::make_const_array_view(ref, num_ptrs,
+                                   mtx->get_const_compressed_idx_ptrs()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(ref, num_bytes,
+                                   host_result->get_const_compressed_idxs()),
+        gko::make_const_array_view(ref, num_bytes,
+                                   mtx->get_const_compressed_idxs()));
+}
+
+
+TEST_F(DeltaCsr, ConversionToCsrIsEquivalentToRef)
+{
+    auto result = Csr::create(ref);
+    auto dresult = Csr::create(exec);
+
+    mtx->convert_to(result);
+    dmtx->convert_to(dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, result, 0.0);
+    GKO_ASSERT_MTX_NEAR(dresult, csr, 0.0);
+}
+
+
+}  // namespace
@@ -276,6 +276,67 @@ TEST_F(Dense, SimpleApplyIsEquivalentToRef)
 }
 
 
+TEST_F(Dense, SimpleApplyTallSkinnyIsEquivalentToRef)
+{
+    auto a = gen_mtx<Mtx>(1003, 7);
+    auto b = gen_mtx<Mtx>(7, 11);
+    auto c = gen_mtx<Mtx>(1003, 11);
+    auto da = gko::clone(exec, a);
+    auto db = gko::clone(exec, b);
+    auto dc = gko::clone(exec, c);
+
+    a->apply(b, c);
+    da->apply(db, dc);
+
+    GKO_ASSERT_MTX_NEAR(dc, c, r<value_type>::value);
+}
+
+
+TEST_F(Dense, ApplyWithFewColumnsIsEquivalentToRef)
+{
+    set_up_apply_data();
+    // fewer columns than the widest register tile of the kernels
+    for (gko::size_type num_cols = 1; num_cols <= 4; ++num_cols) {
+        SCOPED_TRACE(num_cols);
+        auto a = gen_mtx<Mtx>(1003, 131);
+        auto b = gen_mtx<Mtx>(131, num_cols);
+        auto c = gen_mtx<Mtx>(1003, num_cols);
+        auto da = gko::clone(exec, a);
+        auto db = gko::clone(exec, b);
+        auto dc = gko::clone(exec, c);
+
+        a->apply(alpha, b, beta, c);
+        da->apply(dalpha, db, dbeta, dc);
+
+        GKO_ASSERT_MTX_NEAR(dc, c, r<value_type>::value * 10);
+    }
+}
+
+
+TEST_F(Dense, AdvancedApplyLargeStridedIsEquivalentToRef)
+{
+    set_up_apply_data();
+    // the sizes exceed the cache blocks and register tiles of the kernels
+    auto a_full = gen_mtx<Mtx>(70, 305);
+    auto b_full = gen_mtx<Mtx>(301, 150);
+    auto c_full = gen_mtx<Mtx>(67, 149);
+    auto da_full = gko::clone(exec, a_full);
+    auto db_full = gko::clone(exec, b_full);
+    auto dc_full = gko::clone(exec, c_full);
+    auto a = a_full->create_submatrix(gko::span{1, 68}, gko::span{2, 303});
+    auto b = b_full->create_submatrix(gko::span{0, 301}, gko::span{3, 148});
+    auto c = c_full->create_submatrix(gko::span{0, 67}, gko::span{1, 146});
+    auto da = da_full->create_submatrix(gko::span{1, 68}, gko::span{2, 303});
+    auto db = db_full->create_submatrix(gko::span{0, 301}, gko::span{3, 148});
+    auto dc = dc_full->create_submatrix(gko::span{0, 67}, gko::span{1, 146});
+
+    a->apply(alpha, b, beta, c);
+    da->apply(dalpha, db, dbeta, dc);
+
+    GKO_ASSERT_MTX_NEAR(dc_full, c_full, r<value_type>::value * 10);
+}
+
+
 TEST_F(Dense, SimpleApplyMixedIsEquivalentToRef)
 {
     set_up_apply_data();
@@ -20,6 +20,7 @@
 #include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
 
@@ -408,6 +409,104 @@ TYPED_TEST(Matrix, CanAdvancedApplyToMultipleVectorsLarge)
 }
 
 
+TYPED_TEST(Matrix, CanApplyToMultipleVectorsWithNeighborhoodCommLarge)
+{
+    this->init_large(100, 17);
+    this->dist_mat_large->set_communication_mode(
+        gko::experimental::distributed::communication_mode::neighborhood);
+
+    this->dist_mat_large->apply(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanAdvancedApplyWithNeighborhoodCommLarge)
+{
+    this->init_large(100, 17);
+    this->dist_mat_large->set_communication_mode(
+        gko::experimental::distributed::communication_mode::neighborhood);
+
+    this->dist_mat_large->apply(this->alpha, this->x, this->beta, this->y);
+    this->csr_mat->apply(this->alpha, this->dense_x, this->beta, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyToMultipleVectorsWithPipelinedCommLarge)
+{
+    this->init_large(100, 17);
+    this->dist_mat_large->set_communication_mode(
+        gko::experimental::distributed::communication_mode::pipelined);
+
+    this->dist_mat_large->apply(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanAdvancedApplyWithPipelinedCommLarge)
+{
+    this->init_large(100, 17);
+    this->dist_mat_large->set_communication_mode(
+        gko::experimental::distributed::communication_mode::pipelined);
+
+    this->dist_mat_large->apply(this->alpha, this->x, this->beta, this->y);
+    this->csr_mat->apply(this->alpha, this->dense_x, this->beta, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyRepeatedlyWithPipelinedComm)
+{
+    this->init_large(100, 17);
+    this->dist_mat_large->set_communication_mode(
+        gko::experimental::distributed::communication_mode::pipelined);
+    this->dist_mat_large->apply(this->alpha, this->x, this->beta, this->y);
+
+    this->dist_mat_large->apply(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
+TYPED_TEST(Matrix, CanApplyWithPipelinedCommAndNonCsrNonLocalMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    this->dist_mat_large = dist_mtx_type::create(
+        this->exec, this->comm,
+        gko::matrix::Csr<value_type, local_index_type>::create(this->exec),
+        gko::matrix::Coo<value_type, local_index_type>::create(this->exec));
+    this->init_large(100, 17);
+    this->dist_mat_large->set_communication_mode(
+        gko::experimental::distributed::communication_mode::pipelined);
+
+    this->dist_mat_large->apply(this->x, this->y);
+    this->csr_mat->apply(this->dense_x, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part_large.get(),
+        this->comm.rank());
+}
+
+
 TYPED_TEST(Matrix, CanConvertToNextPrecision)
 {
     using T = typename TestFixture::value_type;
@@ -0,0 +1,320 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+
+#include <mpi.h>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/config.hpp>
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
+#include <ginkgo/core/distributed/vector.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "test/utils/mpi/executor.hpp"
+
+
+#if GINKGO_DPCPP_SINGLE_MODE
+using solver_value_type = float;
+#else
+using solver_value_type = double;
+#endif  // GINKGO_DPCPP_SINGLE_MODE
+
+
+class Pgm : public CommonMpiTestFixture {
+protected:
+    using value_type = solver_value_type;
+    using local_index_type = gko::int32;
+    using global_index_type = gko::int64;
+    using dist_mtx_type =
+        gko::experimental::distributed::Matrix<value_type, local_index_type,
+                                               global_index_type>;
+    using dist_vec_type = gko::experimental::distributed::Vector<value_type>;
+    using local_vec_type = gko::matrix::Dense<value_type>;
+    using local_csr_type = gko::matrix::Csr<value_type, local_index_type>;
+    using Partition =
+        gko::experimental::distributed::Partition<local_index_type,
+                                                  global_index_type>;
+    using pgm_type = gko::multigrid::Pgm<value_type, local_index_type>;
+    using matrix_data = gko::matrix_data<value_type, global_index_type>;
+
+    Pgm() : CommonMpiTestFixture(), engine(42 + comm.rank()), grid_size{12}
+    {
+        const auto size = grid_size * grid_size;
+        // 2D Laplacian on a grid_size x grid_size grid
+        matrix_data data{gko::dim<2>{size, size}};
+        for (global_index_type y = 0; y < grid_size; y++) {
+            for (global_index_type x = 0; x < grid_size; x++) {
+                const auto row = y * grid_size + x;
+                data.nonzeros.emplace_back(row, row, 4.0);
+                if (x > 0) {
+                    data.nonzeros.emplace_back(row, row - 1, -1.0);
+                }
+                if (x + 1 < grid_size) {
+                    data.nonzeros.emplace_back(row, row + 1, -1.0);
+                }
+                if (y > 0) {
+                    data.nonzeros.emplace_back(row, row - grid_size, -1.0);
+                }
+                if (y + 1 < grid_size) {
+                    data.nonzeros.emplace_back(row, row + grid_size, -1.0);
+                }
+            }
+        }
+        // a non-contiguous partition, so the global fine numbering differs
+        // from the rank-ordered numbering
+        gko::array<gko::experimental::distributed::comm_index_type> mapping{
+            ref, size};
+        for (gko::size_type i = 0; i < size; i++) {
+            mapping.get_data()[i] = (i / 7) % comm.size();
+        }
+        mapping.set_executor(exec);
+        row_part = gko::share(
+            Partition::build_from_mapping(exec, mapping, comm.size()));
+        dist_mat = dist_mtx_type::create(exec, comm);
+        dist_mat->read_distributed(data, row_part);
+    }
+
+    std::unique_ptr<dist_vec_type> create_random_vector(const gko::LinOp* op)
+    {
+        const auto local_rows =
+            gko::as<dist_mtx_type>(op)->get_local_matrix()->get_size()[0];
+        return dist_vec_type::create(
+            exec, comm, gko::dim<2>{op->get_size()[0], 1},
+            gko::test::generate_random_dense_matrix<value_type>(
+                local_rows, 1, std::normal_distribution<>(), engine, exec));
+    }
+
+    std::unique_ptr<dist_vec_type> create_vector(const gko::LinOp* op)
+    {
+        const auto local_rows =
+            gko::as<dist_mtx_type>(op)->get_local_matrix()->get_size()[0];
+        return dist_vec_type::create(exec, comm,
+                                     gko::dim<2>{op->get_size()[0], 1},
+                                     gko::dim<2>{local_rows, 1});
+    }
+
+    gko::size_type sum(gko::size_type value)
+    {
+        gko::size_type result{};
+        comm.all_reduce(ref, &value, &result, 1, MPI_SUM);
+        return result;
+    }
+
+    gko::size_type count_nnz(const dist_mtx_type* mtx)
+    {
+        return sum(gko::as<local_csr_type>(mtx->get_local_matrix())
+                       ->get_num_stored_elements() +
+                   gko::as<local_csr_type>(mtx->get_non_local_matrix())
+                       ->get_num_stored_elements());
+    }
+
+    gko::size_type count_local_aggregates(const pgm_type* pgm)
+    {
+        const auto num_rows = gko::as<dist_mtx_type>(pgm->get_fine_op())
+                                  ->get_local_matrix()
+                                  ->get_size()[0];
+        gko::array<local_index_type> agg{ref, num_rows};
+        ref->copy_from(exec, num_rows, pgm->get_const_agg(), agg.get_data());
+        return num_rows == 0
+                   ? 0
+                   : *std::max_element(agg.get_const_data(),
+                                       agg.get_const_data() + num_rows) +
+                         1;
+    }
+
+    void assert_galerkin_product(const pgm_type* pgm)
+    {
+        auto fine_op = pgm->get_fine_op();
+        auto coarse = pgm->get_coarse_op();
+        auto coarse_x = create_random_vector(coarse.get());
+        auto fine_x = create_vector(fine_op.get());
+        auto fine_y = create_vector(fine_op.get());
+        auto result = create_vector(coarse.get());
+        auto expected = create_vector(coarse.get());
+
+        coarse->apply(coarse_x, result);
+        pgm->get_prolong_op()->apply(coarse_x, fine_x);
+        fine_op->apply(fine_x, fine_y);
+        pgm->get_restrict_op()->apply(fine_y, expected);
+
+        GKO_ASSERT_MTX_NEAR(result->get_local_vector(),
+                            expected->get_local_vector(),
+                            r<value_type>::value);
+    }
+
+    void assert_multigrid_solves(typename pgm_type::parameters_type level)
+    {
+        using real_type = gko::remove_complex<value_type>;
+        const real_type reduction{1e-5};
+        auto solver =
+            gko::solver::Multigrid::build()
+                .with_mg_level(level)
+                .with_min_coarse_rows(8u)
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(500u),
+                    gko::stop::ResidualNorm<value_type>::build()
+                        .with_baseline(gko::stop::mode::rhs_norm)
+                        .with_reduction_factor(reduction))
+                .on(exec)
+                ->generate(dist_mat);
+        auto b = create_random_vector(dist_mat.get());
+        auto x = create_vector(dist_mat.get());
+        x->fill(gko::zero<value_type>());
+        auto residual = gko::clone(b);
+        auto one = gko::initialize<local_vec_type>({1.0}, exec);
+        auto neg_one = gko::initialize<local_vec_type>({-1.0}, exec);
+        auto b_norm =
+            gko::matrix::Dense<real_type>::create(ref, gko::dim<2>{1, 1});
+        auto res_norm =
+            gko::matrix::Dense<real_type>::create(ref, gko::dim<2>{1, 1});
+
+        solver->apply(b, x);
+
+        ASSERT_GT(solver->get_mg_level_list().size(), 1);
+        dist_mat->apply(neg_one, x, one, residual);
+        b->compute_norm2(b_norm);
+        residual->compute_norm2(res_norm);
+        ASSERT_LE(res_norm->at(0, 0), reduction * b_norm->at(0, 0));
+    }
+
+    std::default_random_engine engine;
+    global_index_type grid_size;
+    std::shared_ptr<Partition> row_part;
+    std::shared_ptr<dist_mtx_type> dist_mat;
+};
+
+
+TEST_F(Pgm, GeneratesDistributedLevel)
+{
+    auto pgm = pgm_type::build().on(exec)->generate(dist_mat);
+
+    auto coarse = gko::as<dist_mtx_type>(pgm->get_coarse_op());
+    auto prolong = gko::as<dist_mtx_type>(pgm->get_prolong_op());
+    auto restrict_op = gko::as<dist_mtx_type>(pgm->get_restrict_op());
+    const auto local_rows = dist_mat->get_local_matrix()->get_size()[0];
+    const auto local_coarse_rows = coarse->get_local_matrix()->get_size()[0];
+    ASSERT_LT(coarse->get_size()[0], dist_mat->get_size()[0]);
+    ASSERT_LT(local_coarse_rows, local_rows);
+    ASSERT_EQ(prolong->get_size(),
+              gko::dim<2>(dist_mat->get_size()[0], coarse->get_size()[0]));
+    ASSERT_EQ(restrict_op->get_size(),
+              gko::dim<2>(coarse->get_size()[0], dist_mat->get_size()[0]));
+    ASSERT_EQ(prolong->get_local_matrix()->get_size(),
+              gko::dim<2>(local_rows, local_coarse_rows));
+    // every fine row belongs to exactly one aggregate
+    ASSERT_EQ(count_nnz(prolong.get()), dist_mat->get_size()[0]);
+    ASSERT_EQ(count_nnz(restrict_op.get()), dist_mat->get_size()[0]);
+    // the coarse matrix couples aggregates on different ranks
+    ASSERT_GT(gko::as<local_csr_type>(coarse->get_non_local_matrix())
+                  ->get_num_stored_elements(),
+              0);
+}
+
+
+TEST_F(Pgm, MergesAggregatesAcrossRanks)
+{
+    auto pgm = pgm_type::build().on(exec)->generate(dist_mat);
+
+    auto prolong = gko::as<dist_mtx_type>(pgm->get_prolong_op());
+    auto restrict_op = gko::as<dist_mtx_type>(pgm->get_restrict_op());
+    // some fine rows belong to an aggregate owned by another rank
+    ASSERT_GT(sum(gko::as<local_csr_type>(prolong->get_non_local_matrix())
+                      ->get_num_stored_elements()),
+              0);
+    ASSERT_GT(sum(gko::as<local_csr_type>(restrict_op->get_non_local_matrix())
+                      ->get_num_stored_elements()),
+              0);
+    // the merged aggregates are larger than the pairs of the local matching
+    ASSERT_LT(pgm->get_coarse_op()->get_size()[0],
+              sum(count_local_aggregates(pgm.get())));
+}
+
+
+TEST_F(Pgm, AgglomeratesCoarseLevel)
+{
+    auto pgm = pgm_type::build()
+                   .with_min_rows_per_rank(dist_mat->get_size()[0])
+                   .on(exec)
+                   ->generate(dist_mat);
+
+    auto coarse = gko::as<dist_mtx_type>(pgm->get_coarse_op());
+    const auto local_coarse_rows = coarse->get_local_matrix()->get_size()[0];
+    // a single rank owns the whole coarse matrix
+    ASSERT_EQ(local_coarse_rows,
+              comm.rank() == 0 ? coarse->get_size()[0] : 0);
+    ASSERT_EQ(gko::as<dist_mtx_type>(pgm->get_restrict_op())
+                  ->get_local_matrix()
+                  ->get_size()[0],
+              local_coarse_rows);
+    assert_galerkin_product(pgm.get());
+}
+
+
+TEST_F(Pgm, CoarseMatrixIsGalerkinProduct)
+{
+    auto pgm = pgm_type::build().on(exec)->generate(dist_mat);
+
+    assert_galerkin_product(pgm.get());
+}
+
+
+TEST_F(Pgm, BuildsMultilevelHierarchy)
+{
+    auto solver = gko::solver::Multigrid::build()
+                      .with_mg_level(pgm_type::build().with_min_rows_per_rank(
+                          gko::size_type{16}))
+                      .with_max_levels(10u)
+                      .with_min_coarse_rows(2u)
+                      .with_criteria(gko::stop::Iteration::build()
+                                         .with_max_iters(1u))
+                      .on(exec)
+                      ->generate(dist_mat);
+
+    const auto levels = solver->get_mg_level_list();
+    ASSERT_GT(levels.size(), 2);
+    auto fine = dist_mat->get_size()[0];
+    for (const auto& level : levels) {
+        auto pgm = gko::as<pgm_type>(level);
+        const auto coarse = pgm->get_coarse_op()->get_size()[0];
+        ASSERT_EQ(pgm->get_fine_op()->get_size()[0], fine);
+        ASSERT_LT(coarse, fine);
+        assert_galerkin_product(pgm.get());
+        fine = coarse;
+    }
+    // the coarsest matrix is agglomerated onto a single rank
+    auto coarsest = gko::as<dist_mtx_type>(levels.back()->get_coarse_op());
+    ASSERT_EQ(coarsest->get_local_matrix()->get_size()[0],
+              comm.rank() == 0 ? coarsest->get_size()[0] : 0);
+}
+
+
+TEST_F(Pgm, MultigridSolvesDistributedSystem)
+{
+    assert_multigrid_solves(pgm_type::build());
+}
+
+
+TEST_F(Pgm, MultigridSolvesWithAgglomeratedLevels)
+{
+    assert_multigrid_solves(
+        pgm_type::build().with_min_rows_per_rank(gko::size_type{16}));
+}
@@ -26,6 +26,9 @@
 #include <ginkgo/core/solver/gcr.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
+#include <ginkgo/core/solver/sstep_bicgstab.hpp>
+#include <ginkgo/core/solver/sstep_cg.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
 
 
@@ -106,6 +109,26 @@ struct Cg : SimpleSolverTest<gko::solver::Cg<solver_value_type>> {
 };
 
 
+struct PipeCg : SimpleSolverTest<gko::solver::PipeCg<solver_value_type>> {
+    static void preprocess(
+        gko::matrix_data<value_type, global_index_type>& data)
+    {
+        // make sure the matrix is well-conditioned
+        gko::utils::make_hpd(data, 1.5);
+    }
+};
+
+
+struct SstepCg : SimpleSolverTest<gko::solver::SstepCg<solver_value_type>> {
+    static void preprocess(
+        gko::matrix_data<value_type, global_index_type>& data)
+    {
+        // make sure the matrix is well-conditioned
+        gko::utils::make_hpd(data, 1.5);
+    }
+};
+
+
 struct Cgs : SimpleSolverTest<gko::solver::Cgs<solver_value_type>> {};
 
 
@@ -123,6 +146,12 @@ struct Bicgstab : SimpleSolverTest<gko::solver::Bicgstab<solver_value_type>> {
 };
 
 
+struct SstepBicgstab
+    : SimpleSolverTest<gko::solver::SstepBicgstab<solver_value_type>> {
+    static constexpr double tolerance() { return 300 * reduction_factor(); }
+};
+
+
 struct Ir : SimpleSolverTest<gko::solver::Ir<solver_value_type>> {
     static void preprocess(
         gko::matrix_data<value_type, global_index_type>& data)
@@ -156,6 +185,17 @@ struct Gmres : SimpleSolverTest<gko::solver::Gmres<solver_value_type>> {
 };
 
 
+template <unsigned dimension>
+struct GmresCgs2 : Gmres<dimension> {
+    static typename Gmres<dimension>::solver_type::parameters_type build(
+        std::shared_ptr<const gko::Executor> exec)
+    {
+        return Gmres<dimension>::build(std::move(exec))
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2);
+    }
+};
+
+
 template <unsigned dimension>
 struct Gcr : SimpleSolverTest<gko::solver::Gcr<solver_value_type>> {
     static typename solver_type::parameters_type build(
@@ -474,8 +514,10 @@ protected:
     std::default_random_engine rand_engine;
 };
 
-using SolverTypes = ::testing::Types<Cg, Cgs, Fcg, Bicgstab, Ir, Gcr<10u>,
-                                     Gcr<100u>, Gmres<10u>, Gmres<100u>>;
+using SolverTypes =
+    ::testing::Types<Cg, PipeCg, SstepCg, Cgs, Fcg, Bicgstab, SstepBicgstab,
+                     Ir, Gcr<10u>, Gcr<100u>, Gmres<10u>, Gmres<100u>,
+                     GmresCgs2<10u>>;
 
 TYPED_TEST_SUITE(Solver, SolverTypes, TypenameNameGenerator);
 
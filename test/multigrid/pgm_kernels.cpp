@@ -15,6 +15,7 @@
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/diagonal.hpp>
 #include <ginkgo/core/matrix/row_gatherer.hpp>
@@ -36,6 +37,7 @@ class Pgm : public CommonTestFixture {
 protected:
     using Mtx = gko::matrix::Dense<value_type>;
     using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Coo = gko::matrix::Coo<value_type, index_type>;
     using SparsityCsr = gko::matrix::SparsityCsr<value_type, index_type>;
     using RowGatherer = gko::matrix::RowGatherer<index_type>;
     using Diag = gko::matrix::Diagonal<value_type>;
@@ -243,6 +245,42 @@ TEST_F(Pgm, AssignToExistAggUnderteminsticIsEquivalentToRef)
 }
 
 
+TEST_F(Pgm, ComputeCoarseCooIsEquivalentToRef)
+{
+    const gko::size_type nnz = 100000;
+    const index_type num_coarse = 10;
+    // only a few distinct entries, so long runs of duplicates cross the
+    // boundaries between the parallel work chunks
+    auto row_idxs = gen_array(nnz, 0, num_coarse - 1);
+    auto col_idxs = gen_array(nnz, 0, num_coarse - 1);
+    auto vals = gko::test::generate_random_array<value_type>(
+        nnz, std::normal_distribution<gko::remove_complex<value_type>>(),
+        rand_engine, ref);
+    gko::kernels::reference::pgm::sort_row_major(
+        ref, nnz, row_idxs.get_data(), col_idxs.get_data(), vals.get_data());
+    gko::size_type coarse_nnz{};
+    gko::kernels::reference::pgm::count_unrepeated_nnz(
+        ref, nnz, row_idxs.get_const_data(), col_idxs.get_const_data(),
+        &coarse_nnz);
+    gko::array<index_type> d_row_idxs{exec, row_idxs};
+    gko::array<index_type> d_col_idxs{exec, col_idxs};
+    gko::array<value_type> d_vals{exec, vals};
+    auto coarse_coo =
+        Coo::create(ref, gko::dim<2>(num_coarse, num_coarse), coarse_nnz);
+    auto d_coarse_coo =
+        Coo::create(exec, gko::dim<2>(num_coarse, num_coarse), coarse_nnz);
+
+    gko::kernels::reference::pgm::compute_coarse_coo(
+        ref, nnz, row_idxs.get_const_data(), col_idxs.get_const_data(),
+        vals.get_const_data(), coarse_coo.get());
+    gko::kernels::EXEC_NAMESPACE::pgm::compute_coarse_coo(
+        exec, nnz, d_row_idxs.get_const_data(), d_col_idxs.get_const_data(),
+        d_vals.get_const_data(), d_coarse_coo.get());
+
+    GKO_ASSERT_MTX_NEAR(d_coarse_coo, coarse_coo, r<value_type>::value);
+}
+
+
 TEST_F(Pgm, GenerateMgLevelIsEquivalentToRef)
 {
     initialize_data();
@@ -154,3 +154,24 @@ TYPED_TEST(Amd, IsEquivalentToRefUnsortedSkipSymmetrize)
         this->exec, this->mtx->get_size()[0], dperm->get_permutation());
     GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
 }
+
+
+TYPED_TEST(Amd, MultipleEliminationIsEquivalentToRef)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    const auto algorithm =
+        gko::experimental::reorder::amd_algorithm::multiple_elimination;
+    auto factory =
+        reorder_type::build().with_algorithm(algorithm).on(this->ref);
+    auto dfactory =
+        reorder_type::build().with_algorithm(algorithm).on(this->exec);
+
+    auto perm = factory->generate(this->mtx);
+    auto dperm = dfactory->generate(this->dmtx);
+
+    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
+                                           perm->get_permutation());
+    auto dperm_array = gko::make_array_view(
+        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
+    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+}
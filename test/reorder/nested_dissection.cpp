@@ -57,3 +57,28 @@ TYPED_TEST(NestedDissection, ResultIsEquivalentToRef)
         this->exec, this->mtx->get_size()[0], dperm->get_permutation());
     GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
 }
+
+
+TYPED_TEST(NestedDissection, NativeResultIsEquivalentToRef)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    const auto algorithm =
+        gko::experimental::reorder::nested_dissection_algorithm::native;
+    auto nd_factory =
+        reorder_type::build().with_algorithm(algorithm).on(this->ref);
+    auto dnd_factory =
+        reorder_type::build().with_algorithm(algorithm).on(this->exec);
+    std::ifstream stream{gko::matrices::location_ani4_mtx};
+    auto mtx = gko::share(gko::read<matrix_type>(stream, this->ref));
+    auto dmtx = gko::share(gko::clone(this->exec, mtx));
+
+    auto perm = nd_factory->generate(mtx);
+    auto dperm = dnd_factory->generate(dmtx);
+
+    auto perm_array = gko::make_array_view(this->ref, mtx->get_size()[0],
+                                           perm->get_permutation());
+    auto dperm_array = gko::make_array_view(this->exec, mtx->get_size()[0],
+                                            dperm->get_permutation());
+    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+}
@@ -335,6 +335,42 @@ protected:
         o_1138_bus_mtx->read(data);
     }
 
+    void build_many_connected_components()
+    {
+        gko::matrix_data<value_type, index_type> data;
+        std::uniform_int_distribution<index_type> size_dist(1, 30);
+        const int num_components = 300;
+        index_type offset = 0;
+        for (int component = 0; component < num_components; component++) {
+            // a path with a few chords, so not every node has the same degree
+            const auto size = size_dist(rng);
+            for (index_type i = 0; i < size; i++) {
+                data.nonzeros.emplace_back(offset + i, offset + i, 1.0);
+                if (i > 0) {
+                    data.nonzeros.emplace_back(offset + i, offset + i - 1, 1.0);
+                    data.nonzeros.emplace_back(offset + i - 1, offset + i, 1.0);
+                }
+                if (i > 2 && i % 3 == 0) {
+                    data.nonzeros.emplace_back(offset + i, offset + i - 3, 1.0);
+                    data.nonzeros.emplace_back(offset + i - 3, offset + i, 1.0);
+                }
+            }
+            offset += size;
+        }
+        data.size = gko::dim<2>{static_cast<gko::size_type>(offset),
+                                static_cast<gko::size_type>(offset)};
+        std::vector<index_type> permutation(data.size[0]);
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::shuffle(permutation.begin(), permutation.end(), rng);
+        for (auto& entry : data.nonzeros) {
+            entry.row = permutation[entry.row];
+            entry.column = permutation[entry.column];
+        }
+        data.sort_row_major();
+        d_1138_bus_mtx->read(data);
+        o_1138_bus_mtx->read(data);
+    }
+
     std::default_random_engine rng;
     std::shared_ptr<CsrMtx> o_1138_bus_mtx;
     std::shared_ptr<CsrMtx> d_1138_bus_mtx;
@@ -425,3 +461,31 @@ TEST_F(Rcm, PermutationIsRcmOrderedMinDegreeMultipleConnectedComponents)
     check_rcm_ordered(o_1138_bus_mtx, perm.get(),
                       d_reorder_op->get_parameters().strategy);
 }
+
+
+TEST_F(Rcm, PermutationIsRcmOrderedManyConnectedComponents)
+{
+    this->build_many_connected_components();
+
+    d_reorder_op = reorder_type::build().on(exec)->generate(d_1138_bus_mtx);
+
+    auto perm = d_reorder_op->get_permutation();
+    check_rcm_ordered(o_1138_bus_mtx, perm.get(),
+                      d_reorder_op->get_parameters().strategy);
+}
+
+
+TEST_F(Rcm, PermutationIsRcmOrderedMinDegreeManyConnectedComponents)
+{
+    this->build_many_connected_components();
+
+    d_reorder_op =
+        reorder_type::build()
+            .with_strategy(gko::reorder::starting_strategy::minimum_degree)
+            .on(exec)
+            ->generate(d_1138_bus_mtx);
+
+    auto perm = d_reorder_op->get_permutation();
+    check_rcm_ordered(o_1138_bus_mtx, perm.get(),
+                      d_reorder_op->get_parameters().strategy);
+}
@@ -160,6 +160,59 @@ TEST_F(Cg, CgStep2IsEquivalentToRef)
 }
 
 
+TEST_F(Cg, CgGatherColumnsIsEquivalentToRef)
+{
+    initialize_data();
+    auto gathered = Mtx::create(ref, gko::dim<2>{b->get_size()[0], 3});
+    auto d_gathered = Mtx::create(exec, gathered->get_size());
+    gko::array<gko::size_type> columns{ref, {7, 1, 42}};
+    gko::array<gko::size_type> d_columns{exec, columns};
+
+    gko::kernels::reference::cg::gather_columns(ref, columns, b.get(),
+                                                gathered.get());
+    gko::kernels::EXEC_NAMESPACE::cg::gather_columns(
+        exec, d_columns, d_b.get(), d_gathered.get());
+
+    GKO_ASSERT_MTX_NEAR(d_gathered, gathered, 0);
+}
+
+
+TEST_F(Cg, CgScatterColumnsIsEquivalentToRef)
+{
+    initialize_data();
+    auto gathered = gen_mtx(b->get_size()[0], 3, 4);
+    auto d_gathered = gko::clone(exec, gathered);
+    gko::array<gko::size_type> columns{ref, {7, 1, 42}};
+    gko::array<gko::size_type> d_columns{exec, columns};
+
+    gko::kernels::reference::cg::scatter_columns(ref, columns, gathered.get(),
+                                                 b.get());
+    gko::kernels::EXEC_NAMESPACE::cg::scatter_columns(
+        exec, d_columns, d_gathered.get(), d_b.get());
+
+    GKO_ASSERT_MTX_NEAR(d_b, b, 0);
+}
+
+
+TEST_F(Cg, CgBlockConjDotIsEquivalentToRef)
+{
+    initialize_data();
+    auto result = Mtx::create(ref, gko::dim<2>{b->get_size()[1], 5});
+    auto d_result = Mtx::create(exec, result->get_size());
+    auto y = gen_mtx(b->get_size()[0], 5, 7);
+    auto d_y = gko::clone(exec, y);
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::cg::block_conj_dot(ref, b.get(), y.get(),
+                                                result.get(), tmp);
+    gko::kernels::EXEC_NAMESPACE::cg::block_conj_dot(exec, d_b.get(), d_y.get(),
+                                                     d_result.get(), d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_result, result, ::r<value_type>::value);
+}
+
+
 TEST_F(Cg, ApplyIsEquivalentToRef)
 {
     auto data = gko::matrix_data<value_type, index_type>(
@@ -193,3 +246,45 @@ TEST_F(Cg, ApplyIsEquivalentToRef)
 
     GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
 }
+
+
+TEST_F(Cg, ApplyWithMultiRhsMethodsIsEquivalentToRef)
+{
+    auto data = gko::matrix_data<value_type, index_type>(
+        gko::dim<2>{50, 50}, std::normal_distribution<value_type>(-1.0, 1.0),
+        rand_engine);
+    gko::utils::make_hpd(data);
+    auto mtx = gko::share(Mtx::create(ref, data.size, 53));
+    mtx->read(data);
+    auto d_mtx = gko::share(gko::clone(exec, mtx));
+    auto orig_x = gen_mtx(50, 3, 5);
+    auto b = gen_mtx(50, 3, 4);
+    // let one column converge much earlier than the others
+    b->scale(gko::initialize<Mtx>({{1.0, 1e-6, 1.0}}, ref));
+    auto d_b = gko::clone(exec, b);
+    for (auto method : {gko::solver::cg::multi_rhs_method::compact,
+                        gko::solver::cg::multi_rhs_method::block}) {
+        SCOPED_TRACE(static_cast<int>(method));
+        auto x = orig_x->clone();
+        auto d_x = gko::clone(exec, orig_x);
+        auto build_factory = [&](std::shared_ptr<const gko::Executor> exec) {
+            return gko::solver::Cg<value_type>::build()
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(50u),
+                    gko::stop::ResidualNorm<value_type>::build()
+                        .with_baseline(gko::stop::mode::absolute)
+                        .with_reduction_factor(::r<value_type>::value))
+                .with_multi_rhs_method(method)
+                .on(exec);
+        };
+        auto cg_factory = build_factory(ref);
+        auto d_cg_factory = build_factory(exec);
+        auto solver = cg_factory->generate(mtx);
+        auto d_solver = d_cg_factory->generate(d_mtx);
+
+        solver->apply(b, x);
+        d_solver->apply(d_b, d_x);
+
+        GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
+    }
+}
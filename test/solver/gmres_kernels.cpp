@@ -277,6 +277,39 @@ TEST_F(Gmres, GmresKernelMultiAxpyIsEquivalentToRef)
 }
 
 
+TEST_F(Gmres, GmresKernelMultiDotIsEquivalentToRef)
+{
+    initialize_data();
+    auto hessenberg_col = gen_mtx(5, x->get_size()[1]);
+    auto d_hessenberg_col = gko::clone(exec, hessenberg_col);
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::gmres::multi_dot(
+        ref, krylov_bases.get(), x.get(), hessenberg_col.get(), tmp);
+    gko::kernels::EXEC_NAMESPACE::gmres::multi_dot(
+        exec, d_krylov_bases.get(), d_x.get(), d_hessenberg_col.get(), d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_hessenberg_col, hessenberg_col,
+                        r<value_type>::value * 100);
+}
+
+
+TEST_F(Gmres, GmresKernelMultiSubIsEquivalentToRef)
+{
+    initialize_data();
+    auto hessenberg_col = gen_mtx(5, x->get_size()[1]);
+    auto d_hessenberg_col = gko::clone(exec, hessenberg_col);
+
+    gko::kernels::reference::gmres::multi_sub(ref, krylov_bases.get(),
+                                              hessenberg_col.get(), x.get());
+    gko::kernels::EXEC_NAMESPACE::gmres::multi_sub(
+        exec, d_krylov_bases.get(), d_hessenberg_col.get(), d_x.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value);
+}
+
+
 TEST_F(Gmres, GmresApplyOneRHSIsEquivalentToRef)
 {
     int m = 123;
@@ -313,3 +346,36 @@ TEST_F(Gmres, GmresApplyMultipleRHSIsEquivalentToRef)
     GKO_ASSERT_MTX_NEAR(d_b, b, 0);
     GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e3);
 }
+
+
+TEST_F(Gmres, GmresApplyWithCgs2IsEquivalentToRef)
+{
+    int m = 123;
+    int n = 5;
+    auto ref_solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(246u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(value_type{1e-15}))
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .on(ref)
+            ->generate(mtx);
+    auto exec_solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(246u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(value_type{1e-15}))
+            .with_ortho_method(gko::solver::gmres::ortho_method::cgs2)
+            .on(exec)
+            ->generate(d_mtx);
+    auto b = gen_mtx(m, n);
+    auto x = gen_mtx(m, n);
+    auto d_b = gko::clone(exec, b);
+    auto d_x = gko::clone(exec, x);
+
+    ref_solver->apply(b, x);
+    exec_solver->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_b, b, 0);
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value * 1e3);
+}
@@ -68,6 +68,23 @@ protected:
         dmtx_l = gko::clone(exec, mtx_l);
     }
 
+    void initialize_sparse_data(int m, int n)
+    {
+        auto data = gko::test::generate_random_triangular_matrix_data<
+            value_type, index_type>(m, false, true,
+                                    std::uniform_int_distribution<>(1, 5),
+                                    std::normal_distribution<>(-1.0, 1.0),
+                                    rand_engine);
+        gko::utils::make_diag_dominant(data);
+        b = gen_vec(m, n);
+        x = gen_vec(m, n);
+        mtx_l = mtx_type::create(ref);
+        mtx_l->read(data);
+        dx = gko::clone(exec, x);
+        db = gko::clone(exec, b);
+        dmtx_l = gko::clone(exec, mtx_l);
+    }
+
     std::shared_ptr<vec_type> b;
     std::shared_ptr<vec_type> x;
     std::shared_ptr<mtx_type> mtx;
@@ -337,6 +354,53 @@ TEST_F(LowerTrs, ApplyTriangularSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
 }
 
 
+TEST_F(LowerTrs, ApplyLargeSparseTriangularMtxIsEquivalentToRef)
+{
+    initialize_sparse_data(2000, 1);
+    auto lower_trs_factory = solver_type::build().on(ref);
+    auto d_lower_trs_factory = solver_type::build().on(exec);
+    auto solver = lower_trs_factory->generate(mtx_l);
+    auto d_solver = d_lower_trs_factory->generate(dmtx_l);
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(LowerTrs, ApplyLargeSparseTriangularMtxUnitDiagIsEquivalentToRef)
+{
+    initialize_sparse_data(2000, 1);
+    auto lower_trs_factory =
+        solver_type::build().with_unit_diagonal(true).on(ref);
+    auto d_lower_trs_factory =
+        solver_type::build().with_unit_diagonal(true).on(exec);
+    auto solver = lower_trs_factory->generate(mtx_l);
+    auto d_solver = d_lower_trs_factory->generate(dmtx_l);
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(LowerTrs, ApplyLargeSparseTriangularMtxMultipleRhsIsEquivalentToRef)
+{
+    initialize_sparse_data(2000, 3);
+    auto lower_trs_factory = solver_type::build().with_num_rhs(3u).on(ref);
+    auto d_lower_trs_factory = solver_type::build().with_num_rhs(3u).on(exec);
+    auto solver = lower_trs_factory->generate(mtx_l);
+    auto d_solver = d_lower_trs_factory->generate(dmtx_l);
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
 #ifdef GKO_COMPILING_CUDA
 
 
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class PipeCg : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::Dense<value_type>;
+
+    PipeCg() : rand_engine(30) {}
+
+    std::unique_ptr<Mtx> gen_mtx(gko::size_type num_rows,
+                                 gko::size_type num_cols, gko::size_type stride)
+    {
+        auto tmp_mtx = gko::test::generate_random_matrix<Mtx>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+        auto result = Mtx::create(ref, gko::dim<2>{num_rows, num_cols}, stride);
+        result->copy_from(tmp_mtx);
+        return result;
+    }
+
+    void initialize_data()
+    {
+        gko::size_type m = 597;
+        gko::size_type n = 43;
+        // all vectors need the same stride as b, except x
+        b = gen_mtx(m, n, n + 2);
+        r = gen_mtx(m, n, n + 2);
+        z = gen_mtx(m, n, n + 2);
+        w = gen_mtx(m, n, n + 2);
+        p = gen_mtx(m, n, n + 2);
+        s = gen_mtx(m, n, n + 2);
+        x = gen_mtx(m, n, n + 3);
+        rho_delta = gen_mtx(1, 2 * n, 2 * n);
+        prev_rho_delta = gen_mtx(1, 2 * n, 2 * n);
+        prev_alpha = gen_mtx(1, n, n);
+        alpha = gen_mtx(1, n, n);
+        // check correct handling for zero values
+        prev_rho_delta->at(2) = 0.0;
+        prev_alpha->at(3) = 0.0;
+        stop_status =
+            std::make_unique<gko::array<gko::stopping_status>>(ref, n);
+        for (size_t i = 0; i < stop_status->get_size(); ++i) {
+            stop_status->get_data()[i].reset();
+        }
+        // check correct handling for stopped columns
+        stop_status->get_data()[1].stop(1);
+
+        d_b = gko::clone(exec, b);
+        d_r = gko::clone(exec, r);
+        d_z = gko::clone(exec, z);
+        d_w = gko::clone(exec, w);
+        d_p = gko::clone(exec, p);
+        d_s = gko::clone(exec, s);
+        d_x = gko::clone(exec, x);
+        d_rho_delta = gko::clone(exec, rho_delta);
+        d_prev_rho_delta = gko::clone(exec, prev_rho_delta);
+        d_prev_alpha = gko::clone(exec, prev_alpha);
+        d_alpha = gko::clone(exec, alpha);
+        d_stop_status = std::make_unique<gko::array<gko::stopping_status>>(
+            exec, *stop_status);
+    }
+
+    std::default_random_engine rand_engine;
+
+    std::unique_ptr<Mtx> b;
+    std::unique_ptr<Mtx> r;
+    std::unique_ptr<Mtx> z;
+    std::unique_ptr<Mtx> w;
+    std::unique_ptr<Mtx> p;
+    std::unique_ptr<Mtx> s;
+    std::unique_ptr<Mtx> x;
+    std::unique_ptr<Mtx> rho_delta;
+    std::unique_ptr<Mtx> prev_rho_delta;
+    std::unique_ptr<Mtx> prev_alpha;
+    std::unique_ptr<Mtx> alpha;
+    std::unique_ptr<gko::array<gko::stopping_status>> stop_status;
+
+    std::unique_ptr<Mtx> d_b;
+    std::unique_ptr<Mtx> d_r;
+    std::unique_ptr<Mtx> d_z;
+    std::unique_ptr<Mtx> d_w;
+    std::unique_ptr<Mtx> d_p;
+    std::unique_ptr<Mtx> d_s;
+    std::unique_ptr<Mtx> d_x;
+    std::unique_ptr<Mtx> d_rho_delta;
+    std::unique_ptr<Mtx> d_prev_rho_delta;
+    std::unique_ptr<Mtx> d_prev_alpha;
+    std::unique_ptr<Mtx> d_alpha;
+    std::unique_ptr<gko::array<gko::stopping_status>> d_stop_status;
+};
+
+
+TEST_F(PipeCg, PipeCgInitializeIsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::pipe_cg::initialize(
+        ref, b.get(), r.get(), z.get(), w.get(), p.get(), s.get(),
+        prev_rho_delta.get(), prev_alpha.get(), stop_status.get());
+    gko::kernels::EXEC_NAMESPACE::pipe_cg::initialize(
+        exec, d_b.get(), d_r.get(), d_z.get(), d_w.get(), d_p.get(), d_s.get(),
+        d_prev_rho_delta.get(), d_prev_alpha.get(), d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_r, r, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_z, z, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_w, w, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_p, p, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_s, s, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_prev_rho_delta, prev_rho_delta,
+                        ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_prev_alpha, prev_alpha, ::r<value_type>::value);
+    GKO_ASSERT_ARRAY_EQ(*d_stop_status, *stop_status);
+}
+
+
+TEST_F(PipeCg, PipeCgComputeDotsIsEquivalentToRef)
+{
+    initialize_data();
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::pipe_cg::compute_dots(
+        ref, r.get(), z.get(), w.get(), rho_delta.get(), tmp);
+    gko::kernels::EXEC_NAMESPACE::pipe_cg::compute_dots(
+        exec, d_r.get(), d_z.get(), d_w.get(), d_rho_delta.get(), d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_rho_delta, rho_delta, ::r<value_type>::value * 100);
+}
+
+
+TEST_F(PipeCg, PipeCgStepIsEquivalentToRef)
+{
+    initialize_data();
+
+    gko::kernels::reference::pipe_cg::step(
+        ref, x.get(), r.get(), p.get(), s.get(), z.get(), w.get(),
+        rho_delta.get(), prev_rho_delta.get(), prev_alpha.get(), alpha.get(),
+        stop_status.get());
+    gko::kernels::EXEC_NAMESPACE::pipe_cg::step(
+        exec, d_x.get(), d_r.get(), d_p.get(), d_s.get(), d_z.get(), d_w.get(),
+        d_rho_delta.get(), d_prev_rho_delta.get(), d_prev_alpha.get(),
+        d_alpha.get(), d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_r, r, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_p, p, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_s, s, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_alpha, alpha, ::r<value_type>::value);
+}
+
+
+TEST_F(PipeCg, ApplyIsEquivalentToRef)
+{
+    auto data = gko::matrix_data<value_type, index_type>(
+        gko::dim<2>{50, 50}, std::normal_distribution<value_type>(-1.0, 1.0),
+        rand_engine);
+    gko::utils::make_hpd(data);
+    auto mtx = Mtx::create(ref, data.size, 53);
+    mtx->read(data);
+    auto x = gen_mtx(50, 3, 5);
+    auto b = gen_mtx(50, 3, 4);
+    auto d_mtx = gko::clone(exec, mtx);
+    auto d_x = gko::clone(exec, x);
+    auto d_b = gko::clone(exec, b);
+    auto pipe_cg_factory =
+        gko::solver::PipeCg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .on(ref);
+    auto d_pipe_cg_factory =
+        gko::solver::PipeCg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .on(exec);
+    auto solver = pipe_cg_factory->generate(std::move(mtx));
+    auto d_solver = d_pipe_cg_factory->generate(std::move(d_mtx));
+
+    solver->apply(b, x);
+    d_solver->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
+}
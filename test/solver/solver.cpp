@@ -27,6 +27,9 @@
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
+#include <ginkgo/core/solver/sstep_bicgstab.hpp>
+#include <ginkgo/core/solver/sstep_cg.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
@@ -116,6 +119,23 @@ struct SimpleSolverTest {
 struct Cg : SimpleSolverTest<gko::solver::Cg<solver_value_type>> {};
 
 
+struct PipeCg : SimpleSolverTest<gko::solver::PipeCg<solver_value_type>> {
+    // alpha = rho / (delta - beta * rho / prev_alpha) cancels for columns
+    // that stagnate, which amplifies the rounding differences of the
+    // reductions far more than the explicit (p, A p) in CG
+    static double tolerance() { return 1e8 * r<value_type>::value; }
+};
+
+
+struct SstepCg : SimpleSolverTest<gko::solver::SstepCg<solver_value_type>> {
+    // the monomial basis amplifies differences in the SpMV rounding
+    static double tolerance() { return 1e7 * r<value_type>::value; }
+
+    // the stopping criteria are only checked every s iterations
+    static constexpr bool logs_iteration_complete() { return false; }
+};
+
+
 struct Cgs : SimpleSolverTest<gko::solver::Cgs<solver_value_type>> {
     static double tolerance() { return 1e5 * r<value_type>::value; }
 };
@@ -137,6 +157,15 @@ struct Bicgstab : SimpleSolverTest<gko::solver::Bicgstab<solver_value_type>> {
 };
 
 
+struct SstepBicgstab
+    : SimpleSolverTest<gko::solver::SstepBicgstab<solver_value_type>> {
+    static double tolerance() { return 1e12 * r<value_type>::value; }
+
+    // the stopping criteria are only checked every s iterations
+    static constexpr bool logs_iteration_complete() { return false; }
+};
+
+
 template <unsigned dimension>
 struct Idr : SimpleSolverTest<gko::solver::Idr<solver_value_type>> {
     static typename solver_type::parameters_type build(
@@ -887,7 +916,8 @@ protected:
 };
 
 using SolverTypes =
-    ::testing::Types<Cg, Cgs, Fcg, Bicg, Bicgstab,
+    ::testing::Types<Cg, PipeCg, SstepCg, Cgs, Fcg, Bicg, Bicgstab,
+                     SstepBicgstab,
                      /* "IDR uses different initialization approaches even when
                         deterministic", Idr<1>, Idr<4>,*/
                      Ir, CbGmres<2>, CbGmres<10>, Gmres<2>, Gmres<10>,
@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/sstep_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/sstep_bicgstab.hpp>
+#include <ginkgo/core/solver/sstep_cg.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class Sstep : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::Dense<value_type>;
+
+    Sstep() : rand_engine(30), num_rows{97}, num_rhs{7}, steps{3} {}
+
+    std::unique_ptr<Mtx> gen_mtx(gko::size_type num_rows,
+                                 gko::size_type num_cols, gko::size_type stride)
+    {
+        auto tmp_mtx = gko::test::generate_random_matrix<Mtx>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+        auto result = Mtx::create(ref, gko::dim<2>{num_rows, num_cols}, stride);
+        result->copy_from(tmp_mtx);
+        return result;
+    }
+
+    // computes the gram matrix of random basis vectors on the reference
+    // executor, so the coefficient kernels see well-defined inner products
+    std::unique_ptr<Mtx> gen_gram(gko::size_type num_left,
+                                  gko::size_type num_right)
+    {
+        auto basis = gen_mtx(num_rows * num_left, num_rhs, num_rhs);
+        auto right = basis->create_submatrix(
+            gko::span{0, num_rows * num_right}, gko::span{0, num_rhs});
+        auto gram =
+            Mtx::create(ref, gko::dim<2>{num_left * num_right, num_rhs});
+        gko::array<char> tmp{ref};
+        gko::kernels::reference::sstep::compute_gram(
+            ref, num_rows, basis.get(), right.get(), gram.get(), tmp);
+        return gram;
+    }
+
+    void initialize_stop_status()
+    {
+        stop_status =
+            std::make_unique<gko::array<gko::stopping_status>>(ref, num_rhs);
+        for (size_t i = 0; i < stop_status->get_size(); ++i) {
+            stop_status->get_data()[i].reset();
+        }
+        // check correct handling for stopped columns
+        stop_status->get_data()[1].stop(1);
+        d_stop_status = std::make_unique<gko::array<gko::stopping_status>>(
+            exec, *stop_status);
+    }
+
+    std::default_random_engine rand_engine;
+    gko::size_type num_rows;
+    gko::size_type num_rhs;
+    gko::size_type steps;
+
+    std::unique_ptr<gko::array<gko::stopping_status>> stop_status;
+    std::unique_ptr<gko::array<gko::stopping_status>> d_stop_status;
+};
+
+
+TEST_F(Sstep, SstepInitializeIsEquivalentToRef)
+{
+    initialize_stop_status();
+    auto b = gen_mtx(num_rows, num_rhs, num_rhs + 2);
+    auto r = gen_mtx(num_rows, num_rhs, num_rhs + 1);
+    auto d_b = gko::clone(exec, b);
+    auto d_r = gko::clone(exec, r);
+
+    gko::kernels::reference::sstep::initialize(ref, b.get(), r.get(),
+                                               stop_status.get());
+    gko::kernels::EXEC_NAMESPACE::sstep::initialize(exec, d_b.get(), d_r.get(),
+                                                    d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_r, r, 0);
+    GKO_ASSERT_ARRAY_EQ(*d_stop_status, *stop_status);
+}
+
+
+TEST_F(Sstep, SstepComputeGramIsEquivalentToRef)
+{
+    auto left = gen_mtx(num_rows * 4, num_rhs, num_rhs + 2);
+    auto right = gen_mtx(num_rows * 3, num_rhs, num_rhs + 1);
+    auto gram = Mtx::create(ref, gko::dim<2>{12, num_rhs});
+    auto d_left = gko::clone(exec, left);
+    auto d_right = gko::clone(exec, right);
+    auto d_gram = Mtx::create(exec, gram->get_size());
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::sstep::compute_gram(
+        ref, num_rows, left.get(), right.get(), gram.get(), tmp);
+    gko::kernels::EXEC_NAMESPACE::sstep::compute_gram(
+        exec, num_rows, d_left.get(), d_right.get(), d_gram.get(), d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_gram, gram, ::r<value_type>::value * 100);
+}
+
+
+TEST_F(Sstep, SstepCgCoefficientsIsEquivalentToRef)
+{
+    const auto m = 2 * steps + 1;
+    auto gram = gen_gram(m, m);
+    auto coeffs = Mtx::create(ref, gko::dim<2>{4 * m, num_rhs});
+    auto rho = Mtx::create(ref, gko::dim<2>{1, num_rhs});
+    auto d_gram = gko::clone(exec, gram);
+    auto d_coeffs = Mtx::create(exec, coeffs->get_size());
+    auto d_rho = Mtx::create(exec, rho->get_size());
+
+    gko::kernels::reference::sstep::cg_coefficients(
+        ref, steps, gram.get(), coeffs.get(), rho.get());
+    gko::kernels::EXEC_NAMESPACE::sstep::cg_coefficients(
+        exec, steps, d_gram.get(), d_coeffs.get(), d_rho.get());
+
+    GKO_ASSERT_MTX_NEAR(d_coeffs, coeffs, ::r<value_type>::value * 100);
+    GKO_ASSERT_MTX_NEAR(d_rho, rho, ::r<value_type>::value * 100);
+}
+
+
+TEST_F(Sstep, SstepBicgstabCoefficientsIsEquivalentToRef)
+{
+    const auto m = 4 * steps + 1;
+    auto gram = gen_gram(m + 1, m);
+    auto coeffs = Mtx::create(ref, gko::dim<2>{5 * m, num_rhs});
+    auto d_gram = gko::clone(exec, gram);
+    auto d_coeffs = Mtx::create(exec, coeffs->get_size());
+
+    gko::kernels::reference::sstep::bicgstab_coefficients(
+        ref, steps, gram.get(), coeffs.get());
+    gko::kernels::EXEC_NAMESPACE::sstep::bicgstab_coefficients(
+        exec, steps, d_gram.get(), d_coeffs.get());
+
+    GKO_ASSERT_MTX_NEAR(d_coeffs, coeffs, ::r<value_type>::value * 100);
+}
+
+
+TEST_F(Sstep, SstepCombineBasisIsEquivalentToRef)
+{
+    initialize_stop_status();
+    auto basis = gen_mtx(num_rows * 5, num_rhs, num_rhs + 2);
+    auto coeffs = gen_mtx(5, num_rhs, num_rhs);
+    auto x = gen_mtx(num_rows, num_rhs, num_rhs + 3);
+    auto y = gen_mtx(num_rows, num_rhs, num_rhs + 1);
+    auto d_basis = gko::clone(exec, basis);
+    auto d_coeffs = gko::clone(exec, coeffs);
+    auto d_x = gko::clone(exec, x);
+    auto d_y = gko::clone(exec, y);
+
+    gko::kernels::reference::sstep::combine_basis(
+        ref, num_rows, basis.get(), coeffs.get(), x.get(), true,
+        stop_status.get());
+    gko::kernels::reference::sstep::combine_basis(
+        ref, num_rows, basis.get(), coeffs.get(), y.get(), false,
+        stop_status.get());
+    gko::kernels::EXEC_NAMESPACE::sstep::combine_basis(
+        exec, num_rows, d_basis.get(), d_coeffs.get(), d_x.get(), true,
+        d_stop_status.get());
+    gko::kernels::EXEC_NAMESPACE::sstep::combine_basis(
+        exec, num_rows, d_basis.get(), d_coeffs.get(), d_y.get(), false,
+        d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_y, y, ::r<value_type>::value);
+}
+
+
+TEST_F(Sstep, SstepCgApplyIsEquivalentToRef)
+{
+    auto data = gko::matrix_data<value_type, index_type>(
+        gko::dim<2>{50, 50}, std::normal_distribution<value_type>(-1.0, 1.0),
+        rand_engine);
+    gko::utils::make_hpd(data);
+    auto mtx = Mtx::create(ref, data.size, 53);
+    mtx->read(data);
+    auto x = gen_mtx(50, 3, 5);
+    auto b = gen_mtx(50, 3, 4);
+    auto d_mtx = gko::clone(exec, mtx);
+    auto d_x = gko::clone(exec, x);
+    auto d_b = gko::clone(exec, b);
+    auto sstep_cg_factory =
+        gko::solver::SstepCg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .on(ref);
+    auto d_sstep_cg_factory =
+        gko::solver::SstepCg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .on(exec);
+    auto solver = sstep_cg_factory->generate(std::move(mtx));
+    auto d_solver = d_sstep_cg_factory->generate(std::move(d_mtx));
+
+    solver->apply(b, x);
+    d_solver->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
+}
+
+
+TEST_F(Sstep, SstepBicgstabApplyIsEquivalentToRef)
+{
+    auto data = gko::matrix_data<value_type, index_type>(
+        gko::dim<2>{50, 50}, std::normal_distribution<value_type>(-1.0, 1.0),
+        rand_engine);
+    gko::utils::make_diag_dominant(data);
+    auto mtx = Mtx::create(ref, data.size, 53);
+    mtx->read(data);
+    auto x = gen_mtx(50, 3, 5);
+    auto b = gen_mtx(50, 3, 4);
+    auto d_mtx = gko::clone(exec, mtx);
+    auto d_x = gko::clone(exec, x);
+    auto d_b = gko::clone(exec, b);
+    auto sstep_bicgstab_factory =
+        gko::solver::SstepBicgstab<value_type>::build()
+            .with_steps(2u)
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .on(ref);
+    auto d_sstep_bicgstab_factory =
+        gko::solver::SstepBicgstab<value_type>::build()
+            .with_steps(2u)
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .on(exec);
+    auto solver = sstep_bicgstab_factory->generate(std::move(mtx));
+    auto d_solver = d_sstep_bicgstab_factory->generate(std::move(d_mtx));
+
+    solver->apply(b, x);
+    d_solver->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
+}
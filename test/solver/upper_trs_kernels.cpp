@@ -68,6 +68,23 @@ protected:
         dmtx_u = gko::clone(exec, mtx_u);
     }
 
+    void initialize_sparse_data(int m, int n)
+    {
+        auto data = gko::test::generate_random_triangular_matrix_data<
+            value_type, index_type>(m, false, false,
+                                    std::uniform_int_distribution<>(1, 5),
+                                    std::normal_distribution<>(-1.0, 1.0),
+                                    rand_engine);
+        gko::utils::make_diag_dominant(data);
+        b = gen_vec(m, n);
+        x = gen_vec(m, n);
+        mtx_u = mtx_type::create(ref);
+        mtx_u->read(data);
+        dx = gko::clone(exec, x);
+        db = gko::clone(exec, b);
+        dmtx_u = gko::clone(exec, mtx_u);
+    }
+
     std::shared_ptr<vec_type> b;
     std::shared_ptr<vec_type> x;
     std::shared_ptr<mtx_type> mtx;
@@ -337,6 +354,53 @@ TEST_F(UpperTrs, ApplyTriangularSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
 }
 
 
+TEST_F(UpperTrs, ApplyLargeSparseTriangularMtxIsEquivalentToRef)
+{
+    initialize_sparse_data(2000, 1);
+    auto upper_trs_factory = solver_type::build().on(ref);
+    auto d_upper_trs_factory = solver_type::build().on(exec);
+    auto solver = upper_trs_factory->generate(mtx_u);
+    auto d_solver = d_upper_trs_factory->generate(dmtx_u);
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(UpperTrs, ApplyLargeSparseTriangularMtxUnitDiagIsEquivalentToRef)
+{
+    initialize_sparse_data(2000, 1);
+    auto upper_trs_factory =
+        solver_type::build().with_unit_diagonal(true).on(ref);
+    auto d_upper_trs_factory =
+        solver_type::build().with_unit_diagonal(true).on(exec);
+    auto solver = upper_trs_factory->generate(mtx_u);
+    auto d_solver = d_upper_trs_factory->generate(dmtx_u);
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
+TEST_F(UpperTrs, ApplyLargeSparseTriangularMtxMultipleRhsIsEquivalentToRef)
+{
+    initialize_sparse_data(2000, 3);
+    auto upper_trs_factory = solver_type::build().with_num_rhs(3u).on(ref);
+    auto d_upper_trs_factory = solver_type::build().with_num_rhs(3u).on(exec);
+    auto solver = upper_trs_factory->generate(mtx_u);
+    auto d_solver = d_upper_trs_factory->generate(dmtx_u);
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
 #ifdef GKO_COMPILING_CUDA
 
 